@@ -7,6 +7,7 @@
 #include "OnlineChatInterfaceAccelByte.h"
 #include "OnlinePredefinedEventInterfaceAccelByte.h"
 #include "AsyncTasks/OnlineAsyncTaskAccelByteUtils.h"
+#include "Utilities/AccelByteResponseRecorder.h"
 
 using namespace AccelByte;
 
@@ -25,10 +26,15 @@ void FOnlineAsyncTaskAccelByteChatGetConfig::Initialize()
 
 	AB_OSS_ASYNC_TASK_TRACE_BEGIN(TEXT("UserId: %s"), *UserId->ToDebugString());
 
-	const AccelByte::THandler<FAccelByteModelsChatPublicConfigResponse> OnGetChatConfigSuccess =
+	AccelByte::THandler<FAccelByteModelsChatPublicConfigResponse> OnGetChatConfigSuccess =
 		TDelegateUtils<AccelByte::THandler<FAccelByteModelsChatPublicConfigResponse>>::CreateThreadSafeSelfPtr(this, &FOnlineAsyncTaskAccelByteChatGetConfig::OnGetChatConfigSuccess);
-	const AccelByte::FErrorHandler OnGetChatConfigFail =
+	AccelByte::FErrorHandler OnGetChatConfigFail =
 		TDelegateUtils<AccelByte::FErrorHandler>::CreateThreadSafeSelfPtr(this, &FOnlineAsyncTaskAccelByteChatGetConfig::OnGetChatConfigError);
+	if (FAccelByteResponseRecorder::Get().Intercept(TEXT("Chat.GetChatConfig"), OnGetChatConfigSuccess, OnGetChatConfigFail))
+	{
+		AB_OSS_ASYNC_TASK_TRACE_END(TEXT("Replaying recorded response"));
+		return;
+	}
 	API_FULL_CHECK_GUARD(Chat, ErrorStr);
 	Chat->GetChatConfig(OnGetChatConfigSuccess, OnGetChatConfigFail);
 
@@ -2,6 +2,7 @@
 
 #include "OnlineEntitlementsInterfaceAccelByte.h"
 #include "Interfaces/OnlineEntitlementsInterface.h"
+#include "Utilities/AccelByteResponseRecorder.h"
 
 using namespace AccelByte;
 
@@ -11,6 +12,7 @@ FOnlineAsyncTaskAccelByteQueryEntitlements::FOnlineAsyncTaskAccelByteQueryEntitl
 	PagedQuery(InPage)
 {
 	UserId = FUniqueNetIdAccelByteUser::CastChecked(InUserId);
+	RetryPolicy = FAccelByteRetryPolicy::ForService(TEXT("Entitlement"));
 }
 
 void FOnlineAsyncTaskAccelByteQueryEntitlements::Initialize()
@@ -43,9 +45,16 @@ void FOnlineAsyncTaskAccelByteQueryEntitlements::TriggerDelegates()
 void FOnlineAsyncTaskAccelByteQueryEntitlements::QueryEntitlement(int32 Offset, int32 Limit)
 {
 	AB_OSS_ASYNC_TASK_TRACE_BEGIN(TEXT("Starting Query entitlement, Offset: %d, Limit: %d"), Offset, Limit);
+	LastOffset = Offset;
+	LastLimit = Limit;
 	THandler<FAccelByteModelsEntitlementPagingSlicedResult> OnQueryEntitlementSuccess =
 		TDelegateUtils<THandler<FAccelByteModelsEntitlementPagingSlicedResult>>::CreateThreadSafeSelfPtr(this, &FOnlineAsyncTaskAccelByteQueryEntitlements::HandleQueryEntitlementSuccess);
 	FErrorHandler OnError = TDelegateUtils<FErrorHandler>::CreateThreadSafeSelfPtr(this, &FOnlineAsyncTaskAccelByteQueryEntitlements::HandleQueryEntitlementError);
+	if (FAccelByteResponseRecorder::Get().Intercept(TEXT("Entitlement.QueryUserEntitlements"), OnQueryEntitlementSuccess, OnError))
+	{
+		AB_OSS_ASYNC_TASK_TRACE_END(TEXT("Replaying recorded response"));
+		return;
+	}
 	API_FULL_CHECK_GUARD(Entitlement, ErrorMessage);
 	Entitlement->QueryUserEntitlements(TEXT(""), TEXT(""), Offset, Limit, OnQueryEntitlementSuccess, OnError, EAccelByteEntitlementClass::NONE, EAccelByteAppType::NONE);
 	AB_OSS_ASYNC_TASK_TRACE_END(TEXT(""));
@@ -137,6 +146,12 @@ void FOnlineAsyncTaskAccelByteQueryEntitlements::HandleQueryEntitlementError(int
 {
 	AB_OSS_ASYNC_TASK_TRACE_BEGIN_VERBOSITY(Error, TEXT("Code: %d; Message: %s"), Code, *ErrMsg);
 
+	if (TryRetryRequest(Code, [this]() { QueryEntitlement(LastOffset, LastLimit); }))
+	{
+		AB_OSS_ASYNC_TASK_TRACE_END(TEXT("Retrying query entitlement, Offset: %d, Limit: %d"), LastOffset, LastLimit);
+		return;
+	}
+
 	ErrorMessage = ErrMsg;
 	CompleteTask(EAccelByteAsyncTaskCompleteState::RequestFailed);
 
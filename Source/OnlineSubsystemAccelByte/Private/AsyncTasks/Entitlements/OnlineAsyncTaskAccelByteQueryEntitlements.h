@@ -31,4 +31,8 @@ private:
 	FString Namespace;
 	FPagedQuery PagedQuery;
 	FString ErrorMessage;
+
+	/** Page requested last, sent again if the request fails with a retryable error */
+	int32 LastOffset = 0;
+	int32 LastLimit = 0;
 };
@@ -14,6 +14,7 @@ FOnlineAsyncTaskAccelByteQueryBlockedPlayers::FOnlineAsyncTaskAccelByteQueryBloc
 	: FOnlineAsyncTaskAccelByte(InABInterface)
 {
 	UserId = FUniqueNetIdAccelByteUser::CastChecked(InUserId);
+	RetryPolicy = FAccelByteRetryPolicy::ForService(TEXT("Lobby"));
 }
 
 void FOnlineAsyncTaskAccelByteQueryBlockedPlayers::Initialize()
@@ -22,6 +23,15 @@ void FOnlineAsyncTaskAccelByteQueryBlockedPlayers::Initialize()
 
 	AB_OSS_ASYNC_TASK_TRACE_BEGIN(TEXT("UserId: %s"), *UserId->ToDebugString());
 
+	GetListOfBlockedUsers();
+
+	AB_OSS_ASYNC_TASK_TRACE_END(TEXT(""));
+}
+
+void FOnlineAsyncTaskAccelByteQueryBlockedPlayers::GetListOfBlockedUsers()
+{
+	AB_OSS_ASYNC_TASK_TRACE_BEGIN(TEXT("UserId: %s"), *UserId->ToDebugString());
+
 	THandler<FAccelByteModelsListBlockedUserResponse> OnGetListOfBlockedUsersSuccessDelegate = TDelegateUtils<THandler<FAccelByteModelsListBlockedUserResponse>>::CreateThreadSafeSelfPtr(this, &FOnlineAsyncTaskAccelByteQueryBlockedPlayers::OnGetListOfBlockedUsersSuccess);
 	FErrorHandler OnGetListOfBlockedUsersErrorDelegate = TDelegateUtils<FErrorHandler>::CreateThreadSafeSelfPtr(this, &FOnlineAsyncTaskAccelByteQueryBlockedPlayers::OnGetListOfBlockedUsersError);
 	API_FULL_CHECK_GUARD(Lobby, ErrorStr);
@@ -97,6 +107,12 @@ void FOnlineAsyncTaskAccelByteQueryBlockedPlayers::OnGetListOfBlockedUsersSucces
 
 void FOnlineAsyncTaskAccelByteQueryBlockedPlayers::OnGetListOfBlockedUsersError(int32 ErrorCode, const FString& ErrorMessage)
 {
+	if (TryRetryRequest(ErrorCode, [this]() { GetListOfBlockedUsers(); }))
+	{
+		UE_LOG_AB(Log, TEXT("Retrying to get list of blocked users. Error code: %d; Error message: %s"), ErrorCode, *ErrorMessage);
+		return;
+	}
+
 	ErrorStr = TEXT("blocked-players-request-failed");
 	UE_LOG_AB(Warning, TEXT("Failed to get list of blocked users as the query to the backend failed. Error code: %d; Error message: %s"), ErrorCode, *ErrorMessage);
 	CompleteTask(EAccelByteAsyncTaskCompleteState::RequestFailed);
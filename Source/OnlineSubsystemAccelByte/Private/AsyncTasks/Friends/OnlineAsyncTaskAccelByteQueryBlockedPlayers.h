@@ -40,6 +40,9 @@ private:
 	/** String representing errors that occurred while trying to query blocked players, passed to delegate */
 	FString ErrorStr;
 
+	/** Send the request to list all blocked users, again on retry */
+	void GetListOfBlockedUsers();
+
 	/** Delegate handler for when the request to list all blocked users succeeds */
 	void OnGetListOfBlockedUsersSuccess(const FAccelByteModelsListBlockedUserResponse& Result);
 
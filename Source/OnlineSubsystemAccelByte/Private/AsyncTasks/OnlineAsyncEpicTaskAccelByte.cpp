@@ -40,185 +40,368 @@ void FOnlineAsyncEpicTaskAccelByte::Tick()
 	{
 		CurrentState = EAccelByteAsyncTaskState::Working;
 		FOnlineAsyncTaskAccelByte::OnTaskStartWorking();
+		LastTickTimeInSeconds = FPlatformTime::Seconds();
 	}
 
-	if (TaskContainer.Num() == 0)
+	if (IsCancelled())
 	{
-		//nothing to do, set as complete
-		this->CompleteTask(EAccelByteAsyncTaskCompleteState::Success);
-		return;
-	}
-	
-	const double HardLimitSeconds = 0.15f;
-	auto CurrentTime = FPlatformTime::Seconds();
-	auto Delta = CurrentTime - FOnlineAsyncTaskAccelByte::LastTaskUpdateInSeconds;
-#if !UE_BUILD_SHIPPING
-	// To ignore large delta (breakpoints, alt-tab, etc)
-	Delta = FMath::Min<double>(Delta, HardLimitSeconds);
-#endif
-	TDoubleLinkedList<TArray<FOnlineAsyncTaskAccelByte*>>::TDoubleLinkedListNode* Node = TaskContainer.GetHead();
-	if (Node == nullptr)
-	{
-		//nothing to do with the task container because it is empty
+		ForcefullySetCancelledState();
 		return;
 	}
 
-	//Cleanup empty queue, iteration stops if it finds a non-empty Array
-	while (Node->GetValue().Num() == 0)
+	// Children are ticked and initialized outside of the lock, they may enqueue more children into this Epic
+	TickingNodes.Reset();
+	double Delta = 0.0;
 	{
-		auto NextNode = Node->GetNextNode();
-		TaskContainer.RemoveNode(Node);
-		if (NextNode == nullptr)
+		FScopeLock Lock(&GraphLock);
+
+		if (PendingNodeNum == 0)
 		{
+			//nothing to do, set as complete
+			this->CompleteTask(EAccelByteAsyncTaskCompleteState::Success);
 			return;
 		}
-		Node = NextNode;
+
+		const double HardLimitSeconds = 0.15f;
+		const double CurrentTime = FPlatformTime::Seconds();
+		Delta = CurrentTime - LastTickTimeInSeconds;
+#if !UE_BUILD_SHIPPING
+		// To ignore large delta (breakpoints, alt-tab, etc)
+		Delta = FMath::Min<double>(Delta, HardLimitSeconds);
+#endif
+		LastTickTimeInSeconds = CurrentTime;
+
+		for (const int32 NodeIndex : RunningNodes)
+		{
+			TickingNodes.Emplace(NodeIndex, Nodes[NodeIndex].Task);
+		}
 	}
 
-	TArray<FOnlineAsyncTaskAccelByte*>& CurrentQueue = Node->GetValue();
-	TArray<FOnlineAsyncTaskAccelByte*> CopyOfQueue = {};
 	bool bIsTimeout = false;
-
-	for (int i = 0; i < CurrentQueue.Num(); i++)
+	DoneNodes.Reset();
+	for (const TPair<int32, FOnlineAsyncTaskAccelByte*>& TickingNode : TickingNodes)
 	{
-		FOnlineAsyncTaskAccelByte* CurrentTask = CurrentQueue[i];
-		if (CurrentTask == nullptr)
+		FOnlineAsyncTaskAccelByte* CurrentTask = TickingNode.Value;
+		CurrentTask->Tick(Delta);
+		if (CurrentTask->IsDone())
 		{
+			DoneNodes.Add(TickingNode.Key);
 			continue;
 		}
 
-		if (CurrentTask->GetCurrentState() == EAccelByteAsyncTaskState::Uninitialized)
+		if (CurrentTask->HasTaskTimedOut())
 		{
-			CurrentTask->Initialize();
+			bIsTimeout = true;
+			break;
 		}
-		else if (!bIsTimeout)
+	}
+
+	// Hand completed children over, they release their dependents into ReadyNodes
+	CompletedTasks.Reset();
+	{
+		FScopeLock Lock(&GraphLock);
+		for (const int32 NodeIndex : DoneNodes)
 		{
-			CurrentTask->Tick(Delta);
-			if (CurrentTask->IsDone())
+			if (Nodes[NodeIndex].State != ENodeState::Running)
 			{
-				if (!SubsystemPin.IsValid())
-				{
-					continue;
-				}
-				SubsystemPin->AddTaskToOutQueue(CurrentTask);
 				continue;
 			}
+			RunningNodes.RemoveSingleSwap(NodeIndex, false);
+			CompleteNode(NodeIndex);
+			CompletedTasks.Add(Nodes[NodeIndex].Task);
 		}
-		CopyOfQueue.Add(CurrentTask);
-		if (CurrentTask->HasTaskTimedOut())
+	}
+	for (FOnlineAsyncTaskAccelByte* CompletedTask : CompletedTasks)
+	{
+		SubsystemPin->AddTaskToOutQueue(CompletedTask);
+	}
+
+	if (bIsTimeout)
+	{
+		this->Timeout();
+		return;
+	}
+
+	// Start every child whose prerequisites have completed. They are marked as running under the lock and initialized
+	// after it is released.
+	StartingTasks.Reset();
+	CancelledTasks.Reset();
+	{
+		FScopeLock Lock(&GraphLock);
+		StartingNodes.Reset();
+		StartingNodes.Append(ReadyNodes);
+		ReadyNodes.Reset();
+		for (const int32 NodeIndex : StartingNodes)
 		{
-			bIsTimeout = true;
-			continue;
+			if (Nodes[NodeIndex].State != ENodeState::Ready)
+			{
+				continue;
+			}
+
+			// Children can hold a different token than the Epic, do not start work that nobody is waiting for anymore
+			FOnlineAsyncTaskAccelByte* StartingTask = Nodes[NodeIndex].Task;
+			if (StartingTask->IsCancelled())
+			{
+				CompleteNode(NodeIndex);
+				CancelledTasks.Add(StartingTask);
+				continue;
+			}
+
+			Nodes[NodeIndex].State = ENodeState::Running;
+			RunningNodes.Add(NodeIndex);
+			StartingTasks.Add(StartingTask);
 		}
 	}
 
-	if (CopyOfQueue.Num() == 0)
+	for (FOnlineAsyncTaskAccelByte* CancelledTask : CancelledTasks)
 	{
-		TaskContainer.RemoveNode(Node);
+		CancelledTask->ForcefullySetCancelledState();
+		SubsystemPin->AddTaskToOutQueue(CancelledTask);
 	}
-	else
+	for (FOnlineAsyncTaskAccelByte* StartingTask : StartingTasks)
 	{
-		Node->GetValue() = CopyOfQueue;
+		StartingTask->Initialize();
 	}
+}
 
-	LastTaskUpdateInSeconds = CurrentTime;
+void FOnlineAsyncEpicTaskAccelByte::Timeout()
+{
+	TRY_PIN_SUBSYSTEM();
 
-	if (bIsTimeout)
+	TArray<FOnlineAsyncTaskAccelByte*, TInlineAllocator<8>> PendingTasks;
+	TakePendingTasks(PendingTasks);
+	for (FOnlineAsyncTaskAccelByte* PendingTask : PendingTasks)
 	{
-		this->Timeout();
+		PendingTask->ForcefullySetTimeoutState();
+		SubsystemPin->AddTaskToOutQueue(PendingTask);
 	}
-}
 
+	this->CompleteTask(EAccelByteAsyncTaskCompleteState::TimedOut);
+	this->OnTaskTimedOut();
+}
 
-void FOnlineAsyncEpicTaskAccelByte::Timeout()
+void FOnlineAsyncEpicTaskAccelByte::Enqueue(ETypeOfOnlineAsyncTask TaskType, FOnlineAsyncTaskAccelByte* ChildTask)
 {
-	TRY_PIN_SUBSYSTEM();
+	if (ChildTask == nullptr)
+	{
+		return;
+	}
 
-	TDoubleLinkedList<TArray<FOnlineAsyncTaskAccelByte*>>::TDoubleLinkedListNode* Node = TaskContainer.GetHead();
+	FScopeLock Lock(&GraphLock);
 
-	while (Node != nullptr)
+	const int32 NodeIndex = Nodes.AddDefaulted();
+	Nodes[NodeIndex].Task = ChildTask;
+	// Replaces the index of a completed child that was freed and had its memory reused by this one
+	NodeIndices.Add(ChildTask, NodeIndex);
+	PendingNodeNum++;
+
+	// A child enqueued by a running child is nested work of that parent. It must not wait on the most recent group,
+	// which may itself be waiting on the parent.
+	const int32 ParentIndex = FindNode(ChildTask->GetParentTask());
+	if (ParentIndex != INDEX_NONE && ParentIndex != NodeIndex && Nodes[ParentIndex].State == ENodeState::Running)
 	{
-		TArray<FOnlineAsyncTaskAccelByte*>& CurrentQueue = Node->GetValue();
+		if (TaskType == ETypeOfOnlineAsyncTask::Serial)
+		{
+			if (Nodes[ParentIndex].LastNestedSerialChild != INDEX_NONE)
+			{
+				LinkPrerequisite(NodeIndex, Nodes[ParentIndex].LastNestedSerialChild);
+			}
+			Nodes[ParentIndex].LastNestedSerialChild = NodeIndex;
+		}
 
-		for (int i = 0; i < CurrentQueue.Num(); i++)
+		// Everything waiting on the parent also waits on its nested work
+		for (const int32 Dependent : Nodes[ParentIndex].Dependents)
+		{
+			LinkPrerequisite(Dependent, NodeIndex);
+		}
+		if (TailGroup.Contains(ParentIndex))
+		{
+			TailGroup.Add(NodeIndex);
+		}
+	}
+	else
+	{
+		switch (TaskType)
 		{
-			FOnlineAsyncTaskAccelByte* CurrentTask = CurrentQueue[i];
-			if (CurrentTask == nullptr)
+		case ETypeOfOnlineAsyncTask::Parallel:
+			for (const int32 PrerequisiteIndex : TailGroupPrerequisites)
 			{
-				continue;
+				LinkPrerequisite(NodeIndex, PrerequisiteIndex);
+			}
+			TailGroup.Add(NodeIndex);
+			break;
+		case ETypeOfOnlineAsyncTask::Serial:
+			if (IsGroupRunning(TailGroup))
+			{
+				// Enqueued as nested work of the running group, waiting on that group would never resolve
+				if (LastNestedSerialNode != INDEX_NONE)
+				{
+					LinkPrerequisite(NodeIndex, LastNestedSerialNode);
+				}
+				LastNestedSerialNode = NodeIndex;
+				TailGroup.Add(NodeIndex);
+			}
+			else
+			{
+				for (const int32 PrerequisiteIndex : TailGroup)
+				{
+					LinkPrerequisite(NodeIndex, PrerequisiteIndex);
+				}
+				TailGroupPrerequisites = TailGroup;
+				TailGroup.Reset();
+				TailGroup.Add(NodeIndex);
+				LastNestedSerialNode = INDEX_NONE;
 			}
-			CurrentTask->ForcefullySetTimeoutState();
-			SubsystemPin->AddTaskToOutQueue(CurrentTask);
+			break;
+		default:
+			break;
 		}
+	}
 
-		Node = Node->GetNextNode();
+	if (Nodes[NodeIndex].RemainingPrerequisites == 0)
+	{
+		Nodes[NodeIndex].State = ENodeState::Ready;
+		ReadyNodes.Add(NodeIndex);
 	}
+}
 
-	this->CompleteTask(EAccelByteAsyncTaskCompleteState::TimedOut);
-	this->OnTaskTimedOut();
+void FOnlineAsyncEpicTaskAccelByte::ForcefullySetCancelledState()
+{
+	const FOnlineSubsystemAccelBytePtr SubsystemPin = AccelByteSubsystem.Pin();
+
+	TArray<FOnlineAsyncTaskAccelByte*, TInlineAllocator<8>> PendingTasks;
+	TakePendingTasks(PendingTasks);
+	for (FOnlineAsyncTaskAccelByte* PendingTask : PendingTasks)
+	{
+		PendingTask->ForcefullySetCancelledState();
+		if (SubsystemPin.IsValid())
+		{
+			SubsystemPin->AddTaskToOutQueue(PendingTask);
+		}
+	}
+
+	FOnlineAsyncTaskAccelByte::ForcefullySetCancelledState();
+}
+
+void FOnlineAsyncEpicTaskAccelByte::TakePendingTasks(TArray<FOnlineAsyncTaskAccelByte*, TInlineAllocator<8>>& OutTasks)
+{
+	FScopeLock Lock(&GraphLock);
+
+	for (FNode& Node : Nodes)
+	{
+		if (Node.State == ENodeState::Done)
+		{
+			continue;
+		}
+		Node.State = ENodeState::Done;
+		OutTasks.Add(Node.Task);
+	}
+
+	PendingNodeNum = 0;
+	ReadyNodes.Reset();
+	RunningNodes.Reset();
+}
+
+int32 FOnlineAsyncEpicTaskAccelByte::GetPendingTaskNum() const
+{
+	FScopeLock Lock(&GraphLock);
+	return PendingNodeNum;
+}
+
+int32 FOnlineAsyncEpicTaskAccelByte::GetRunningTaskNum() const
+{
+	FScopeLock Lock(&GraphLock);
+	return RunningNodes.Num();
+}
+
+uint32 FOnlineAsyncEpicTaskAccelByte::GetCurrentStackCapacity()
+{
+	return GetTaskContainer().Num();
 }
 
-bool FOnlineAsyncEpicTaskAccelByte::bIsTopStackRunning()
+const TDoubleLinkedList<TArray<FOnlineAsyncTaskAccelByte*>>& FOnlineAsyncEpicTaskAccelByte::GetTaskContainer()
 {
-	if (TaskContainer.Num() == 0 || TaskContainer.GetHead() == nullptr)
+	FScopeLock Lock(&GraphLock);
+
+	TArray<FOnlineAsyncTaskAccelByte*> StartedTasks;
+	TArray<FOnlineAsyncTaskAccelByte*> WaitingTasks;
+	for (const FNode& Node : Nodes)
+	{
+		if (Node.State == ENodeState::Waiting)
+		{
+			WaitingTasks.Add(Node.Task);
+		}
+		else if (Node.State != ENodeState::Done)
+		{
+			StartedTasks.Add(Node.Task);
+		}
+	}
+
+	LegacyTaskContainer.Empty();
+	if (StartedTasks.Num() > 0)
 	{
-		return false;
+		LegacyTaskContainer.AddTail(MoveTemp(StartedTasks));
 	}
-	
-	if (TaskContainer.GetHead() || TaskContainer.GetHead()->GetValue().Num() == 0)
+	if (WaitingTasks.Num() > 0)
 	{
-		return false;
+		LegacyTaskContainer.AddTail(MoveTemp(WaitingTasks));
 	}
+	return LegacyTaskContainer;
+}
 
-	auto AsyncTaskAB = TaskContainer.GetHead()->GetValue();
-	if (AsyncTaskAB.Num() == 0)
+int32 FOnlineAsyncEpicTaskAccelByte::FindNode(const FOnlineAsyncTaskAccelByte* Task) const
+{
+	if (Task == nullptr)
 	{
-		return false;
+		return INDEX_NONE;
 	}
 
-	auto TopStackState = (AsyncTaskAB[0])->GetCurrentState();
-	return TopStackState != EAccelByteAsyncTaskState::Uninitialized;
+	const int32* NodeIndex = NodeIndices.Find(Task);
+	return NodeIndex == nullptr ? INDEX_NONE : *NodeIndex;
 }
 
-void FOnlineAsyncEpicTaskAccelByte::Enqueue(ETypeOfOnlineAsyncTask TaskType, FOnlineAsyncTaskAccelByte* ChildTask)
+bool FOnlineAsyncEpicTaskAccelByte::IsGroupRunning(const TArray<int32, TInlineAllocator<8>>& Group) const
 {
-	auto Stack = TArray<FOnlineAsyncTaskAccelByte*>();
-	Stack.Add(ChildTask);
+	for (const int32 NodeIndex : Group)
+	{
+		if (Nodes[NodeIndex].State == ENodeState::Running)
+		{
+			return true;
+		}
+	}
+	return false;
+}
 
-	if (bIsTopStackRunning() || TaskContainer.Num() == 0)
+void FOnlineAsyncEpicTaskAccelByte::LinkPrerequisite(int32 NodeIndex, int32 PrerequisiteIndex)
+{
+	FNode& Prerequisite = Nodes[PrerequisiteIndex];
+	if (Prerequisite.State == ENodeState::Done || Prerequisite.Dependents.Contains(NodeIndex))
 	{
-		TaskContainer.AddHead(Stack);
 		return;
 	}
+	Prerequisite.Dependents.Add(NodeIndex);
+	Nodes[NodeIndex].RemainingPrerequisites++;
+}
 
-	switch (TaskType)
+
+void FOnlineAsyncEpicTaskAccelByte::CompleteNode(int32 NodeIndex)
+{
+	FNode& Node = Nodes[NodeIndex];
+	Node.State = ENodeState::Done;
+	PendingNodeNum--;
+
+	if (LastNestedSerialNode == NodeIndex)
 	{
-	case ETypeOfOnlineAsyncTask::Parallel:
-		TaskContainer.GetHead()->GetValue().Add(ChildTask);
-		break;
-	case ETypeOfOnlineAsyncTask::Serial:
+		LastNestedSerialNode = INDEX_NONE;
+	}
+
+	for (const int32 Dependent : Node.Dependents)
 	{
-		auto NodePtr = TaskContainer.GetHead();
-		while (NodePtr != nullptr)
+		FNode& DependentNode = Nodes[Dependent];
+		if (--DependentNode.RemainingPrerequisites == 0 && DependentNode.State == ENodeState::Waiting)
 		{
-			if (NodePtr->GetValue().Num() == 0)
-			{
-				NodePtr->GetNextNode();
-				continue;
-			}
-
-			// If running, insert above the running task
-			if (NodePtr->GetValue()[0]->GetCurrentState() != EAccelByteAsyncTaskState::Uninitialized)
-			{
-				TaskContainer.InsertNode(Stack, NodePtr);
-				return;
-			}
-			NodePtr = NodePtr->GetNextNode();
+			DependentNode.State = ENodeState::Ready;
+			ReadyNodes.Add(Dependent);
 		}
-		TaskContainer.AddTail(Stack);
-	}
-		break;
-	default:
-		break;
 	}
 }
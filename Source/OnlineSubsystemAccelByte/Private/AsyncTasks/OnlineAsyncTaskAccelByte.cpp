@@ -74,10 +74,182 @@ int32 InLocalUserNum, uint8 InFlags, TSharedPtr<FAccelByteKey> InLockKey)
 	TaskTimeoutInSeconds = static_cast<double>(AccelByte::FHttpRetryScheduler::TotalTimeout) + 1.0;
 }
 
+FOnlineAsyncTaskAccelByte::~FOnlineAsyncTaskAccelByte()
+{
+	const TSharedPtr<FAccelByteTimeoutWheel, ESPMode::ThreadSafe> TimeoutWheelPin = TimeoutWheel.Pin();
+	if (TimeoutWheelPin.IsValid())
+	{
+		TimeoutWheelPin->Cancel(this);
+	}
+}
+
+void FOnlineAsyncTaskAccelByte::ScheduleTimeout()
+{
+	if (!bShouldUseTimeout || Epic != nullptr)
+	{
+		return;
+	}
+
+	TSharedPtr<FAccelByteTimeoutWheel, ESPMode::ThreadSafe> TimeoutWheelPin = TimeoutWheel.Pin();
+	if (!TimeoutWheelPin.IsValid())
+	{
+		const FOnlineSubsystemAccelBytePtr SubsystemPin = AccelByteSubsystem.Pin();
+		const FOnlineAsyncTaskManagerAccelBytePtr AsyncTaskManager = SubsystemPin.IsValid() ? SubsystemPin->GetAsyncTaskManager() : nullptr;
+		if (!AsyncTaskManager.IsValid())
+		{
+			return;
+		}
+
+		TimeoutWheelPin = AsyncTaskManager->GetTimeoutWheel();
+		if (!TimeoutWheelPin.IsValid())
+		{
+			return;
+		}
+		TimeoutWheel = TimeoutWheelPin;
+	}
+
+	TimeoutWheelPin->Schedule(this, GetTimeoutDeadlineInSeconds());
+}
+
+bool FOnlineAsyncTaskAccelByte::ResolveUserFromSlotCache()
+{
+	if (ApiClientInternal.IsValid())
+	{
+		return false;
+	}
+
+	const FOnlineSubsystemAccelBytePtr SubsystemPin = AccelByteSubsystem.Pin();
+	if (!SubsystemPin.IsValid())
+	{
+		return false;
+	}
+
+	FAccelByteUserSlot Slot;
+	int32 FoundLocalUserNum = LocalUserNum;
+	if (LocalUserNum != INVALID_CONTROLLERID)
+	{
+		if (!SubsystemPin->GetUserSlotCache().Find(LocalUserNum, Slot))
+		{
+			return false;
+		}
+	}
+	else if (!UserId.IsValid() || !SubsystemPin->GetUserSlotCache().FindByUserId(*UserId, FoundLocalUserNum, Slot))
+	{
+		return false;
+	}
+
+	if (!Slot.ApiClient.IsValid() || !Slot.UserId.IsValid())
+	{
+		return false;
+	}
+
+	ApiClientInternal = Slot.ApiClient;
+	LocalUserNum = FoundLocalUserNum;
+	if (!UserId.IsValid())
+	{
+		UserId = Slot.UserId;
+	}
+	return true;
+}
+
+bool FOnlineAsyncTaskAccelByte::TryRetryRequest(int32 ErrorCode, TFunction<void()>&& Retry)
+{
+	if (!RetryPolicy.IsRetryable(ErrorCode))
+	{
+		return false;
+	}
+
+	const FOnlineSubsystemAccelBytePtr SubsystemPin = AccelByteSubsystem.Pin();
+	const FOnlineAsyncTaskManagerAccelBytePtr AsyncTaskManager = SubsystemPin.IsValid() ? SubsystemPin->GetAsyncTaskManager() : nullptr;
+	if (!AsyncTaskManager.IsValid())
+	{
+		return false;
+	}
+
+	const TSharedRef<FAccelByteCircuitBreakers, ESPMode::ThreadSafe> CircuitBreakers = AsyncTaskManager->GetCircuitBreakers();
+	CircuitBreakers->RecordFailure(RetryPolicy.ServiceName);
+
+	if (!AsyncTaskManager->IsRequestRetryEnabled() || IsCancelled() || AttemptNum >= RetryPolicy.MaxAttempts)
+	{
+		return false;
+	}
+
+	// Retrying against a service that is known to be down only adds to its load, fail the task instead
+	if (!CircuitBreakers->AllowRequest(RetryPolicy.ServiceName))
+	{
+		UE_LOG_AB(Warning, TEXT("Not retrying task %s, circuit breaker of service %s is open"), *GetTaskName(), *RetryPolicy.ServiceName.ToString());
+		return false;
+	}
+
+	CircuitBreakers->RecordRetry(RetryPolicy.ServiceName);
+
+	const double BackoffInSeconds = RetryPolicy.GetBackoffSeconds(AttemptNum);
+	{
+		FScopeLock ScopeLock(&RetryLock);
+		AttemptNum++;
+		PendingRetry = MoveTemp(Retry);
+		NextRetryTimeInSeconds = FPlatformTime::Seconds() + BackoffInSeconds;
+	}
+
+	UE_LOG_AB(Log, TEXT("Task %s failed with error %d, retrying in %.2f s (attempt %d of %d)"), *GetTaskName(), ErrorCode, BackoffInSeconds, AttemptNum, RetryPolicy.MaxAttempts);
+
+	// The backoff is progress as far as the timeout is concerned, the retry gets a full timeout of its own
+	if (bShouldUseTimeout)
+	{
+		SetLastUpdateTimeToCurrentTime();
+		DeltaTickAccumulation = 0.0;
+	}
+
+	return true;
+}
+
+void FOnlineAsyncTaskAccelByte::TickPendingRetry()
+{
+	TFunction<void()> Retry;
+	{
+		FScopeLock ScopeLock(&RetryLock);
+		if (!PendingRetry || bIsComplete || FPlatformTime::Seconds() < NextRetryTimeInSeconds)
+		{
+			return;
+		}
+		Retry = MoveTemp(PendingRetry);
+		PendingRetry = nullptr;
+	}
+
+	if (bShouldUseTimeout)
+	{
+		SetLastUpdateTimeToCurrentTime();
+	}
+	Retry();
+}
+
 void FOnlineAsyncTaskAccelByte::ForcefullySetTimeoutState()
 {
 	CompleteTask(EAccelByteAsyncTaskCompleteState::TimedOut);
 	OnTaskTimedOut();
 	DeltaTickAccumulation += TaskTimeoutInSeconds;
-	LastTaskUpdateInSeconds -= TaskTimeoutInSeconds;
+	LastTaskUpdateInSeconds.store(LastTaskUpdateInSeconds.load() - TaskTimeoutInSeconds);
+	MarkTimeoutExpired();
+}
+
+void FOnlineAsyncTaskAccelByte::ForcefullySetRejectedState()
+{
+	// Delegates usually report both identifiers of the user, resolve them as Initialize would have done
+	if (!HasFlag(EAccelByteAsyncTaskFlags::ServerTask))
+	{
+		GetOtherUserIdentifiers();
+	}
+
+	CompleteTask(EAccelByteAsyncTaskCompleteState::Rejected);
+}
+
+void FOnlineAsyncTaskAccelByte::ForcefullySetCancelledState()
+{
+	if (bIsComplete)
+	{
+		return;
+	}
+
+	UE_LOG_AB(Verbose, TEXT("Task %s has been cancelled"), *GetTaskName());
+	CompleteTask(EAccelByteAsyncTaskCompleteState::Cancelled);
 }
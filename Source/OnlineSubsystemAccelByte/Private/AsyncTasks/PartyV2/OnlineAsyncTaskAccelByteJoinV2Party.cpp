@@ -8,6 +8,7 @@
 #include "Core/AccelByteRegistry.h"
 #include "OnlineSessionInterfaceV2AccelByte.h"
 #include "OnlinePredefinedEventInterfaceAccelByte.h"
+#include "Utilities/AccelByteResponseRecorder.h"
 
 using namespace AccelByte;
 
@@ -63,6 +64,11 @@ void FOnlineAsyncTaskAccelByteJoinV2Party::Initialize()
 
 	OnJoinPartySuccessDelegate = TDelegateUtils<THandler<FAccelByteModelsV2PartySession>>::CreateThreadSafeSelfPtr(this, &FOnlineAsyncTaskAccelByteJoinV2Party::OnJoinPartySuccess);
 	OnJoinPartyErrorDelegate = TDelegateUtils<FErrorHandler>::CreateThreadSafeSelfPtr(this, &FOnlineAsyncTaskAccelByteJoinV2Party::OnJoinPartyError);
+	if (FAccelByteResponseRecorder::Get().Intercept(TEXT("Session.JoinParty"), OnJoinPartySuccessDelegate, OnJoinPartyErrorDelegate))
+	{
+		AB_OSS_ASYNC_TASK_TRACE_END(TEXT("Replaying recorded response"));
+		return;
+	}
 	API_FULL_CHECK_GUARD(Session);
 	Session->JoinParty(SessionId, OnJoinPartySuccessDelegate, OnJoinPartyErrorDelegate);
 
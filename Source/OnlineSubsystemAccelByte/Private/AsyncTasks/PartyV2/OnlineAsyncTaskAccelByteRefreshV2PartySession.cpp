@@ -5,6 +5,7 @@
 #include "OnlineAsyncTaskAccelByteRefreshV2PartySession.h"
 #include "OnlineSessionInterfaceV2AccelByte.h"
 #include "Api/AccelByteSessionApi.h"
+#include "Utilities/AccelByteResponseRecorder.h"
 
 FOnlineAsyncTaskAccelByteRefreshV2PartySession::FOnlineAsyncTaskAccelByteRefreshV2PartySession(FOnlineSubsystemAccelByte* const InABInterface, const FName& InSessionName, const FOnRefreshSessionComplete& InDelegate)
 	: FOnlineAsyncTaskAccelByte(InABInterface)
@@ -43,6 +44,11 @@ void FOnlineAsyncTaskAccelByteRefreshV2PartySession::Initialize()
 
 	OnRefreshPartySessionSuccessDelegate = AccelByte::TDelegateUtils<THandler<FAccelByteModelsV2PartySession>>::CreateThreadSafeSelfPtr(this, &FOnlineAsyncTaskAccelByteRefreshV2PartySession::OnRefreshPartySessionSuccess);
 	OnRefreshPartySessionErrorDelegate = AccelByte::TDelegateUtils<FErrorHandler>::CreateThreadSafeSelfPtr(this, &FOnlineAsyncTaskAccelByteRefreshV2PartySession::OnRefreshPartySessionError);;
+	if (FAccelByteResponseRecorder::Get().Intercept(TEXT("Session.GetPartyDetails"), OnRefreshPartySessionSuccessDelegate, OnRefreshPartySessionErrorDelegate))
+	{
+		AB_OSS_ASYNC_TASK_TRACE_END(TEXT("Replaying recorded response"));
+		return;
+	}
 	API_FULL_CHECK_GUARD(Session);
 	Session->GetPartyDetails(SessionId, OnRefreshPartySessionSuccessDelegate, OnRefreshPartySessionErrorDelegate);
 
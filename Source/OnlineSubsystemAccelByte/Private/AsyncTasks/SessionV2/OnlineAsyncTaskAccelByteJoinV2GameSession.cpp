@@ -6,6 +6,7 @@
 #include "OnlineSessionInterfaceV2AccelByte.h"
 #include "OnlinePredefinedEventInterfaceAccelByte.h"
 #include "OnlineSubsystemAccelByteTypes.h"
+#include "Utilities/AccelByteResponseRecorder.h"
 
 using namespace AccelByte;
 
@@ -61,6 +62,11 @@ void FOnlineAsyncTaskAccelByteJoinV2GameSession::Initialize()
 
 	OnJoinGameSessionSuccessDelegate = TDelegateUtils<THandler<FAccelByteModelsV2GameSession>>::CreateThreadSafeSelfPtr(this, &FOnlineAsyncTaskAccelByteJoinV2GameSession::OnJoinGameSessionSuccess);
 	OnJoinGameSessionErrorDelegate = TDelegateUtils<FErrorHandler>::CreateThreadSafeSelfPtr(this, &FOnlineAsyncTaskAccelByteJoinV2GameSession::OnJoinGameSessionError);
+	if (FAccelByteResponseRecorder::Get().Intercept(TEXT("Session.JoinGameSession"), OnJoinGameSessionSuccessDelegate, OnJoinGameSessionErrorDelegate))
+	{
+		AB_OSS_ASYNC_TASK_TRACE_END(TEXT("Replaying recorded response"));
+		return;
+	}
 	API_FULL_CHECK_GUARD(Session);
 	Session->JoinGameSession(SessionId, OnJoinGameSessionSuccessDelegate, OnJoinGameSessionErrorDelegate);
 
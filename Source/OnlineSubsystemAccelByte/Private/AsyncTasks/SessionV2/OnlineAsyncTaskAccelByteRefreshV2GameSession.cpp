@@ -5,6 +5,7 @@
 #include "OnlineAsyncTaskAccelByteRefreshV2GameSession.h"
 #include "OnlineSessionInterfaceV2AccelByte.h"
 #include "Api/AccelByteSessionApi.h"
+#include "Utilities/AccelByteResponseRecorder.h"
 
 using namespace AccelByte;
 
@@ -57,6 +58,11 @@ void FOnlineAsyncTaskAccelByteRefreshV2GameSession::Initialize()
 	}
 	else
 	{
+		if (FAccelByteResponseRecorder::Get().Intercept(TEXT("Session.GetGameSessionDetails"), OnRefreshGameSessionSuccessDelegate, OnRefreshGameSessionErrorDelegate))
+		{
+			AB_OSS_ASYNC_TASK_TRACE_END(TEXT("Replaying recorded response"));
+			return;
+		}
 		API_FULL_CHECK_GUARD(Session);
 		Session->GetGameSessionDetails(SessionId, OnRefreshGameSessionSuccessDelegate, OnRefreshGameSessionErrorDelegate);
 	}
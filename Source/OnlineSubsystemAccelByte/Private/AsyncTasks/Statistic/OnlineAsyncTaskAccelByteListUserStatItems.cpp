@@ -21,6 +21,7 @@ FOnlineAsyncTaskAccelByteListUserStatItems::FOnlineAsyncTaskAccelByteListUserSta
 	, AdditionalKey(InAdditionalKey)
 	, bAlwaysRequestToService(bInAlwaysRequestToService)
 {
+	RetryPolicy = FAccelByteRetryPolicy::ForService(TEXT("Statistic"));
 }
 
 void FOnlineAsyncTaskAccelByteListUserStatItems::Initialize()
@@ -68,25 +69,35 @@ void FOnlineAsyncTaskAccelByteListUserStatItems::Initialize()
 		}
 		else
 		{
-			// Create delegates for successfully as well as unsuccessfully querying the user's eligibilities
-		 	OnListUserStatItemsSuccessDelegate = TDelegateUtils<THandler<TArray<FAccelByteModelsFetchUser>>>::CreateThreadSafeSelfPtr(this
-		 		, &FOnlineAsyncTaskAccelByteListUserStatItems::OnListUserStatItemsSuccess);
-			OnListUserStatItemsErrorDelegate = TDelegateUtils<FErrorHandler>::CreateThreadSafeSelfPtr(this
-				, &FOnlineAsyncTaskAccelByteListUserStatItems::OnListUserStatItemsError);
-
-			// Send off a request to query users, as well as connect our delegates for doing so
-			API_FULL_CHECK_GUARD(Statistic, ErrorStr);
-			Statistic->ListUserStatItems({}
-				, {}
-				, TEXT("")
-				, OnListUserStatItemsSuccessDelegate
-				, OnListUserStatItemsErrorDelegate);
+			ListUserStatItems();
 		}
 	}
 
 	AB_OSS_ASYNC_TASK_TRACE_END(TEXT(""));
 }
 
+void FOnlineAsyncTaskAccelByteListUserStatItems::ListUserStatItems()
+{
+	AB_OSS_ASYNC_TASK_TRACE_BEGIN(TEXT("List user statistic items, UserId: %s")
+		, *UserId->ToDebugString());
+
+	// Create delegates for successfully as well as unsuccessfully querying the user's eligibilities
+	OnListUserStatItemsSuccessDelegate = TDelegateUtils<THandler<TArray<FAccelByteModelsFetchUser>>>::CreateThreadSafeSelfPtr(this
+		, &FOnlineAsyncTaskAccelByteListUserStatItems::OnListUserStatItemsSuccess);
+	OnListUserStatItemsErrorDelegate = TDelegateUtils<FErrorHandler>::CreateThreadSafeSelfPtr(this
+		, &FOnlineAsyncTaskAccelByteListUserStatItems::OnListUserStatItemsError);
+
+	// Send off a request to query users, as well as connect our delegates for doing so
+	API_FULL_CHECK_GUARD(Statistic, ErrorStr);
+	Statistic->ListUserStatItems({}
+		, {}
+		, TEXT("")
+		, OnListUserStatItemsSuccessDelegate
+		, OnListUserStatItemsErrorDelegate);
+
+	AB_OSS_ASYNC_TASK_TRACE_END(TEXT(""));
+}
+
 void FOnlineAsyncTaskAccelByteListUserStatItems::Finalize()
 {
 	TRY_PIN_SUBSYSTEM();
@@ -174,6 +185,14 @@ void FOnlineAsyncTaskAccelByteListUserStatItems::OnListUserStatItemsSuccess(TArr
 void FOnlineAsyncTaskAccelByteListUserStatItems::OnListUserStatItemsError(int32 ErrorCode
 	, FString const& ErrorMessage)
 {
+	if (TryRetryRequest(ErrorCode, [this]() { ListUserStatItems(); }))
+	{
+		UE_LOG_AB(Log, TEXT("Retrying to get list user statistic items. Error Code: %d; Error Message: %s")
+			, ErrorCode
+			, *ErrorMessage);
+		return;
+	}
+
 	ErrorStr = TEXT("request-failed-list-users-stat-items-error");
 	UE_LOG_AB(Warning, TEXT("Failed to get list user list statistic items! Error Code: %d; Error Message: %s")
 		, ErrorCode
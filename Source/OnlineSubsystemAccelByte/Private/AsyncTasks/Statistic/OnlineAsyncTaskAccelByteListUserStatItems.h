@@ -37,6 +37,9 @@ protected:
 
 private:
 
+	/** Send the request to list the statistic items of the user, again on retry */
+	void ListUserStatItems();
+
 	/**
 	 * Delegate handler for when accept users succeed
 	 */
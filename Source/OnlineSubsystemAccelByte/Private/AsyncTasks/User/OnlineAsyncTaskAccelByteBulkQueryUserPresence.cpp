@@ -19,6 +19,8 @@ FOnlineAsyncTaskAccelByteBulkQueryUserPresence::FOnlineAsyncTaskAccelByteBulkQue
 	{
 		TargetUserIds.Emplace(FUniqueNetIdAccelByteUser::CastChecked(InTargetUserId));
 	}
+
+	RetryPolicy = FAccelByteRetryPolicy::ForService(TEXT("Lobby"));
 }
 
 void FOnlineAsyncTaskAccelByteBulkQueryUserPresence::Initialize() 
@@ -42,10 +44,20 @@ void FOnlineAsyncTaskAccelByteBulkQueryUserPresence::Initialize()
 	}
 
 	// Send off the actual request to get user presence
+	QueryUserPresence(UsersToQuery);
+
+	AB_OSS_ASYNC_TASK_TRACE_END(TEXT(""));
+}
+
+void FOnlineAsyncTaskAccelByteBulkQueryUserPresence::QueryUserPresence(const TArray<FString>& UserIds)
+{
+	AB_OSS_ASYNC_TASK_TRACE_BEGIN(TEXT("User amount: %d"), UserIds.Num());
+
+	LastQueriedUserIds = UserIds;
 	THandler<FAccelByteModelsBulkUserStatusNotif> OnQueryUserPresenceSuccessDelegate = TDelegateUtils<THandler<FAccelByteModelsBulkUserStatusNotif>>::CreateThreadSafeSelfPtr(this, &FOnlineAsyncTaskAccelByteBulkQueryUserPresence::OnQueryUserPresenceSuccess);
 	FErrorHandler OnQueryUserPresenceErrorDelegate = TDelegateUtils<FErrorHandler>::CreateThreadSafeSelfPtr(this, &FOnlineAsyncTaskAccelByteBulkQueryUserPresence::OnQueryUserPresenceError);
 	API_FULL_CHECK_GUARD(Lobby);
-	Lobby->BulkGetUserPresenceV2(UsersToQuery, OnQueryUserPresenceSuccessDelegate, OnQueryUserPresenceErrorDelegate, false);
+	Lobby->BulkGetUserPresenceV2(UserIds, OnQueryUserPresenceSuccessDelegate, OnQueryUserPresenceErrorDelegate, false);
 
 	AB_OSS_ASYNC_TASK_TRACE_END(TEXT(""));
 }
@@ -82,6 +94,12 @@ void FOnlineAsyncTaskAccelByteBulkQueryUserPresence::TriggerDelegates()
 
 void FOnlineAsyncTaskAccelByteBulkQueryUserPresence::OnQueryUserPresenceError(int32 ErrorCode, const FString& ErrorMessage) 
 {
+	if (TryRetryRequest(ErrorCode, [this]() { QueryUserPresence(LastQueriedUserIds); }))
+	{
+		UE_LOG_AB(Log, TEXT("Retrying to query presence for users. Error code: %d; Error message: %s"), ErrorCode, *ErrorMessage);
+		return;
+	}
+
 	UE_LOG_AB(Warning, TEXT("Failed to query presence for user! Error code: %d; Error message: %s"), ErrorCode, *ErrorMessage);
 	CompleteTask(EAccelByteAsyncTaskCompleteState::RequestFailed);
 }
@@ -113,10 +131,7 @@ void FOnlineAsyncTaskAccelByteBulkQueryUserPresence::OnQueryUserPresenceSuccess(
 
 	if (Result.NotProcessed.Num() > 0)
 	{
-		THandler<FAccelByteModelsBulkUserStatusNotif> OnQueryUserPresenceSuccessDelegate = TDelegateUtils<THandler<FAccelByteModelsBulkUserStatusNotif>>::CreateThreadSafeSelfPtr(this, &FOnlineAsyncTaskAccelByteBulkQueryUserPresence::OnQueryUserPresenceSuccess);
-		FErrorHandler OnQueryUserPresenceErrorDelegate = TDelegateUtils<FErrorHandler>::CreateThreadSafeSelfPtr(this, &FOnlineAsyncTaskAccelByteBulkQueryUserPresence::OnQueryUserPresenceError);
-		API_FULL_CHECK_GUARD(Lobby);
-		Lobby->BulkGetUserPresenceV2(Result.NotProcessed, OnQueryUserPresenceSuccessDelegate, OnQueryUserPresenceErrorDelegate, false);
+		QueryUserPresence(Result.NotProcessed);
 	}
 	else
 	{
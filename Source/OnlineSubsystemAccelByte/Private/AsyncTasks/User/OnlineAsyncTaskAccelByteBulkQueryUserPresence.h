@@ -37,6 +37,12 @@ private:
 	/** Map of user IDs with presence we bulk queried */
 	TMap<FString, TSharedRef<FOnlineUserPresenceAccelByte>> PresenceResult;
 
+	/** AccelByte IDs sent with the last presence request, sent again if it is retried */
+	TArray<FString> LastQueriedUserIds;
+
+	/** Send a request to get the presence of the given users */
+	void QueryUserPresence(const TArray<FString>& UserIds);
+
 	/** Delegate handler for when the QueryUserPresence call fails */
 	void OnQueryUserPresenceError(int32 ErrorCode, const FString& ErrorMessage);
 
@@ -15,6 +15,7 @@ FOnlineAsyncTaskAccelByteGetUserPlatformLinks::FOnlineAsyncTaskAccelByteGetUserP
 	: FOnlineAsyncTaskAccelByte(InABSubsystem)
 {
 	LocalUserNum = InLocalUserNum;
+	RetryPolicy = FAccelByteRetryPolicy::ForService(TEXT("IAM"));
 }
 
 void FOnlineAsyncTaskAccelByteGetUserPlatformLinks::Initialize()
@@ -23,6 +24,14 @@ void FOnlineAsyncTaskAccelByteGetUserPlatformLinks::Initialize()
 
 	AB_OSS_ASYNC_TASK_TRACE_BEGIN(TEXT("UserId: %s, LocalUserNum: %d"), *UserId->ToDebugString(), LocalUserNum);
 
+	GetUserPlatformLinks();
+
+	AB_OSS_ASYNC_TASK_TRACE_END(TEXT(""));	
+}
+
+void FOnlineAsyncTaskAccelByteGetUserPlatformLinks::GetUserPlatformLinks()
+{
+	AB_OSS_ASYNC_TASK_TRACE_BEGIN(TEXT("UserId: %s"), *UserId->ToDebugString());
 
 	OnSuccessDelegate = TDelegateUtils<THandler<FPagedPlatformLinks>>::CreateThreadSafeSelfPtr(this, &FOnlineAsyncTaskAccelByteGetUserPlatformLinks::OnGetUserPlatformLinksSuccess);
 	OnErrorDelegate = TDelegateUtils<FErrorHandler>::CreateThreadSafeSelfPtr(this, &FOnlineAsyncTaskAccelByteGetUserPlatformLinks::OnGetUserPlatformLinksError);
@@ -30,7 +39,7 @@ void FOnlineAsyncTaskAccelByteGetUserPlatformLinks::Initialize()
 	API_FULL_CHECK_GUARD(User, ErrorString);
 	User->GetPlatformLinks(OnSuccessDelegate, OnErrorDelegate);
 
-	AB_OSS_ASYNC_TASK_TRACE_END(TEXT(""));	
+	AB_OSS_ASYNC_TASK_TRACE_END(TEXT(""));
 }
 
 void FOnlineAsyncTaskAccelByteGetUserPlatformLinks::TriggerDelegates()
@@ -106,6 +115,13 @@ void FOnlineAsyncTaskAccelByteGetUserPlatformLinks::OnGetUserPlatformLinksSucces
 void FOnlineAsyncTaskAccelByteGetUserPlatformLinks::OnGetUserPlatformLinksError(int32 ErrorCode, const FString& ErrorMessage)
 {
 	AB_OSS_ASYNC_TASK_TRACE_BEGIN(TEXT(""));
+
+	if (TryRetryRequest(ErrorCode, [this]() { GetUserPlatformLinks(); }))
+	{
+		AB_OSS_ASYNC_TASK_TRACE_END(TEXT("Retrying to get user platform links, Error code: %d"), ErrorCode);
+		return;
+	}
+
 	HttpStatus = ErrorCode;
 	ErrorString = ErrorMessage;
 	CompleteTask(EAccelByteAsyncTaskCompleteState::RequestFailed);
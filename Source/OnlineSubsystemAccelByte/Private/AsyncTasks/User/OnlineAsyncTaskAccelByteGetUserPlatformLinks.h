@@ -27,6 +27,8 @@ protected:
 	}
 
 private:
+	void GetUserPlatformLinks();
+
 	void OnGetUserPlatformLinksSuccess(const FPagedPlatformLinks& Result);
 	THandler<FPagedPlatformLinks> OnSuccessDelegate;
 
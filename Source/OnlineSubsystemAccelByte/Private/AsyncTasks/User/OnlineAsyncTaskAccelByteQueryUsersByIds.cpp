@@ -19,12 +19,14 @@ FOnlineAsyncTaskAccelByteQueryUsersByIds::FOnlineAsyncTaskAccelByteQueryUsersByI
 	, int32 InLocalUserNum
 	, const TArray<FString>& AccelByteIds
 	, bool InBIsImportant
-	, const FOnQueryUsersComplete& InDelegate )
+	, const FOnQueryUsersComplete& InDelegate
+	, const FOnQueryUsersPartialResults& InPartialDelegate )
 	: FOnlineAsyncTaskAccelByte(InABSubsystem, true)
 	, PlatformType(ACCELBYTE_QUERY_TYPE)
 	, UserIds(AccelByteIds)
 	, bIsImportant(InBIsImportant)
 	, Delegate(InDelegate)
+	, PartialDelegate(InPartialDelegate)
 {
 	LocalUserNum = InLocalUserNum;
 }
@@ -35,12 +37,14 @@ FOnlineAsyncTaskAccelByteQueryUsersByIds::FOnlineAsyncTaskAccelByteQueryUsersByI
 	, const FString InPlatformType
 	, const TArray<FString>& PlatformIds
 	, bool InBIsImportant
-	, const FOnQueryUsersComplete& InDelegate )
+	, const FOnQueryUsersComplete& InDelegate
+	, const FOnQueryUsersPartialResults& InPartialDelegate )
 	: FOnlineAsyncTaskAccelByte(InABSubsystem, true)
 	, PlatformType(InPlatformType)
 	, UserIds(PlatformIds)
 	, bIsImportant(InBIsImportant)
 	, Delegate(InDelegate)
+	, PartialDelegate(InPartialDelegate)
 {
 	LocalUserNum = InLocalUserNum;
 }
@@ -50,12 +54,14 @@ FOnlineAsyncTaskAccelByteQueryUsersByIds::FOnlineAsyncTaskAccelByteQueryUsersByI
 	, const FUniqueNetId& InUserId
 	, const TArray<FString>& AccelByteIds
 	, bool InBIsImportant
-	, const FOnQueryUsersComplete& InDelegate )
+	, const FOnQueryUsersComplete& InDelegate
+	, const FOnQueryUsersPartialResults& InPartialDelegate )
 	: FOnlineAsyncTaskAccelByte(InABSubsystem, true)
 	, PlatformType(ACCELBYTE_QUERY_TYPE)
 	, UserIds(AccelByteIds)
 	, bIsImportant(InBIsImportant)
 	, Delegate(InDelegate)
+	, PartialDelegate(InPartialDelegate)
 {
 	UserId = FUniqueNetIdAccelByteUser::CastChecked(InUserId);
 }
@@ -66,12 +72,14 @@ FOnlineAsyncTaskAccelByteQueryUsersByIds::FOnlineAsyncTaskAccelByteQueryUsersByI
 	, const FString InPlatformType
 	, const TArray<FString>& PlatformIds
 	, bool InBIsImportant
-	, const FOnQueryUsersComplete& InDelegate )
+	, const FOnQueryUsersComplete& InDelegate
+	, const FOnQueryUsersPartialResults& InPartialDelegate )
 	: FOnlineAsyncTaskAccelByte(InABSubsystem, true)
 	, PlatformType(InPlatformType)
 	, UserIds(PlatformIds)
 	, bIsImportant(InBIsImportant)
 	, Delegate(InDelegate)
+	, PartialDelegate(InPartialDelegate)
 {
 	UserId = FUniqueNetIdAccelByteUser::CastChecked(InUserId);
 }
@@ -88,12 +96,20 @@ void FOnlineAsyncTaskAccelByteQueryUsersByIds::BulkGetUserByOtherPlatformUserIds
 		API_FULL_CHECK_GUARD(User);
 		User->BulkGetUserByOtherPlatformUserIdsV4(ABPlatformType, InUserIds, OnBulkGetUserSuccess, OnBulkGetUserError);
 	}
+	else
+	{
+		// Otherwise the chunk would stay in flight and the task would only end by timing out
+		UE_LOG_AB(Warning, TEXT("Could not query for AccelByte IDs from platform IDs as platform type %s is not supported!"), *PlatformType);
+		CompleteTask(EAccelByteAsyncTaskCompleteState::InvalidState);
+	}
 }
 
 void FOnlineAsyncTaskAccelByteQueryUsersByIds::Initialize()
 {
 	Super::Initialize();
 
+	TRY_PIN_SUBSYSTEM();
+
 	AB_OSS_ASYNC_TASK_TRACE_BEGIN(TEXT(""));
 
 	if (UserIds.Num() <= 0)
@@ -103,7 +119,11 @@ void FOnlineAsyncTaskAccelByteQueryUsersByIds::Initialize()
 		return;
 	}
 
-	FAccelByteUtilities::SplitArraysToNum(UserIds, MaximumQueryLimit, SplitUserIds);
+	const FOnlineUserCacheAccelBytePtr UserCache = SubsystemPin->GetUserCache();
+	if (UserCache.IsValid())
+	{
+		MaxInFlightRequestNum = UserCache->GetUserQueryMaxConcurrentRequests();
+	}
 
 	// If these are already AccelByte IDs, then we just want to run a bulk query for the users
 	if (PlatformType == ACCELBYTE_QUERY_TYPE)
@@ -112,93 +132,163 @@ void FOnlineAsyncTaskAccelByteQueryUsersByIds::Initialize()
 	}
 	else
 	{
-		BulkGetUserByOtherPlatformUserIds(SplitUserIds[LastSplitQueryIndex.GetValue()]);
+		FAccelByteUtilities::SplitArraysToNum(UserIds, MaximumQueryLimit, SplitUserIds);
 	}
 
+	DispatchChunkRequests();
+
 	AB_OSS_ASYNC_TASK_TRACE_END(TEXT(""));
 }
 
-void FOnlineAsyncTaskAccelByteQueryUsersByIds::Tick()
+void FOnlineAsyncTaskAccelByteQueryUsersByIds::TriggerDelegates()
 {
-	Super::Tick();
+	AB_OSS_ASYNC_TASK_TRACE_BEGIN(TEXT("bWasSuccessful: %s"), LOG_BOOL_FORMAT(bWasSuccessful));
+
+	// Partial results still waiting for the next tick go out first, so that they never arrive after completion
+	FlushPartialResults();
+	bHasTriggeredDelegates = true;
 
-	if (bHasQueriedBasicUserInfo && bHasQueriedUserPlatformInfo)
+	// Concatenate array of queried and cached users to return to the delegate
+	TArray<FAccelByteUserInfoRef> ReturnUsers;
+	if (bWasSuccessful)
 	{
-		CompleteTask(EAccelByteAsyncTaskCompleteState::Success);
+		FScopeLock ScopeLock(&ChunkLock);
+
+		// Only append queried and cached arrays on success, a failed chunk fails the whole query
+		if(UsersQueried.Num() > 0)
+		{
+			ReturnUsers.Append(UsersQueried);
+		}
+
+		if(UsersCached.Num() > 0)
+		{
+			ReturnUsers.Append(UsersCached);
+		}
 	}
+
+	// Fire off the delegate
+	Delegate.ExecuteIfBound(bWasSuccessful, ReturnUsers);
+
+	AB_OSS_ASYNC_TASK_TRACE_END(TEXT(""));
 }
 
-void FOnlineAsyncTaskAccelByteQueryUsersByIds::Finalize()
+void FOnlineAsyncTaskAccelByteQueryUsersByIds::DispatchChunkRequests()
 {
-	TRY_PIN_SUBSYSTEM();
+	TArray<TArray<FString>> PlatformIdChunks;
+	TArray<TArray<FString>> AccelByteIdChunks;
+	{
+		FScopeLock ScopeLock(&ChunkLock);
 
-	AB_OSS_ASYNC_TASK_TRACE_BEGIN(TEXT("bWasSuccessful: %s"), LOG_BOOL_FORMAT(bWasSuccessful));
+		// Failed or timed out, whatever is still queued is not needed anymore
+		if (bIsComplete)
+		{
+			return;
+		}
 
-	if (UsersQueried.Num() > 0)
-	{
-		FOnlineUserCacheAccelBytePtr UserCache = SubsystemPin->GetUserCache();
-		if (UserCache.IsValid())
+		while (InFlightRequestNum < MaxInFlightRequestNum)
 		{
-			UserCache->AddUsersToCache(UsersQueried);
+			if (AccelByteIdChunksToQuery.Num() > 0)
+			{
+				AccelByteIdChunks.Add(AccelByteIdChunksToQuery[0]);
+				AccelByteIdChunksToQuery.RemoveAt(0);
+			}
+			else if (NextPlatformChunkIndex < SplitUserIds.Num())
+			{
+				PlatformIdChunks.Add(SplitUserIds[NextPlatformChunkIndex++]);
+			}
+			else
+			{
+				break;
+			}
+			InFlightRequestNum++;
+		}
+
+		// Completed under the lock, so that only the last chunk to respond completes the task
+		if (InFlightRequestNum == 0)
+		{
+			CompleteTask(EAccelByteAsyncTaskCompleteState::Success);
+			return;
 		}
 	}
 
-	AB_OSS_ASYNC_TASK_TRACE_END(TEXT(""));
+	// Send outside of the lock, as a request may fail right away and call back into this task
+	for (const TArray<FString>& AccelByteIds : AccelByteIdChunks)
+	{
+		GetUserOtherPlatformBasicPublicInfo(AccelByteIds);
+	}
+	for (const TArray<FString>& PlatformIds : PlatformIdChunks)
+	{
+		BulkGetUserByOtherPlatformUserIds(PlatformIds);
+	}
 }
 
-void FOnlineAsyncTaskAccelByteQueryUsersByIds::TriggerDelegates()
+void FOnlineAsyncTaskAccelByteQueryUsersByIds::ReportPartialResults(const TArray<FAccelByteUserInfoRef>& Users)
 {
-	AB_OSS_ASYNC_TASK_TRACE_BEGIN(TEXT("bWasSuccessful: %s"), LOG_BOOL_FORMAT(bWasSuccessful));
+	if (!PartialDelegate.IsBound() || Users.Num() <= 0)
+	{
+		return;
+	}
+
+	TRY_PIN_SUBSYSTEM();
 
-	// Concatenate array of queried and cached users to return to the delegate
-	TArray<FAccelByteUserInfoRef> ReturnUsers;
-	
-	// Only append queried and cached arrays on success
-	if(UsersQueried.Num() > 0)
 	{
-		ReturnUsers.Append(UsersQueried);
+		FScopeLock ScopeLock(&ChunkLock);
+		PartialUsersToReport.Append(Users);
 	}
 
-	if(UsersCached.Num() > 0)
+	// Chunks complete on whichever thread the SDK calls back on, callers expect their delegates on the game thread
+	const FSimpleDelegate OnFlush = TDelegateUtils<FSimpleDelegate>::CreateThreadSafeSelfPtr(this, &FOnlineAsyncTaskAccelByteQueryUsersByIds::FlushPartialResults);
+	SubsystemPin->ExecuteNextTick([OnFlush]()
 	{
-		ReturnUsers.Append(UsersCached);
+		OnFlush.ExecuteIfBound();
+	});
+}
+
+void FOnlineAsyncTaskAccelByteQueryUsersByIds::FlushPartialResults()
+{
+	if (bHasTriggeredDelegates)
+	{
+		return;
 	}
 
-	// Fire off the delegate
-	Delegate.ExecuteIfBound(bWasSuccessful, ReturnUsers);
+	TArray<FAccelByteUserInfoRef> Users;
+	{
+		FScopeLock ScopeLock(&ChunkLock);
+		Users = MoveTemp(PartialUsersToReport);
+		PartialUsersToReport.Reset();
+	}
 
-	AB_OSS_ASYNC_TASK_TRACE_END(TEXT(""));
+	if (Users.Num() > 0)
+	{
+		PartialDelegate.ExecuteIfBound(Users);
+	}
 }
 
 void FOnlineAsyncTaskAccelByteQueryUsersByIds::OnBulkQueryPlatformIdMappingsSuccess(const FBulkPlatformUserIdResponse& Result)
 {
 	AB_OSS_ASYNC_TASK_TRACE_BEGIN(TEXT("Mappings found: %d"), Result.UserIdPlatforms.Num());
 
-	QueriedUserMapByPlatformUserIds.Append(Result.UserIdPlatforms);
-	LastSplitQueryIndex.Increment();
 	SetLastUpdateTimeToCurrentTime();
-	
-	if(LastSplitQueryIndex.GetValue() < SplitUserIds.Num())
+
+	TArray<FString> AccelByteIds;
+	for (const FPlatformUserIdMap& UserIdMapping : Result.UserIdPlatforms)
 	{
-		BulkGetUserByOtherPlatformUserIds(SplitUserIds[LastSplitQueryIndex.GetValue()]);
-		AB_OSS_ASYNC_TASK_TRACE_END(TEXT("Querying next platform user Ids"));
-		return;
+		AccelByteIds.Add(UserIdMapping.UserId);
 	}
 
-	if (QueriedUserMapByPlatformUserIds.Num() > 0)
+	// Get the basic information of this chunk right away instead of waiting for the mappings of the other chunks
+	if (AccelByteIds.Num() > 0)
 	{
-		TArray<FString> AccelByteIds;
-		for (const FPlatformUserIdMap& UserIdMapping : QueriedUserMapByPlatformUserIds)
-		{
-			AccelByteIds.Add(UserIdMapping.UserId);
-		}
-
 		GetBasicUserInfo(AccelByteIds);
 	}
-	else
+
+	// Only leave the in-flight count once the follow-up chunks are queued, or the task could be seen as done
 	{
-		CompleteTask(EAccelByteAsyncTaskCompleteState::Success);
+		FScopeLock ScopeLock(&ChunkLock);
+		QueriedUserMapByPlatformUserIds.Append(Result.UserIdPlatforms);
+		InFlightRequestNum--;
 	}
+	DispatchChunkRequests();
 
 	AB_OSS_ASYNC_TASK_TRACE_END(TEXT(""));
 }
@@ -215,13 +305,6 @@ void FOnlineAsyncTaskAccelByteQueryUsersByIds::GetBasicUserInfo(const TArray<FSt
 
 	AB_OSS_ASYNC_TASK_TRACE_BEGIN(TEXT("IDs to query: %d"), AccelByteIds.Num());
 
-	if (AccelByteIds.Num() <= 0)
-	{
-		AB_OSS_ASYNC_TASK_TRACE_END_VERBOSITY(Warning, TEXT("Cannot query users as our array of user IDs is blank!"));
-		CompleteTask(EAccelByteAsyncTaskCompleteState::InvalidState);
-		return;
-	}
-
 	const FOnlineUserCacheAccelBytePtr UserCache = SubsystemPin->GetUserCache();
 	if (!UserCache.IsValid())
 	{
@@ -232,37 +315,27 @@ void FOnlineAsyncTaskAccelByteQueryUsersByIds::GetBasicUserInfo(const TArray<FSt
 
 	// Get users that we already have cached and users that we need to query, filters from the AccelByteIds array
 	TArray<FString> UserIdsToQueryArray;
-	UserCache->GetQueryAndCacheArrays(AccelByteIds, UserIdsToQueryArray, UsersCached);
+	TArray<FAccelByteUserInfoRef> ChunkUsersCached;
+	UserCache->GetQueryAndCacheArrays(AccelByteIds, UserIdsToQueryArray, ChunkUsersCached);
 
-	// Add userId that is not in the cache to the queue
-	for (const auto& AccelbyteUserId : UserIdsToQueryArray)
-	{
-		UsersToQuery.Enqueue(AccelbyteUserId);
-	}
+	TArray<TArray<FString>> SplitUserIdsToQuery;
+	FAccelByteUtilities::SplitArraysToNum(UserIdsToQueryArray, MaximumQueryLimit, SplitUserIdsToQuery);
 
-	// This means these users are already in the cache, so we can just skip the query and successfully complete
-	if (UsersToQuery.IsEmpty())
 	{
-		CompleteTask(EAccelByteAsyncTaskCompleteState::Success);
-		return;
+		FScopeLock ScopeLock(&ChunkLock);
+		UsersCached.Append(ChunkUsersCached);
+		AccelByteIdChunksToQuery.Append(SplitUserIdsToQuery);
 	}
 
-	GetUserOtherPlatformBasicPublicInfo();
+	ReportPartialResults(ChunkUsersCached);
 
 	AB_OSS_ASYNC_TASK_TRACE_END(TEXT(""));
 }
 
-void FOnlineAsyncTaskAccelByteQueryUsersByIds::GetUserOtherPlatformBasicPublicInfo()
+void FOnlineAsyncTaskAccelByteQueryUsersByIds::GetUserOtherPlatformBasicPublicInfo(const TArray<FString>& AccelByteIds)
 {
 	FPlatformAccountInfoRequest Request;
-
-	// Add user id to query until queue empty or limit reached
-	while (!UsersToQuery.IsEmpty() && Request.UserIds.Num() < MaximumQueryLimit)
-	{
-		FString AccelbyteUserId;
-		UsersToQuery.Dequeue(AccelbyteUserId);
-		Request.UserIds.Emplace(AccelbyteUserId);
-	}
+	Request.UserIds = AccelByteIds;
 
 	const THandler<FAccountUserPlatformInfosResponse> OnGetUserPlatformInfoSuccessDelegate = TDelegateUtils<THandler<FAccountUserPlatformInfosResponse>>::CreateThreadSafeSelfPtr(this, &FOnlineAsyncTaskAccelByteQueryUsersByIds::OnGetUserOtherPlatformBasicPublicInfoSuccess);
 	const FErrorHandler OnGetUserPlatformInfoErrorDelegate = TDelegateUtils<FErrorHandler>::CreateThreadSafeSelfPtr(this, &FOnlineAsyncTaskAccelByteQueryUsersByIds::OnGetUserOtherPlatformBasicPublicInfoError);
@@ -276,6 +349,8 @@ void FOnlineAsyncTaskAccelByteQueryUsersByIds::OnGetUserOtherPlatformBasicPublic
 
 	AB_OSS_ASYNC_TASK_TRACE_BEGIN(TEXT("User information received: %d"), Result.Data.Num());
 
+	SetLastUpdateTimeToCurrentTime();
+
 	const FOnlineIdentityAccelBytePtr IdentityInterface = StaticCastSharedPtr<FOnlineIdentityAccelByte>(SubsystemPin->GetIdentityInterface());
 	if (!IdentityInterface.IsValid())
 	{
@@ -308,6 +383,8 @@ void FOnlineAsyncTaskAccelByteQueryUsersByIds::OnGetUserOtherPlatformBasicPublic
 		return;
 	}
 
+	TArray<FAccelByteUserInfoRef> ChunkUsersQueried;
+	TArray<TSharedRef<const FUniqueNetId>> PlatformIdsToQuery;
 	for (const FAccountUserPlatformData& BasicInfo : Result.Data)
 	{
 		// Construct a composite ID for this user
@@ -316,15 +393,20 @@ void FOnlineAsyncTaskAccelByteQueryUsersByIds::OnGetUserOtherPlatformBasicPublic
 
 		ExtractPlatformDataFromBasicUserInfo(BasicInfo, CompositeId);
 
-		// Set up our user info struct with basic data, get existing userInfo if not exist, create new
-		FAccelByteUserInfoPtr User = ConstCastSharedPtr<FAccelByteUserInfo>(UserCache->GetUser(CompositeId));
-		if (!User.IsValid())
+		// Set up a new user info struct with basic data, starting from the cached one if any. Cached instances are read
+		// without any lock, so they are never modified, this one replaces it once added to the cache.
+		const FAccelByteUserInfoRef User = MakeShared<FAccelByteUserInfo, ESPMode::ThreadSafe>();
+		const TSharedPtr<const FAccelByteUserInfo, ESPMode::ThreadSafe> CachedUser = UserCache->GetUser(CompositeId);
+		if (CachedUser.IsValid())
+		{
+			User->CopyValue(*CachedUser);
+		}
+		else
 		{
-			User = MakeShared<FAccelByteUserInfo, ESPMode::ThreadSafe>();
 			User->Id = FUniqueNetIdAccelByteUser::Create(CompositeId);
 		}
 		User->bIsImportant = bIsImportant;
-		User->LastAccessedTimeInSeconds = FPlatformTime::Seconds();
+		User->LastAccessedTimeInSeconds.store(FPlatformTime::Seconds(), std::memory_order_relaxed);
 		User->PublisherAvatarUrl = BasicInfo.AvatarUrl;
 		User->UniqueDisplayName = BasicInfo.UniqueDisplayName;
 		User->LastUpdatedTime = FDateTime::UtcNow();
@@ -349,7 +431,7 @@ void FOnlineAsyncTaskAccelByteQueryUsersByIds::OnGetUserOtherPlatformBasicPublic
 		}
 
 		// Add the user to our successful queries
-		UsersQueried.Add(User.ToSharedRef());
+		ChunkUsersQueried.Add(User);
 
 		// Also query the user on the native platform, if we have their platform information
 		FUniqueNetIdPtr PlatformUniqueId = User->Id->GetPlatformUniqueId();
@@ -359,25 +441,23 @@ void FOnlineAsyncTaskAccelByteQueryUsersByIds::OnGetUserOtherPlatformBasicPublic
 		}
 	}
 
-	if (UsersToQuery.IsEmpty())
-	{
-		bHasQueriedBasicUserInfo = true;
+	// Cache the users of this chunk right away, so that they can be looked up before the other chunks complete
+	UserCache->AddUsersToCache(ChunkUsersQueried);
 
-		if (PlatformIdsToQuery.Num() > 0)
-		{
-			QueryUsersOnNativePlatform(PlatformIdsToQuery);
-		}
-		else
-		{
-			// Just set this flag to true so that we aren't waiting on it
-			bHasQueriedUserPlatformInfo = true;
-		}
+	{
+		FScopeLock ScopeLock(&ChunkLock);
+		UsersQueried.Append(ChunkUsersQueried);
+		InFlightRequestNum--;
 	}
-	else
+
+	if (PlatformIdsToQuery.Num() > 0)
 	{
-		GetUserOtherPlatformBasicPublicInfo();
+		QueryUsersOnNativePlatform(PlatformIdsToQuery);
 	}
 
+	ReportPartialResults(ChunkUsersQueried);
+	DispatchChunkRequests();
+
 	AB_OSS_ASYNC_TASK_TRACE_END(TEXT(""));
 }
 
@@ -395,7 +475,6 @@ void FOnlineAsyncTaskAccelByteQueryUsersByIds::QueryUsersOnNativePlatform(const
 	if (NativeSubsystem == nullptr)
 	{
 		UE_LOG_AB(Warning, TEXT("Unable to retrieve the native online subsystem! Skipping native platform query."));
-		bHasQueriedUserPlatformInfo = true;
 		return;
 	}
 
@@ -403,14 +482,12 @@ void FOnlineAsyncTaskAccelByteQueryUsersByIds::QueryUsersOnNativePlatform(const
 	if (!NativeUserInterface.IsValid())
 	{
 		UE_LOG_AB(Warning, TEXT("The native platform either does not have UserInterface implemented or is not supported! Skipping native platform query."));
-		bHasQueriedUserPlatformInfo = true;
 		return;
 	}
 
 	// Make a request to the native platform to query all of these IDs that we have retrieved, no need to get the results
 	// of these so this can just be a fire and forget
 	NativeUserInterface->QueryUserInfo(LocalUserNum, PlatformUniqueIds);
-	bHasQueriedUserPlatformInfo = true;
 }
 
 void FOnlineAsyncTaskAccelByteQueryUsersByIds::ExtractPlatformDataFromBasicUserInfo(const FAccountUserPlatformData& BasicInfo, FAccelByteUniqueIdComposite& CompositeId)
@@ -11,6 +11,15 @@
 
 /**
  * Task to query a bulk of users by AccelByte or platform IDs, will add these users to the user cache.
+ *
+ * IDs are split in chunks of the bulk query limit, and up to UserQueryMaxConcurrentRequests chunk requests are in
+ * flight at once. Stages are pipelined per chunk: as soon as the AccelByte IDs of a chunk of platform IDs are known,
+ * their basic information is requested, and as soon as that arrives the users are cached, queried on the native
+ * platform and given to the partial results delegate, without waiting for the other chunks.
+ *
+ * A chunk that fails fails the whole query: no further chunk is sent, and the completion delegate fires unsuccessful
+ * with no users. Users of the chunks that completed before stay cached, and may already have been given to the partial
+ * results delegate.
  */
 class FOnlineAsyncTaskAccelByteQueryUsersByIds
 	: public FOnlineAsyncTaskAccelByte
@@ -20,26 +29,24 @@ public:
 	/**
 	 * Queries a bulk of AccelByte IDs using a local user index
 	 */
-	FOnlineAsyncTaskAccelByteQueryUsersByIds(FOnlineSubsystemAccelByte* const InABSubsystem, int32 InLocalUserNum, const TArray<FString>& AccelByteIds, bool InBIsImportant, const FOnQueryUsersComplete& InDelegate);
+	FOnlineAsyncTaskAccelByteQueryUsersByIds(FOnlineSubsystemAccelByte* const InABSubsystem, int32 InLocalUserNum, const TArray<FString>& AccelByteIds, bool InBIsImportant, const FOnQueryUsersComplete& InDelegate, const FOnQueryUsersPartialResults& InPartialDelegate = FOnQueryUsersPartialResults());
 
 	/**
 	 * Queries a bulk of platform IDs to attempt to get AccelByte accounts using a local user index
 	 */
-	FOnlineAsyncTaskAccelByteQueryUsersByIds(FOnlineSubsystemAccelByte* const InABSubsystem, int32 InLocalUserNum, const FString InPlatformType, const TArray<FString>& PlatformIds, bool InBIsImportant, const FOnQueryUsersComplete& InDelegate);
+	FOnlineAsyncTaskAccelByteQueryUsersByIds(FOnlineSubsystemAccelByte* const InABSubsystem, int32 InLocalUserNum, const FString InPlatformType, const TArray<FString>& PlatformIds, bool InBIsImportant, const FOnQueryUsersComplete& InDelegate, const FOnQueryUsersPartialResults& InPartialDelegate = FOnQueryUsersPartialResults());
 
 	/**
 	 * Queries a bulk of AccelByte IDs using a user ID
 	 */
-	FOnlineAsyncTaskAccelByteQueryUsersByIds(FOnlineSubsystemAccelByte* const InABSubsystem, const FUniqueNetId& InUserId, const TArray<FString>& AccelByteIds, bool InBIsImportant, const FOnQueryUsersComplete& InDelegate);
+	FOnlineAsyncTaskAccelByteQueryUsersByIds(FOnlineSubsystemAccelByte* const InABSubsystem, const FUniqueNetId& InUserId, const TArray<FString>& AccelByteIds, bool InBIsImportant, const FOnQueryUsersComplete& InDelegate, const FOnQueryUsersPartialResults& InPartialDelegate = FOnQueryUsersPartialResults());
 
 	/**
 	 * Queries a bulk of platform IDs to attempt to get AccelByte accounts using a user ID
 	 */
-	FOnlineAsyncTaskAccelByteQueryUsersByIds(FOnlineSubsystemAccelByte* const InABSubsystem, const FUniqueNetId& InUserId, const FString InPlatformType, const TArray<FString>& PlatformIds, bool InBIsImportant, const FOnQueryUsersComplete& InDelegate);
+	FOnlineAsyncTaskAccelByteQueryUsersByIds(FOnlineSubsystemAccelByte* const InABSubsystem, const FUniqueNetId& InUserId, const FString InPlatformType, const TArray<FString>& PlatformIds, bool InBIsImportant, const FOnQueryUsersComplete& InDelegate, const FOnQueryUsersPartialResults& InPartialDelegate = FOnQueryUsersPartialResults());
 
 	virtual void Initialize() override;
-	virtual void Tick() override;
-	virtual void Finalize() override;
 	virtual void TriggerDelegates() override;
 
 protected:
@@ -73,9 +80,29 @@ private:
 	TArray<FPlatformUserIdMap> QueriedUserMapByPlatformUserIds;
 
 	/**
-	 * Index of the split user IDs we last fetch
+	 * Guards the chunk queues and the result arrays, as chunk requests complete independently of each other
 	 */
-	FThreadSafeCounter LastSplitQueryIndex {0};
+	FCriticalSection ChunkLock;
+
+	/**
+	 * Index of the next chunk of platform IDs to map to AccelByte IDs
+	 */
+	int32 NextPlatformChunkIndex {0};
+
+	/**
+	 * Chunks of AccelByte IDs that are neither cached nor requested yet
+	 */
+	TArray<TArray<FString>> AccelByteIdChunksToQuery;
+
+	/**
+	 * Number of chunk requests sent that have not responded yet
+	 */
+	int32 InFlightRequestNum {0};
+
+	/**
+	 * Highest number of chunk requests in flight at once, from the user cache configuration
+	 */
+	int32 MaxInFlightRequestNum {1};
 
 	/**
 	 * Whether all of these users that we are querying will be marked as important.
@@ -88,19 +115,19 @@ private:
 	FOnQueryUsersComplete Delegate;
 
 	/**
-	 * Actual array of user IDs that will be queried on the backend
+	 * Delegate fired on the game thread with the users of each chunk as it completes, before Delegate
 	 */
-	TQueue<FString> UsersToQuery;
+	FOnQueryUsersPartialResults PartialDelegate;
 
 	/**
-	 * Native platform Ids to be queried using native OSS
+	 * Users of completed chunks that have not been given to the partial results delegate yet
 	 */
-	TArray<TSharedRef<const FUniqueNetId>> PlatformIdsToQuery;
+	TArray<FAccelByteUserInfoRef> PartialUsersToReport;
 
 	/**
-	 * Struct of user IDs and platform ID that will be queried on the backend
+	 * Set once the completion delegate has fired, after which partial results are dropped. Game thread only.
 	 */
-	FPlatformAccountInfoRequest PlatformAccountsInfoRequest;
+	bool bHasTriggeredDelegates {false};
 
 	/**
 	 * Array of users that we were able to query from the backend
@@ -112,16 +139,6 @@ private:
 	 */
 	TArray<FAccelByteUserInfoRef> UsersCached;
 
-	/**
-	 * Flag representing whether we have finished querying basic user info
-	 */
-	FThreadSafeBool bHasQueriedBasicUserInfo = false;
-
-	/**
-	 * Flag representing whether we have finished querying platform user information
-	 */
-	FThreadSafeBool bHasQueriedUserPlatformInfo = false;
-
 	/**
 	 * Delegate handler for when querying platform ID mappings in bulk succeeds
 	 */
@@ -133,14 +150,31 @@ private:
 	void OnBulkQueryPlatformIdMappingsError(int32 ErrorCode, const FString& ErrorMessage);
 
 	/**
-	 * Calls method to get basic user information by an array of AccelByte IDs
+	 * Take the users that are already cached out of an array of AccelByte IDs, and queue the rest in chunks to get their
+	 * basic user information
 	 */
 	void GetBasicUserInfo(const TArray<FString>& AccelByteIds);
 
 	/*
-	 * Query users basic info using low level SDK (only users that is not in cache).
+	 * Query users basic info of a chunk of AccelByte IDs using low level SDK.
+	 */
+	void GetUserOtherPlatformBasicPublicInfo(const TArray<FString>& AccelByteIds);
+
+	/**
+	 * Send queued chunk requests until the in-flight limit is reached, completing the task once every chunk is done.
+	 * Basic information chunks go first, so that users reach the partial results delegate as early as possible.
+	 */
+	void DispatchChunkRequests();
+
+	/**
+	 * Queue users of a completed chunk for the partial results delegate, which fires on the next game thread tick
+	 */
+	void ReportPartialResults(const TArray<FAccelByteUserInfoRef>& Users);
+
+	/**
+	 * Fire the partial results delegate with the users queued so far. Game thread only.
 	 */
-	void GetUserOtherPlatformBasicPublicInfo();
+	void FlushPartialResults();
 
 	/**
 	 * Delegate handler for when querying basic user information by AccelByte IDs succeeds
@@ -0,0 +1,358 @@
+// Copyright (c) 2025 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "ExecTestAsyncTaskBenchmark.h"
+#include "OnlineSubsystemUtils.h"
+#include "Core/AccelByteError.h"
+
+namespace
+{
+	/** Upper bound of tasks for a single scenario, mostly to keep Epic trees from exploding */
+	constexpr int32 MaxBenchmarkTaskNum = 100000;
+
+	/** Completion time of tasks that should only ever finish by timing out */
+	constexpr double NeverCompleteSeconds = 1.0e9;
+
+	double GetPercentile(const TArray<double>& SortedValues, double Percentile)
+	{
+		if (SortedValues.Num() == 0)
+		{
+			return 0.0;
+		}
+		const int32 Rank = FMath::CeilToInt(Percentile / 100.0 * SortedValues.Num());
+		return SortedValues[FMath::Clamp(Rank - 1, 0, SortedValues.Num() - 1)];
+	}
+}
+
+FExecTestAsyncTaskBenchmark::FExecTestAsyncTaskBenchmark(UWorld* InWorld, const FName& InSubsystemName, const TArray<EAccelByteAsyncTaskBenchmarkScenario>& InScenarios, const FSettings& InSettings)
+	: FExecTestBase(InWorld, InSubsystemName)
+	, Scenarios(InScenarios)
+	, Settings(InSettings)
+{
+}
+
+bool FExecTestAsyncTaskBenchmark::ParseCommand(const TCHAR* Cmd, TArray<EAccelByteAsyncTaskBenchmarkScenario>& OutScenarios, FSettings& OutSettings)
+{
+	if (FParse::Command(&Cmd, TEXT("PARALLEL")))
+	{
+		OutScenarios.Add(EAccelByteAsyncTaskBenchmarkScenario::Parallel);
+	}
+	else if (FParse::Command(&Cmd, TEXT("SERIAL")))
+	{
+		OutScenarios.Add(EAccelByteAsyncTaskBenchmarkScenario::Serial);
+	}
+	else if (FParse::Command(&Cmd, TEXT("EPIC")))
+	{
+		OutScenarios.Add(EAccelByteAsyncTaskBenchmarkScenario::EpicTree);
+	}
+	else if (FParse::Command(&Cmd, TEXT("TIMEOUT")))
+	{
+		OutScenarios.Add(EAccelByteAsyncTaskBenchmarkScenario::TimeoutStorm);
+	}
+	else if (FParse::Command(&Cmd, TEXT("ALL")))
+	{
+		OutScenarios.Add(EAccelByteAsyncTaskBenchmarkScenario::Parallel);
+		OutScenarios.Add(EAccelByteAsyncTaskBenchmarkScenario::Serial);
+		OutScenarios.Add(EAccelByteAsyncTaskBenchmarkScenario::EpicTree);
+		OutScenarios.Add(EAccelByteAsyncTaskBenchmarkScenario::TimeoutStorm);
+	}
+	else
+	{
+		return false;
+	}
+
+	FParse::Value(Cmd, TEXT("COUNT="), OutSettings.TaskCount);
+	FParse::Value(Cmd, TEXT("WIDTH="), OutSettings.EpicWidth);
+	FParse::Value(Cmd, TEXT("DEPTH="), OutSettings.EpicDepth);
+	FParse::Value(Cmd, TEXT("TIMEOUT="), OutSettings.TimeoutInSeconds);
+	FExecTestBenchmarkReport::ParseOutputSettings(Cmd, OutSettings.Output);
+
+	OutSettings.TaskCount = FMath::Clamp(OutSettings.TaskCount, 1, MaxBenchmarkTaskNum);
+	OutSettings.EpicWidth = FMath::Max(OutSettings.EpicWidth, 1);
+	OutSettings.EpicDepth = FMath::Max(OutSettings.EpicDepth, 0);
+	OutSettings.TimeoutInSeconds = FMath::Max(OutSettings.TimeoutInSeconds, 0.1);
+	return true;
+}
+
+bool FExecTestAsyncTaskBenchmark::Run()
+{
+	// Only the AccelByte subsystem is ever passed in, the exec command is routed through it
+	FOnlineSubsystemAccelByte* Subsystem = static_cast<FOnlineSubsystemAccelByte*>(::Online::GetSubsystem(World, SubsystemName));
+	if (Subsystem == nullptr)
+	{
+		UE_LOG_AB(Error, TEXT("FExecTestAsyncTaskBenchmark could not find the %s subsystem"), *SubsystemName.ToString());
+		bIsComplete = true;
+		return false;
+	}
+	AccelByteSubsystem = Subsystem->AsShared();
+
+	StartNextScenario();
+	return !bIsComplete;
+}
+
+void FExecTestAsyncTaskBenchmark::StartNextScenario()
+{
+	while (++CurrentScenarioIndex < Scenarios.Num())
+	{
+		if (DispatchScenario(Scenarios[CurrentScenarioIndex]))
+		{
+			return;
+		}
+	}
+
+	ReportResults();
+	bIsComplete = true;
+}
+
+FExecTestAsyncTaskBenchmark::FSample& FExecTestAsyncTaskBenchmark::PrepareSample(int32 Index, int32 Depth)
+{
+	FSample& Sample = *Samples[Index];
+	Sample.Depth = Depth;
+	Sample.Parameter.TaskName = FString::Printf(TEXT("AsyncTaskBenchmark_%s"), ScenarioToString(Scenarios[CurrentScenarioIndex]));
+	Sample.Parameter.TaskCompleteDelegate = FMockAsyncTaskDone::CreateSP(AsShared(), &FExecTestAsyncTaskBenchmark::OnTaskComplete, Index);
+	Sample.DispatchTimeInSeconds = FPlatformTime::Seconds();
+	return Sample;
+}
+
+bool FExecTestAsyncTaskBenchmark::DispatchScenario(EAccelByteAsyncTaskBenchmarkScenario Scenario)
+{
+	int32 TaskNum = Settings.TaskCount;
+	if (Scenario == EAccelByteAsyncTaskBenchmarkScenario::EpicTree)
+	{
+		// Root plus Width^Level nodes for every level below it
+		int64 NodeNum = 1;
+		int64 LevelNodeNum = 1;
+		for (int32 Level = 0; Level < Settings.EpicDepth && NodeNum <= MaxBenchmarkTaskNum; Level++)
+		{
+			LevelNodeNum *= Settings.EpicWidth;
+			NodeNum += LevelNodeNum;
+		}
+
+		if (NodeNum > MaxBenchmarkTaskNum)
+		{
+			UE_LOG_AB(Error, TEXT("Skipping Epic tree benchmark, width %d and depth %d exceed %d tasks"), Settings.EpicWidth, Settings.EpicDepth, MaxBenchmarkTaskNum);
+			return false;
+		}
+		TaskNum = static_cast<int32>(NodeNum);
+	}
+
+	Samples.Reset();
+	Samples.Reserve(TaskNum);
+	for (int32 Index = 0; Index < TaskNum; Index++)
+	{
+		Samples.Add(MakeUnique<FSample>());
+	}
+	CompletedNum = 0;
+	ScenarioStartTimeInSeconds = FPlatformTime::Seconds();
+
+	UE_LOG_AB(Log, TEXT("Starting async task benchmark %s with %d tasks"), ScenarioToString(Scenario), TaskNum);
+
+	FOnlineAsyncTaskInfo TaskInfo;
+	switch (Scenario)
+	{
+	case EAccelByteAsyncTaskBenchmarkScenario::Parallel:
+		TaskInfo.Type = ETypeOfOnlineAsyncTask::Parallel;
+		for (int32 Index = 0; Index < TaskNum; Index++)
+		{
+			FSample& Sample = PrepareSample(Index, 0);
+			AccelByteSubsystem->CreateAndDispatchAsyncTask<FMockAsyncTaskAccelByte>(TaskInfo, AccelByteSubsystem.Get(), Sample.Parameter, false);
+		}
+		break;
+	case EAccelByteAsyncTaskBenchmarkScenario::Serial:
+		TaskInfo.Type = ETypeOfOnlineAsyncTask::Serial;
+		for (int32 Index = 0; Index < TaskNum; Index++)
+		{
+			FSample& Sample = PrepareSample(Index, 0);
+			AccelByteSubsystem->CreateAndDispatchAsyncTask<FMockAsyncTaskAccelByte>(TaskInfo, AccelByteSubsystem.Get(), Sample.Parameter, false);
+		}
+		break;
+	case EAccelByteAsyncTaskBenchmarkScenario::TimeoutStorm:
+		TaskInfo.Type = ETypeOfOnlineAsyncTask::Parallel;
+		for (int32 Index = 0; Index < TaskNum; Index++)
+		{
+			FSample& Sample = PrepareSample(Index, 0);
+			Sample.Parameter.CompletionTime = NeverCompleteSeconds;
+			Sample.Parameter.TimeoutLimitSeconds = Settings.TimeoutInSeconds;
+			AccelByteSubsystem->CreateAndDispatchAsyncTask<FMockAsyncTaskAccelByte>(TaskInfo, AccelByteSubsystem.Get(), Sample.Parameter, true);
+		}
+		break;
+	case EAccelByteAsyncTaskBenchmarkScenario::EpicTree:
+	{
+		NextSampleIndex.Set(1);
+		FSample& Root = PrepareSample(0, 0);
+		if (Settings.EpicDepth > 0)
+		{
+			Root.Parameter.ChildCount = Settings.EpicWidth;
+			Root.Parameter.CreateChildDelegate = AccelByte::FVoidHandler::CreateLambda([this]() { DispatchEpicTreeChildren(0); });
+		}
+		TaskInfo.Type = ETypeOfOnlineAsyncTask::Parallel;
+		TaskInfo.bCreateEpicForThis = true;
+		AccelByteSubsystem->CreateAndDispatchAsyncTask<FMockAsyncTaskAccelByte>(TaskInfo, AccelByteSubsystem.Get(), Root.Parameter, false);
+	}
+		break;
+	default:
+		return false;
+	}
+
+	return true;
+}
+
+void FExecTestAsyncTaskBenchmark::DispatchEpicTreeChildren(int32 ParentDepth)
+{
+	// Runs on the online thread from the parent's Initialize, with the parent's Epic set as the upcoming Epic. This test is
+	// only destroyed once every sample has completed, so capturing this is safe.
+	const int32 ChildDepth = ParentDepth + 1;
+	FOnlineAsyncTaskInfo TaskInfo;
+	TaskInfo.Type = ETypeOfOnlineAsyncTask::Parallel;
+
+	for (int32 Child = 0; Child < Settings.EpicWidth; Child++)
+	{
+		const int32 Index = NextSampleIndex.Increment() - 1;
+		if (!Samples.IsValidIndex(Index))
+		{
+			return;
+		}
+
+		FSample& Sample = *Samples[Index];
+		Sample.Depth = ChildDepth;
+		Sample.Parameter.TaskName = FString::Printf(TEXT("AsyncTaskBenchmark_%s"), ScenarioToString(EAccelByteAsyncTaskBenchmarkScenario::EpicTree));
+		Sample.Parameter.TaskCompleteDelegate = FMockAsyncTaskDone::CreateLambda([this, Index](const FOnlineError& Error) { OnTaskComplete(Error, Index); });
+		if (ChildDepth < Settings.EpicDepth)
+		{
+			Sample.Parameter.ChildCount = Settings.EpicWidth;
+			Sample.Parameter.CreateChildDelegate = AccelByte::FVoidHandler::CreateLambda([this, ChildDepth]() { DispatchEpicTreeChildren(ChildDepth); });
+		}
+		Sample.DispatchTimeInSeconds = FPlatformTime::Seconds();
+		AccelByteSubsystem->CreateAndDispatchAsyncTask<FMockAsyncTaskAccelByte>(TaskInfo, AccelByteSubsystem.Get(), Sample.Parameter, false);
+	}
+}
+
+void FExecTestAsyncTaskBenchmark::OnTaskComplete(const FOnlineError& Error, int32 Index)
+{
+	if (!Samples.IsValidIndex(Index) || Samples[Index]->bIsComplete)
+	{
+		return;
+	}
+
+	FSample& Sample = *Samples[Index];
+	Sample.bIsComplete = true;
+	Sample.CompleteTimeInSeconds = FPlatformTime::Seconds();
+	Sample.bWasSuccessful = Error.bSucceeded;
+	Sample.bHasTimedOut = Error.GetErrorCode() == FString::Printf(TEXT("%d"), static_cast<int32>(AccelByte::ErrorCodes::StatusRequestTimeout));
+
+	if (++CompletedNum < Samples.Num())
+	{
+		return;
+	}
+
+	Results.Add(ComputeResult(Scenarios[CurrentScenarioIndex]));
+
+	// Keep the samples of the finished scenario alive, this delegate is still being executed from one of them
+	for (TUniquePtr<FSample>& FinishedSample : Samples)
+	{
+		RetiredSamples.Add(MoveTemp(FinishedSample));
+	}
+	Samples.Reset();
+
+	StartNextScenario();
+}
+
+FAccelByteAsyncTaskBenchmarkResult FExecTestAsyncTaskBenchmark::ComputeResult(EAccelByteAsyncTaskBenchmarkScenario Scenario) const
+{
+	FAccelByteAsyncTaskBenchmarkResult Result;
+	Result.Scenario = ScenarioToString(Scenario);
+	Result.TaskNum = Samples.Num();
+
+	TArray<double> LatenciesMs;
+	LatenciesMs.Reserve(Samples.Num());
+	double LastCompleteTimeInSeconds = ScenarioStartTimeInSeconds;
+	for (const TUniquePtr<FSample>& Sample : Samples)
+	{
+		if (Sample->bWasSuccessful)
+		{
+			Result.SucceededNum++;
+		}
+		else if (Sample->bHasTimedOut)
+		{
+			Result.TimedOutNum++;
+		}
+		else
+		{
+			Result.FailedNum++;
+		}
+
+		LatenciesMs.Add((Sample->CompleteTimeInSeconds - Sample->DispatchTimeInSeconds) * 1000.0);
+		LastCompleteTimeInSeconds = FMath::Max(LastCompleteTimeInSeconds, Sample->CompleteTimeInSeconds);
+	}
+	LatenciesMs.Sort();
+
+	Result.WallTimeInSeconds = LastCompleteTimeInSeconds - ScenarioStartTimeInSeconds;
+	Result.Throughput = Result.WallTimeInSeconds > 0.0 ? Result.TaskNum / Result.WallTimeInSeconds : 0.0;
+	Result.LatencyP50Ms = GetPercentile(LatenciesMs, 50.0);
+	Result.LatencyP90Ms = GetPercentile(LatenciesMs, 90.0);
+	Result.LatencyP99Ms = GetPercentile(LatenciesMs, 99.0);
+	Result.LatencyMaxMs = LatenciesMs.Num() > 0 ? LatenciesMs.Last() : 0.0;
+	return Result;
+}
+
+void FExecTestAsyncTaskBenchmark::ReportResults()
+{
+	if (Results.Num() == 0)
+	{
+		UE_LOG_AB(Warning, TEXT("Async task benchmark finished without any result"));
+		return;
+	}
+
+	FExecTestBenchmarkReport Report(TEXT("Async task benchmark"), Settings.Output);
+	Report.AddColumn(TEXT("scenario"), TEXT("scenario"));
+	Report.AddColumn(TEXT("tasks"), TEXT("tasks"));
+	Report.AddColumn(TEXT("succeeded"), TEXT("succeeded"));
+	Report.AddColumn(TEXT("timedOut"), TEXT("timed_out"));
+	Report.AddColumn(TEXT("failed"), TEXT("failed"));
+	Report.AddColumn(TEXT("wallTimeSeconds"), TEXT("wall_time_s"), 4);
+	Report.AddColumn(TEXT("tasksPerSecond"), TEXT("tasks_per_s"), 2);
+	Report.AddColumn(TEXT("latencyP50Ms"), TEXT("latency_p50_ms"), 3);
+	Report.AddColumn(TEXT("latencyP90Ms"), TEXT("latency_p90_ms"), 3);
+	Report.AddColumn(TEXT("latencyP99Ms"), TEXT("latency_p99_ms"), 3);
+	Report.AddColumn(TEXT("latencyMaxMs"), TEXT("latency_max_ms"), 3);
+
+	for (const FAccelByteAsyncTaskBenchmarkResult& Result : Results)
+	{
+		Report.AddRow();
+		Report.AddTextValue(Result.Scenario);
+		Report.AddIntegerValue(Result.TaskNum);
+		Report.AddIntegerValue(Result.SucceededNum);
+		Report.AddIntegerValue(Result.TimedOutNum);
+		Report.AddIntegerValue(Result.FailedNum);
+		Report.AddNumberValue(Result.WallTimeInSeconds);
+		Report.AddNumberValue(Result.Throughput);
+		Report.AddNumberValue(Result.LatencyP50Ms);
+		Report.AddNumberValue(Result.LatencyP90Ms);
+		Report.AddNumberValue(Result.LatencyP99Ms);
+		Report.AddNumberValue(Result.LatencyMaxMs);
+	}
+
+	Report.Report();
+}
+
+const TCHAR* FExecTestAsyncTaskBenchmark::ScenarioToString(EAccelByteAsyncTaskBenchmarkScenario Scenario)
+{
+	switch (Scenario)
+	{
+	case EAccelByteAsyncTaskBenchmarkScenario::Parallel:
+		return TEXT("Parallel");
+	case EAccelByteAsyncTaskBenchmarkScenario::Serial:
+		return TEXT("Serial");
+	case EAccelByteAsyncTaskBenchmarkScenario::EpicTree:
+		return TEXT("EpicTree");
+	case EAccelByteAsyncTaskBenchmarkScenario::TimeoutStorm:
+		return TEXT("TimeoutStorm");
+	default:
+		return TEXT("Unknown");
+	}
+}
+
+#endif
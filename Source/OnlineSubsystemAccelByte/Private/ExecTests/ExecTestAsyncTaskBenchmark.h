@@ -0,0 +1,158 @@
+// Copyright (c) 2025 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Runtime/Launch/Resources/Version.h"
+#include "OnlineSubsystemAccelByte.h"
+#include "AsyncTasks/MockAsyncTaskAccelByte.h"
+#include "ExecTestBase.h"
+#include "ExecTestBenchmarkReport.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+/** Scenarios that can be run by FExecTestAsyncTaskBenchmark */
+enum class EAccelByteAsyncTaskBenchmarkScenario : uint8
+{
+	/** Count independent parallel tasks dispatched at once */
+	Parallel,
+	/** Count serial tasks dispatched at once, each waiting for the previous one */
+	Serial,
+	/** A single Epic holding a tree of Width children per node, Depth levels deep */
+	EpicTree,
+	/** Count parallel tasks that never complete on their own and all hit their timeout */
+	TimeoutStorm
+};
+
+/** Result of a single benchmark scenario */
+struct FAccelByteAsyncTaskBenchmarkResult
+{
+	FString Scenario;
+	int32 TaskNum = 0;
+	int32 SucceededNum = 0;
+	int32 TimedOutNum = 0;
+	int32 FailedNum = 0;
+
+	/** Time from dispatching the first task to the delegates of the last task, in seconds */
+	double WallTimeInSeconds = 0.0;
+
+	/** Tasks completed per second of wall time */
+	double Throughput = 0.0;
+
+	/** Time from dispatch to delegates for a single task, in milliseconds */
+	double LatencyP50Ms = 0.0;
+	double LatencyP90Ms = 0.0;
+	double LatencyP99Ms = 0.0;
+	double LatencyMaxMs = 0.0;
+};
+
+/**
+ * Headless benchmark of the async task manager, built on FMockAsyncTaskAccelByte so no backend is involved. Each scenario
+ * dispatches mock tasks through the subsystem, measures the time from dispatch until the task delegates fire on the game
+ * thread, and reports throughput and latency percentiles as CSV or JSON, optionally saved to a file.
+ *
+ * Console command for running is as follows:
+ * ONLINE TEST ASYNCTASK BENCH <PARALLEL|SERIAL|EPIC|TIMEOUT|ALL> [COUNT=<N>] [WIDTH=<N>] [DEPTH=<N>] [TIMEOUT=<Seconds>] [FORMAT=<CSV|JSON>] [FILE=<Path>]
+ *
+ * Relative file paths are saved under Saved/AccelByte/Benchmarks.
+ */
+class FExecTestAsyncTaskBenchmark : public FExecTestBase, public TSharedFromThis<FExecTestAsyncTaskBenchmark>
+{
+public:
+
+	/** Parameters shared by every scenario of a single benchmark run */
+	struct FSettings
+	{
+		/** Number of tasks for the parallel, serial and timeout storm scenarios */
+		int32 TaskCount = 1000;
+
+		/** Children per node for the Epic tree scenario */
+		int32 EpicWidth = 4;
+
+		/** Levels below the root for the Epic tree scenario */
+		int32 EpicDepth = 4;
+
+		/** Timeout given to every task of the timeout storm scenario */
+		double TimeoutInSeconds = 1.0;
+
+		/** Format and file the results are reported to */
+		FExecTestBenchmarkOutputSettings Output;
+	};
+
+	/**
+	 * Constructs an instance of the async task benchmark.
+	 *
+	 * @param InScenarios Scenarios to run one after another
+	 * @param InSettings Parameters of the run
+	 */
+	FExecTestAsyncTaskBenchmark(UWorld* InWorld, const FName& InSubsystemName, const TArray<EAccelByteAsyncTaskBenchmarkScenario>& InScenarios, const FSettings& InSettings);
+
+	virtual bool Run() override;
+
+	/**
+	 * Parse a benchmark console command, everything after 'ONLINE TEST ASYNCTASK BENCH'.
+	 *
+	 * @return false if the scenario is unknown
+	 */
+	static bool ParseCommand(const TCHAR* Cmd, TArray<EAccelByteAsyncTaskBenchmarkScenario>& OutScenarios, FSettings& OutSettings);
+
+private:
+
+	/** A single mock task of the running scenario, allocated up front so its address never changes */
+	struct FSample
+	{
+		MockAsyncTaskParameter Parameter;
+		double DispatchTimeInSeconds = 0.0;
+		double CompleteTimeInSeconds = 0.0;
+		int32 Depth = 0;
+		bool bIsComplete = false;
+		bool bWasSuccessful = false;
+		bool bHasTimedOut = false;
+	};
+
+	TArray<EAccelByteAsyncTaskBenchmarkScenario> Scenarios;
+	FSettings Settings;
+
+	FOnlineSubsystemAccelBytePtr AccelByteSubsystem;
+
+	int32 CurrentScenarioIndex = INDEX_NONE;
+	TArray<TUniquePtr<FSample>> Samples;
+
+	/**
+	 * Samples of scenarios that already finished. The next scenario is started from the delegate of the last task of the
+	 * previous one, so those samples must outlive the scenario.
+	 */
+	TArray<TUniquePtr<FSample>> RetiredSamples;
+
+	/** Next sample to hand out to an Epic tree child, children are dispatched from the online thread */
+	FThreadSafeCounter NextSampleIndex;
+
+	int32 CompletedNum = 0;
+	double ScenarioStartTimeInSeconds = 0.0;
+
+	TArray<FAccelByteAsyncTaskBenchmarkResult> Results;
+
+	/** Start the next scenario, or report results when every scenario has run */
+	void StartNextScenario();
+
+	/** Dispatch the tasks of a scenario, returns false if nothing was dispatched */
+	bool DispatchScenario(EAccelByteAsyncTaskBenchmarkScenario Scenario);
+
+	/** Prepare a sample to be dispatched, binding its delegates */
+	FSample& PrepareSample(int32 Index, int32 Depth);
+
+	/** Dispatch every child of an Epic tree node, called from the node's Initialize on the online thread */
+	void DispatchEpicTreeChildren(int32 ParentDepth);
+
+	void OnTaskComplete(const FOnlineError& Error, int32 Index);
+
+	FAccelByteAsyncTaskBenchmarkResult ComputeResult(EAccelByteAsyncTaskBenchmarkScenario Scenario) const;
+
+	void ReportResults();
+
+	static const TCHAR* ScenarioToString(EAccelByteAsyncTaskBenchmarkScenario Scenario);
+};
+
+#endif
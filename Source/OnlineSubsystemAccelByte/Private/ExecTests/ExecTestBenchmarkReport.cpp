@@ -0,0 +1,157 @@
+// Copyright (c) 2025 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "ExecTestBenchmarkReport.h"
+#include "OnlineSubsystemAccelByte.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/JsonWriter.h"
+
+FExecTestBenchmarkReport::FExecTestBenchmarkReport(const FString& InBenchmarkName, const FExecTestBenchmarkOutputSettings& InSettings)
+	: BenchmarkName(InBenchmarkName)
+	, Settings(InSettings)
+{
+}
+
+void FExecTestBenchmarkReport::ParseOutputSettings(const TCHAR* Cmd, FExecTestBenchmarkOutputSettings& OutSettings)
+{
+	FParse::Value(Cmd, TEXT("FILE="), OutSettings.OutputFile);
+
+	FString Format;
+	if (FParse::Value(Cmd, TEXT("FORMAT="), Format))
+	{
+		OutSettings.bUseJson = Format.Equals(TEXT("JSON"), ESearchCase::IgnoreCase);
+	}
+}
+
+void FExecTestBenchmarkReport::AddColumn(const TCHAR* JsonKey, const TCHAR* CsvHeader, int32 CsvDecimals)
+{
+	FColumn& Column = Columns.AddDefaulted_GetRef();
+	Column.JsonKey = JsonKey;
+	Column.CsvHeader = CsvHeader;
+	Column.CsvDecimals = CsvDecimals;
+}
+
+void FExecTestBenchmarkReport::AddRow()
+{
+	Rows.AddDefaulted_GetRef().Reserve(Columns.Num());
+}
+
+void FExecTestBenchmarkReport::AddTextValue(const FString& Value)
+{
+	check(Rows.Num() > 0);
+	FValue& Cell = Rows.Last().AddDefaulted_GetRef();
+	Cell.Type = FValue::EType::Text;
+	Cell.Text = Value;
+}
+
+void FExecTestBenchmarkReport::AddIntegerValue(int64 Value)
+{
+	check(Rows.Num() > 0);
+	FValue& Cell = Rows.Last().AddDefaulted_GetRef();
+	Cell.Type = FValue::EType::Integer;
+	Cell.Integer = Value;
+}
+
+void FExecTestBenchmarkReport::AddNumberValue(double Value)
+{
+	check(Rows.Num() > 0);
+	FValue& Cell = Rows.Last().AddDefaulted_GetRef();
+	Cell.Type = FValue::EType::Number;
+	Cell.Number = Value;
+}
+
+FString FExecTestBenchmarkReport::Format() const
+{
+	FString Output;
+	if (Settings.bUseJson)
+	{
+		TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&Output);
+		Writer->WriteArrayStart();
+		for (const TArray<FValue>& Row : Rows)
+		{
+			Writer->WriteObjectStart();
+			for (int32 Index = 0; Index < Row.Num() && Index < Columns.Num(); Index++)
+			{
+				const FValue& Cell = Row[Index];
+				switch (Cell.Type)
+				{
+				case FValue::EType::Integer:
+					Writer->WriteValue(Columns[Index].JsonKey, Cell.Integer);
+					break;
+				case FValue::EType::Number:
+					Writer->WriteValue(Columns[Index].JsonKey, Cell.Number);
+					break;
+				default:
+					Writer->WriteValue(Columns[Index].JsonKey, Cell.Text);
+					break;
+				}
+			}
+			Writer->WriteObjectEnd();
+		}
+		Writer->WriteArrayEnd();
+		Writer->Close();
+		return Output;
+	}
+
+	TArray<FString> Headers;
+	for (const FColumn& Column : Columns)
+	{
+		Headers.Add(Column.CsvHeader);
+	}
+	Output = FString::Join(Headers, TEXT(",")) + TEXT("\n");
+
+	for (const TArray<FValue>& Row : Rows)
+	{
+		TArray<FString> Values;
+		for (int32 Index = 0; Index < Row.Num() && Index < Columns.Num(); Index++)
+		{
+			const FValue& Cell = Row[Index];
+			switch (Cell.Type)
+			{
+			case FValue::EType::Integer:
+				Values.Add(FString::Printf(TEXT("%lld"), Cell.Integer));
+				break;
+			case FValue::EType::Number:
+				Values.Add(FString::Printf(TEXT("%.*f"), Columns[Index].CsvDecimals, Cell.Number));
+				break;
+			default:
+				Values.Add(Cell.Text);
+				break;
+			}
+		}
+		Output += FString::Join(Values, TEXT(",")) + TEXT("\n");
+	}
+	return Output;
+}
+
+void FExecTestBenchmarkReport::Report() const
+{
+	const FString Output = Format();
+	UE_LOG_AB(Log, TEXT("%s results:\n%s"), *BenchmarkName, *Output);
+
+	if (Settings.OutputFile.IsEmpty())
+	{
+		return;
+	}
+
+	FString FilePath = Settings.OutputFile;
+	if (FPaths::IsRelative(FilePath))
+	{
+		FilePath = FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("AccelByte"), TEXT("Benchmarks"), FilePath);
+	}
+
+	if (FFileHelper::SaveStringToFile(Output, *FilePath))
+	{
+		UE_LOG_AB(Log, TEXT("%s results saved to %s"), *BenchmarkName, *FilePath);
+	}
+	else
+	{
+		UE_LOG_AB(Error, TEXT("Failed to save %s results to %s"), *BenchmarkName, *FilePath);
+	}
+}
+
+#endif
@@ -0,0 +1,88 @@
+// Copyright (c) 2025 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+/** Output options shared by every benchmark exec test, parsed from [FORMAT=<CSV|JSON>] [FILE=<Path>] */
+struct FExecTestBenchmarkOutputSettings
+{
+	/** Whether results are formatted as JSON instead of CSV */
+	bool bUseJson = false;
+
+	/** File to save results to, results are only logged if empty. Relative paths are under Saved/AccelByte/Benchmarks */
+	FString OutputFile;
+};
+
+/**
+ * Table of benchmark results, one row per result, logged and optionally saved as CSV or JSON. Every row gets a value for
+ * each column, in the order the columns were added.
+ */
+class FExecTestBenchmarkReport
+{
+public:
+
+	/**
+	 * @param InBenchmarkName Name of the benchmark used in logs, such as 'User cache benchmark'
+	 * @param InSettings Output options of the run
+	 */
+	FExecTestBenchmarkReport(const FString& InBenchmarkName, const FExecTestBenchmarkOutputSettings& InSettings);
+
+	/** Parse the output options out of a benchmark console command */
+	static void ParseOutputSettings(const TCHAR* Cmd, FExecTestBenchmarkOutputSettings& OutSettings);
+
+	/**
+	 * @param JsonKey Key of the column in JSON objects
+	 * @param CsvHeader Header of the column in CSV
+	 * @param CsvDecimals Decimals written to CSV for numbers of this column
+	 */
+	void AddColumn(const TCHAR* JsonKey, const TCHAR* CsvHeader, int32 CsvDecimals = 0);
+
+	/** Start a new row, followed by one Add*Value call per column */
+	void AddRow();
+
+	void AddTextValue(const FString& Value);
+	void AddIntegerValue(int64 Value);
+	void AddNumberValue(double Value);
+
+	FString Format() const;
+
+	/** Log the results, and save them to the output file if one was given */
+	void Report() const;
+
+private:
+
+	struct FColumn
+	{
+		FString JsonKey;
+		FString CsvHeader;
+		int32 CsvDecimals = 0;
+	};
+
+	struct FValue
+	{
+		enum class EType : uint8
+		{
+			Text,
+			Integer,
+			Number
+		};
+
+		EType Type = EType::Text;
+		FString Text;
+		int64 Integer = 0;
+		double Number = 0.0;
+	};
+
+	FString BenchmarkName;
+	FExecTestBenchmarkOutputSettings Settings;
+
+	TArray<FColumn> Columns;
+	TArray<TArray<FValue>> Rows;
+};
+
+#endif
@@ -0,0 +1,186 @@
+// Copyright (c) 2025 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "ExecTestUniqueIdEncodingBenchmark.h"
+#include "Utilities/AccelByteUniqueIdEncoding.h"
+
+namespace
+{
+	/** Upper bound of IDs for a single run */
+	constexpr int32 MaxBenchmarkIdNum = 1000000;
+
+	/** An NBO string is written as an int32 length followed by its characters */
+	constexpr int32 NboLengthBytes = sizeof(int32);
+}
+
+FExecTestUniqueIdEncodingBenchmark::FExecTestUniqueIdEncodingBenchmark(UWorld* InWorld, const FName& InSubsystemName, const FSettings& InSettings)
+	: FExecTestBase(InWorld, InSubsystemName)
+	, Settings(InSettings)
+{
+}
+
+void FExecTestUniqueIdEncodingBenchmark::ParseCommand(const TCHAR* Cmd, FSettings& OutSettings)
+{
+	FParse::Value(Cmd, TEXT("COUNT="), OutSettings.IdCount);
+	FExecTestBenchmarkReport::ParseOutputSettings(Cmd, OutSettings.Output);
+
+	OutSettings.IdCount = FMath::Clamp(OutSettings.IdCount, 1, MaxBenchmarkIdNum);
+}
+
+bool FExecTestUniqueIdEncodingBenchmark::Run()
+{
+	const TArray<FAccelByteUniqueIdComposite> CompositeIds = GenerateCompositeIds(Settings.IdCount);
+	UE_LOG_AB(Log, TEXT("Starting unique ID encoding benchmark with %d IDs"), CompositeIds.Num());
+
+	Results.Add(RunLegacy(CompositeIds));
+	Results.Add(RunCompact(CompositeIds));
+	ReportResults();
+
+	bIsComplete = true;
+	return false;
+}
+
+TArray<FAccelByteUniqueIdComposite> FExecTestUniqueIdEncodingBenchmark::GenerateCompositeIds(int32 Count)
+{
+	TArray<FAccelByteUniqueIdComposite> CompositeIds;
+	CompositeIds.Reserve(Count);
+	for (int32 Index = 0; Index < Count; Index++)
+	{
+		FAccelByteUniqueIdComposite& CompositeId = CompositeIds.AddDefaulted_GetRef();
+		CompositeId.Id = FGuid::NewGuid().ToString(EGuidFormats::Digits).ToLower();
+
+		// Half of the IDs have no platform information, like most IDs made from backend notifications
+		switch (Index % 4)
+		{
+		case 2:
+			CompositeId.PlatformType = TEXT("STEAM");
+			CompositeId.PlatformId = FString::Printf(TEXT("7656119%010d"), Index);
+			break;
+		case 3:
+			CompositeId.PlatformType = TEXT("CustomPlatform");
+			CompositeId.PlatformId = FGuid::NewGuid().ToString(EGuidFormats::DigitsWithHyphens);
+			break;
+		default:
+			break;
+		}
+	}
+	return CompositeIds;
+}
+
+FAccelByteUniqueIdEncodingBenchmarkResult FExecTestUniqueIdEncodingBenchmark::RunLegacy(const TArray<FAccelByteUniqueIdComposite>& CompositeIds) const
+{
+	FAccelByteUniqueIdEncodingBenchmarkResult Result;
+	Result.Encoding = TEXT("Legacy");
+	Result.IdNum = CompositeIds.Num();
+
+	TArray<FString> EncodedIds;
+	EncodedIds.Reserve(CompositeIds.Num());
+
+	const double EncodeStartTime = FPlatformTime::Seconds();
+	for (const FAccelByteUniqueIdComposite& CompositeId : CompositeIds)
+	{
+		EncodedIds.Add(FAccelByteUniqueIdEncoding::EncodeLegacy(CompositeId));
+	}
+	const double EncodeTime = FPlatformTime::Seconds() - EncodeStartTime;
+
+	TArray<FAccelByteUniqueIdComposite> DecodedIds;
+	DecodedIds.SetNum(CompositeIds.Num());
+
+	const double DecodeStartTime = FPlatformTime::Seconds();
+	for (int32 Index = 0; Index < EncodedIds.Num(); Index++)
+	{
+		FAccelByteUniqueIdEncoding::DecodeLegacy(EncodedIds[Index], DecodedIds[Index]);
+	}
+	const double DecodeTime = FPlatformTime::Seconds() - DecodeStartTime;
+
+	int64 TotalBytes = 0;
+	for (int32 Index = 0; Index < CompositeIds.Num(); Index++)
+	{
+		TotalBytes += NboLengthBytes + FTCHARToUTF8(*EncodedIds[Index]).Length();
+		if (DecodedIds[Index].Id != CompositeIds[Index].Id
+			|| DecodedIds[Index].PlatformType != CompositeIds[Index].PlatformType
+			|| DecodedIds[Index].PlatformId != CompositeIds[Index].PlatformId)
+		{
+			Result.MismatchNum++;
+		}
+	}
+
+	Result.EncodeNs = EncodeTime * 1.0e9 / Result.IdNum;
+	Result.DecodeNs = DecodeTime * 1.0e9 / Result.IdNum;
+	Result.NboBytes = static_cast<double>(TotalBytes) / Result.IdNum;
+	return Result;
+}
+
+FAccelByteUniqueIdEncodingBenchmarkResult FExecTestUniqueIdEncodingBenchmark::RunCompact(const TArray<FAccelByteUniqueIdComposite>& CompositeIds) const
+{
+	FAccelByteUniqueIdEncodingBenchmarkResult Result;
+	Result.Encoding = TEXT("Compact");
+	Result.IdNum = CompositeIds.Num();
+
+	TArray<TArray<uint8>> EncodedIds;
+	EncodedIds.SetNum(CompositeIds.Num());
+
+	const double EncodeStartTime = FPlatformTime::Seconds();
+	for (int32 Index = 0; Index < CompositeIds.Num(); Index++)
+	{
+		FAccelByteUniqueIdEncoding::EncodeCompact(CompositeIds[Index], EncodedIds[Index]);
+	}
+	const double EncodeTime = FPlatformTime::Seconds() - EncodeStartTime;
+
+	TArray<FAccelByteUniqueIdComposite> DecodedIds;
+	DecodedIds.SetNum(CompositeIds.Num());
+
+	const double DecodeStartTime = FPlatformTime::Seconds();
+	for (int32 Index = 0; Index < EncodedIds.Num(); Index++)
+	{
+		FAccelByteUniqueIdEncoding::DecodeCompact(EncodedIds[Index].GetData(), EncodedIds[Index].Num(), DecodedIds[Index]);
+	}
+	const double DecodeTime = FPlatformTime::Seconds() - DecodeStartTime;
+
+	int64 TotalBytes = 0;
+	for (int32 Index = 0; Index < CompositeIds.Num(); Index++)
+	{
+		// Marker and size come before the compact bytes
+		TotalBytes += NboLengthBytes * 2 + EncodedIds[Index].Num();
+		if (DecodedIds[Index].Id != CompositeIds[Index].Id
+			|| DecodedIds[Index].PlatformType != CompositeIds[Index].PlatformType
+			|| DecodedIds[Index].PlatformId != CompositeIds[Index].PlatformId)
+		{
+			Result.MismatchNum++;
+		}
+	}
+
+	Result.EncodeNs = EncodeTime * 1.0e9 / Result.IdNum;
+	Result.DecodeNs = DecodeTime * 1.0e9 / Result.IdNum;
+	Result.NboBytes = static_cast<double>(TotalBytes) / Result.IdNum;
+	return Result;
+}
+
+void FExecTestUniqueIdEncodingBenchmark::ReportResults()
+{
+	FExecTestBenchmarkReport Report(TEXT("Unique ID encoding benchmark"), Settings.Output);
+	Report.AddColumn(TEXT("encoding"), TEXT("encoding"));
+	Report.AddColumn(TEXT("ids"), TEXT("ids"));
+	Report.AddColumn(TEXT("encodeNs"), TEXT("encode_ns"), 1);
+	Report.AddColumn(TEXT("decodeNs"), TEXT("decode_ns"), 1);
+	Report.AddColumn(TEXT("nboBytes"), TEXT("nbo_bytes"), 1);
+	Report.AddColumn(TEXT("mismatches"), TEXT("mismatches"));
+
+	for (const FAccelByteUniqueIdEncodingBenchmarkResult& Result : Results)
+	{
+		Report.AddRow();
+		Report.AddTextValue(Result.Encoding);
+		Report.AddIntegerValue(Result.IdNum);
+		Report.AddNumberValue(Result.EncodeNs);
+		Report.AddNumberValue(Result.DecodeNs);
+		Report.AddNumberValue(Result.NboBytes);
+		Report.AddIntegerValue(Result.MismatchNum);
+	}
+
+	Report.Report();
+}
+
+#endif
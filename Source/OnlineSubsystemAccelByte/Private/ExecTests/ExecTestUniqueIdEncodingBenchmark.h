@@ -0,0 +1,77 @@
+// Copyright (c) 2025 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "OnlineSubsystemAccelByte.h"
+#include "ExecTestBase.h"
+#include "ExecTestBenchmarkReport.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+/** Result of benchmarking a single encoding of AccelByte user IDs */
+struct FAccelByteUniqueIdEncodingBenchmarkResult
+{
+	FString Encoding;
+	int32 IdNum = 0;
+
+	/** Average time to encode or decode a single ID, in nanoseconds */
+	double EncodeNs = 0.0;
+	double DecodeNs = 0.0;
+
+	/** Average size of a single ID once written with FNboSerializeToBufferAccelByte, length prefix and marker included */
+	double NboBytes = 0.0;
+
+	/** IDs that did not decode back to the composite they were encoded from */
+	int32 MismatchNum = 0;
+};
+
+/**
+ * Headless benchmark comparing the legacy Base64 JSON encoding of AccelByte user IDs with the compact binary one. A set of
+ * generated composites, a mix of IDs with no, known and custom platform information, is encoded and decoded with both,
+ * and the time per ID and serialized size are reported as CSV or JSON, optionally saved to a file.
+ *
+ * Console command for running is as follows:
+ * ONLINE TEST NETID BENCH [COUNT=<N>] [FORMAT=<CSV|JSON>] [FILE=<Path>]
+ *
+ * Relative file paths are saved under Saved/AccelByte/Benchmarks.
+ */
+class FExecTestUniqueIdEncodingBenchmark : public FExecTestBase, public TSharedFromThis<FExecTestUniqueIdEncodingBenchmark>
+{
+public:
+
+	/** Parameters of a single benchmark run */
+	struct FSettings
+	{
+		/** Number of IDs encoded and decoded with each encoding */
+		int32 IdCount = 10000;
+
+		/** Format and file the results are reported to */
+		FExecTestBenchmarkOutputSettings Output;
+	};
+
+	FExecTestUniqueIdEncodingBenchmark(UWorld* InWorld, const FName& InSubsystemName, const FSettings& InSettings);
+
+	virtual bool Run() override;
+
+	/** Parse a benchmark console command, everything after 'ONLINE TEST NETID BENCH' */
+	static void ParseCommand(const TCHAR* Cmd, FSettings& OutSettings);
+
+private:
+
+	FSettings Settings;
+
+	TArray<FAccelByteUniqueIdEncodingBenchmarkResult> Results;
+
+	FAccelByteUniqueIdEncodingBenchmarkResult RunLegacy(const TArray<FAccelByteUniqueIdComposite>& CompositeIds) const;
+
+	FAccelByteUniqueIdEncodingBenchmarkResult RunCompact(const TArray<FAccelByteUniqueIdComposite>& CompositeIds) const;
+
+	void ReportResults();
+
+	static TArray<FAccelByteUniqueIdComposite> GenerateCompositeIds(int32 Count);
+};
+
+#endif
@@ -0,0 +1,210 @@
+// Copyright (c) 2025 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "ExecTestUserCacheBenchmark.h"
+#include "OnlineUserCacheAccelByte.h"
+#include "OnlineSubsystemUtils.h"
+#include "Async/Async.h"
+#include "Math/RandomStream.h"
+#include <atomic>
+
+namespace
+{
+	/** Upper bounds of a single run */
+	constexpr int32 MaxBenchmarkThreadNum = 64;
+	constexpr int32 MaxBenchmarkUserNum = 1000000;
+	constexpr int32 MaxBenchmarkSeconds = 60;
+
+	/** Operations done between two checks of the clock, so that reading it does not dominate the lookups */
+	constexpr int32 OperationsPerClockCheck = 256;
+}
+
+FExecTestUserCacheBenchmark::FExecTestUserCacheBenchmark(UWorld* InWorld, const FName& InSubsystemName, const FSettings& InSettings)
+	: FExecTestBase(InWorld, InSubsystemName)
+	, Settings(InSettings)
+{
+}
+
+void FExecTestUserCacheBenchmark::ParseCommand(const TCHAR* Cmd, FSettings& OutSettings)
+{
+	FParse::Value(Cmd, TEXT("THREADS="), OutSettings.MaxThreadNum);
+	FParse::Value(Cmd, TEXT("USERS="), OutSettings.UserCount);
+	FParse::Value(Cmd, TEXT("SECONDS="), OutSettings.SecondsPerRun);
+	FParse::Value(Cmd, TEXT("WRITES="), OutSettings.WritePercent);
+	FExecTestBenchmarkReport::ParseOutputSettings(Cmd, OutSettings.Output);
+
+	OutSettings.MaxThreadNum = FMath::Clamp(OutSettings.MaxThreadNum, 1, MaxBenchmarkThreadNum);
+	OutSettings.UserCount = FMath::Clamp(OutSettings.UserCount, 1, MaxBenchmarkUserNum);
+	OutSettings.SecondsPerRun = FMath::Clamp(OutSettings.SecondsPerRun, 1, MaxBenchmarkSeconds);
+	OutSettings.WritePercent = FMath::Clamp(OutSettings.WritePercent, 0, 100);
+}
+
+bool FExecTestUserCacheBenchmark::Run()
+{
+	FOnlineSubsystemAccelByte* Subsystem = static_cast<FOnlineSubsystemAccelByte*>(::Online::GetSubsystem(World, SubsystemName));
+	if (Subsystem == nullptr)
+	{
+		UE_LOG_AB(Warning, TEXT("Failed to run user cache benchmark as the subsystem could not be found"));
+		bIsComplete = true;
+		return false;
+	}
+
+	// Use a cache of our own, so that the users of the subsystem are neither evicted nor slowed down by the run
+	const TSharedRef<FOnlineUserCacheAccelByte, ESPMode::ThreadSafe> UserCache = MakeShared<FOnlineUserCacheAccelByte, ESPMode::ThreadSafe>(Subsystem);
+
+	const TArray<FAccelByteUniqueIdComposite> CompositeIds = GenerateCompositeIds(Settings.UserCount);
+	TArray<FAccelByteUserInfoRef> Users;
+	Users.Reserve(CompositeIds.Num());
+	for (const FAccelByteUniqueIdComposite& CompositeId : CompositeIds)
+	{
+		FAccelByteUserInfoRef User = MakeShared<FAccelByteUserInfo, ESPMode::ThreadSafe>();
+		User->Id = FUniqueNetIdAccelByteUser::Create(CompositeId);
+		User->DisplayName = CompositeId.Id.Left(8);
+		Users.Add(User);
+	}
+	UserCache->AddUsersToCache(Users);
+
+	UE_LOG_AB(Log, TEXT("Starting user cache benchmark with %d users, up to %d threads, %d%% writes")
+		, CompositeIds.Num()
+		, Settings.MaxThreadNum
+		, Settings.WritePercent);
+
+	for (int32 ThreadNum = 1; ; ThreadNum = FMath::Min(ThreadNum * 2, Settings.MaxThreadNum))
+	{
+		Results.Add(RunThreads(UserCache.Get(), CompositeIds, ThreadNum));
+		if (ThreadNum == Settings.MaxThreadNum)
+		{
+			break;
+		}
+	}
+	ReportResults();
+
+	bIsComplete = true;
+	return false;
+}
+
+TArray<FAccelByteUniqueIdComposite> FExecTestUserCacheBenchmark::GenerateCompositeIds(int32 Count)
+{
+	TArray<FAccelByteUniqueIdComposite> CompositeIds;
+	CompositeIds.Reserve(Count);
+	for (int32 Index = 0; Index < Count; Index++)
+	{
+		FAccelByteUniqueIdComposite& CompositeId = CompositeIds.AddDefaulted_GetRef();
+		CompositeId.Id = FGuid::NewGuid().ToString(EGuidFormats::Digits).ToLower();
+
+		// Half of the users also go into the platform map
+		if (Index % 2 == 1)
+		{
+			CompositeId.PlatformType = TEXT("STEAM");
+			CompositeId.PlatformId = FString::Printf(TEXT("7656119%010d"), Index);
+		}
+	}
+	return CompositeIds;
+}
+
+FAccelByteUserCacheBenchmarkResult FExecTestUserCacheBenchmark::RunThreads(FOnlineUserCacheAccelByte& UserCache, const TArray<FAccelByteUniqueIdComposite>& CompositeIds, int32 ThreadNum) const
+{
+	struct FThreadCounts
+	{
+		uint64 LookupNum = 0;
+		uint64 WriteNum = 0;
+		uint64 MissNum = 0;
+	};
+
+	FAccelByteUserCacheBenchmarkResult Result;
+	Result.ThreadNum = ThreadNum;
+
+	// Threads are started first and released together, so that none of them runs uncontended while the others spin up
+	std::atomic<bool> bIsStarted{false};
+	std::atomic<int32> ReadyNum{0};
+	double EndTime = 0.0;
+
+	const int32 WritePercent = Settings.WritePercent;
+	TArray<TFuture<FThreadCounts>> Futures;
+	for (int32 ThreadIndex = 0; ThreadIndex < ThreadNum; ThreadIndex++)
+	{
+		Futures.Add(Async(EAsyncExecution::Thread, [&UserCache, &CompositeIds, &bIsStarted, &ReadyNum, &EndTime, WritePercent, ThreadIndex]()
+		{
+			FThreadCounts Counts;
+			FRandomStream Random(ThreadIndex + 1);
+
+			ReadyNum.fetch_add(1);
+			while (!bIsStarted.load(std::memory_order_acquire))
+			{
+				FPlatformProcess::Yield();
+			}
+
+			while (FPlatformTime::Seconds() < EndTime)
+			{
+				for (int32 Index = 0; Index < OperationsPerClockCheck; Index++)
+				{
+					const FAccelByteUniqueIdComposite& CompositeId = CompositeIds[Random.RandHelper(CompositeIds.Num())];
+					if (WritePercent > 0 && Random.RandHelper(100) < WritePercent)
+					{
+						UserCache.AddPublicCodeToCache(CompositeId, CompositeId.Id.Right(6));
+						Counts.WriteNum++;
+					}
+					else
+					{
+						if (!UserCache.GetUser(CompositeId).IsValid())
+						{
+							Counts.MissNum++;
+						}
+						Counts.LookupNum++;
+					}
+				}
+			}
+			return Counts;
+		}));
+	}
+
+	while (ReadyNum.load() < ThreadNum)
+	{
+		FPlatformProcess::Yield();
+	}
+
+	const double StartTime = FPlatformTime::Seconds();
+	EndTime = StartTime + Settings.SecondsPerRun;
+	bIsStarted.store(true, std::memory_order_release);
+
+	for (TFuture<FThreadCounts>& Future : Futures)
+	{
+		const FThreadCounts Counts = Future.Get();
+		Result.LookupNum += Counts.LookupNum;
+		Result.WriteNum += Counts.WriteNum;
+		Result.MissNum += Counts.MissNum;
+	}
+
+	Result.Seconds = FPlatformTime::Seconds() - StartTime;
+	Result.LookupsPerSecond = Result.Seconds > 0.0 ? Result.LookupNum / Result.Seconds : 0.0;
+	return Result;
+}
+
+void FExecTestUserCacheBenchmark::ReportResults()
+{
+	FExecTestBenchmarkReport Report(TEXT("User cache benchmark"), Settings.Output);
+	Report.AddColumn(TEXT("threads"), TEXT("threads"));
+	Report.AddColumn(TEXT("seconds"), TEXT("seconds"), 2);
+	Report.AddColumn(TEXT("lookups"), TEXT("lookups"));
+	Report.AddColumn(TEXT("writes"), TEXT("writes"));
+	Report.AddColumn(TEXT("misses"), TEXT("misses"));
+	Report.AddColumn(TEXT("lookupsPerSecond"), TEXT("lookups_per_second"));
+
+	for (const FAccelByteUserCacheBenchmarkResult& Result : Results)
+	{
+		Report.AddRow();
+		Report.AddIntegerValue(Result.ThreadNum);
+		Report.AddNumberValue(Result.Seconds);
+		Report.AddIntegerValue(static_cast<int64>(Result.LookupNum));
+		Report.AddIntegerValue(static_cast<int64>(Result.WriteNum));
+		Report.AddIntegerValue(static_cast<int64>(Result.MissNum));
+		Report.AddNumberValue(Result.LookupsPerSecond);
+	}
+
+	Report.Report();
+}
+
+#endif
@@ -0,0 +1,83 @@
+// Copyright (c) 2025 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "OnlineSubsystemAccelByte.h"
+#include "ExecTestBase.h"
+#include "ExecTestBenchmarkReport.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+/** Result of hammering the user cache from a given number of threads */
+struct FAccelByteUserCacheBenchmarkResult
+{
+	int32 ThreadNum = 0;
+	double Seconds = 0.0;
+
+	uint64 LookupNum = 0;
+	uint64 WriteNum = 0;
+
+	/** Lookups that did not find a user that was added before the run */
+	uint64 MissNum = 0;
+
+	double LookupsPerSecond = 0.0;
+};
+
+/**
+ * Headless benchmark of concurrent lookups in the user cache. A private cache, separate from the one of the subsystem, is
+ * filled with generated users, half of them with platform information. Random users are then looked up by composite ID
+ * from one thread, then twice as many, up to the requested thread count, each for a fixed duration. A percentage of the
+ * operations may be public code updates, to measure lookups while the cache is being written to.
+ *
+ * Console command for running is as follows:
+ * ONLINE TEST USERCACHE BENCH [THREADS=<N>] [USERS=<N>] [SECONDS=<N>] [WRITES=<Percent>] [FORMAT=<CSV|JSON>] [FILE=<Path>]
+ *
+ * Relative file paths are saved under Saved/AccelByte/Benchmarks. Blocks the calling thread for the whole run.
+ */
+class FExecTestUserCacheBenchmark : public FExecTestBase, public TSharedFromThis<FExecTestUserCacheBenchmark>
+{
+public:
+
+	/** Parameters of a single benchmark run */
+	struct FSettings
+	{
+		/** Highest number of threads looking up the cache at once */
+		int32 MaxThreadNum = 8;
+
+		/** Number of users added to the cache before the lookups */
+		int32 UserCount = 10000;
+
+		/** Duration of each thread count, in seconds */
+		int32 SecondsPerRun = 2;
+
+		/** Percentage of operations that update a cached user instead of looking one up */
+		int32 WritePercent = 0;
+
+		/** Format and file the results are reported to */
+		FExecTestBenchmarkOutputSettings Output;
+	};
+
+	FExecTestUserCacheBenchmark(UWorld* InWorld, const FName& InSubsystemName, const FSettings& InSettings);
+
+	virtual bool Run() override;
+
+	/** Parse a benchmark console command, everything after 'ONLINE TEST USERCACHE BENCH' */
+	static void ParseCommand(const TCHAR* Cmd, FSettings& OutSettings);
+
+private:
+
+	FSettings Settings;
+
+	TArray<FAccelByteUserCacheBenchmarkResult> Results;
+
+	FAccelByteUserCacheBenchmarkResult RunThreads(FOnlineUserCacheAccelByte& UserCache, const TArray<FAccelByteUniqueIdComposite>& CompositeIds, int32 ThreadNum) const;
+
+	void ReportResults();
+
+	static TArray<FAccelByteUniqueIdComposite> GenerateCompositeIds(int32 Count);
+};
+
+#endif
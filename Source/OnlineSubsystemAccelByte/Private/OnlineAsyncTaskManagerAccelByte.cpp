@@ -4,6 +4,26 @@
 
 #include "OnlineAsyncTaskManagerAccelByte.h"
 #include "OnlineSubsystemAccelByte.h"
+#include "AsyncTasks/OnlineAsyncTaskAccelByte.h"
+#include "Utilities/AccelByteAsyncTaskPool.h"
+#include "Utilities/AccelByteResponseRecorder.h"
+
+DECLARE_CYCLE_STAT(TEXT("Completion Drain"), STAT_AccelByteCompletionDrain, STATGROUP_AccelByteOSS);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Completions Drained"), STAT_AccelByteCompletionsDrained, STATGROUP_AccelByteOSS);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Completions Carried Over"), STAT_AccelByteCompletionsCarriedOver, STATGROUP_AccelByteOSS);
+
+namespace
+{
+	TSharedRef<FAccelByteCircuitBreakers, ESPMode::ThreadSafe> CreateCircuitBreakersFromConfig()
+	{
+		int32 CircuitBreakerFailureThreshold = 5;
+		// Using int here as 'LoadABConfigFallback' does not have an override for double values
+		int32 CircuitBreakerOpenDurationSeconds = 10;
+		FAccelByteUtilities::LoadABConfigFallback(TEXT("OnlineSubsystemAccelByte"), TEXT("CircuitBreakerFailureThreshold"), CircuitBreakerFailureThreshold);
+		FAccelByteUtilities::LoadABConfigFallback(TEXT("OnlineSubsystemAccelByte"), TEXT("CircuitBreakerOpenDurationSeconds"), CircuitBreakerOpenDurationSeconds);
+		return MakeShared<FAccelByteCircuitBreakers, ESPMode::ThreadSafe>(CircuitBreakerFailureThreshold, static_cast<double>(CircuitBreakerOpenDurationSeconds));
+	}
+}
 
 FOnlineAsyncTaskManagerAccelByte::FOnlineAsyncTaskManagerAccelByte(FOnlineSubsystemAccelByte* ParentSubsystem)
 #if ENGINE_MAJOR_VERSION >= 5
@@ -11,13 +31,335 @@ FOnlineAsyncTaskManagerAccelByte::FOnlineAsyncTaskManagerAccelByte(FOnlineSubsys
 #else
 	: AccelByteSubsystem(ParentSubsystem->AsShared())
 #endif
+	, TimeoutWheel(MakeShared<FAccelByteTimeoutWheel, ESPMode::ThreadSafe>())
+	, CircuitBreakers(CreateCircuitBreakersFromConfig())
+{
+	FAccelByteUtilities::LoadABConfigFallback(TEXT("OnlineSubsystemAccelByte"), TEXT("bEnableAsyncTaskMetrics"), bEnableTaskMetrics);
+	FAccelByteUtilities::LoadABConfigFallback(TEXT("OnlineSubsystemAccelByte"), TEXT("bEnableSerialTaskLanes"), bEnableSerialLanes);
+	FAccelByteUtilities::LoadABConfigFallback(TEXT("OnlineSubsystemAccelByte"), TEXT("MaxInFlightParallelTasks"), MaxInFlightParallelTasks);
+	FAccelByteUtilities::LoadABConfigFallback(TEXT("OnlineSubsystemAccelByte"), TEXT("BackgroundTaskAdmissionPercent"), BackgroundTaskAdmissionPercent);
+	FAccelByteUtilities::LoadABConfigFallback(TEXT("OnlineSubsystemAccelByte"), TEXT("MaxOverflowTasks"), MaxOverflowTasks);
+	FAccelByteUtilities::LoadABConfigFallback(TEXT("OnlineSubsystemAccelByte"), TEXT("bShedOverflowTasks"), bShedOverflowTasks);
+	BackgroundTaskAdmissionPercent = FMath::Clamp(BackgroundTaskAdmissionPercent, 1, 100);
+	FAccelByteUtilities::LoadABConfigFallback(TEXT("OnlineSubsystemAccelByte"), TEXT("bEnableTimeoutWheel"), bEnableTimeoutWheel);
+	FAccelByteUtilities::LoadABConfigFallback(TEXT("OnlineSubsystemAccelByte"), TEXT("bCancelTasksOnLogout"), bCancelTasksOnLogout);
+
+	// Using int here as 'LoadABConfigFallback' does not have an override for double values
+	int32 GameThreadDrainBudgetMsInt { static_cast<int32>(GameThreadDrainBudgetMs) };
+	FAccelByteUtilities::LoadABConfigFallback(TEXT("OnlineSubsystemAccelByte"), TEXT("GameThreadDrainBudgetMs"), GameThreadDrainBudgetMsInt);
+	GameThreadDrainBudgetMs = static_cast<double>(GameThreadDrainBudgetMsInt);
+
+	FAccelByteUtilities::LoadABConfigFallback(TEXT("OnlineSubsystemAccelByte"), TEXT("bEnableRequestRetry"), bEnableRequestRetry);
+
+	// Offline runs, such as performance tests in CI, replay a recorded session from the very first request
+	FString ResponseReplayFile;
+	int32 ResponseReplaySpeedPercent = 100;
+	FAccelByteUtilities::LoadABConfigFallback(TEXT("OnlineSubsystemAccelByte"), TEXT("ResponseReplayFile"), ResponseReplayFile);
+	FAccelByteUtilities::LoadABConfigFallback(TEXT("OnlineSubsystemAccelByte"), TEXT("ResponseReplaySpeedPercent"), ResponseReplaySpeedPercent);
+	if (!ResponseReplayFile.IsEmpty())
+	{
+		FAccelByteResponseRecorder::Get().StartReplay(ResponseReplayFile, ResponseReplaySpeedPercent / 100.0);
+	}
+
+	// The pool is shared by every subsystem instance, the last manager created decides its configuration
+	bool bEnableTaskPooling = true;
+	int32 MaxPooledTasksPerSizeClass = 32;
+	FAccelByteUtilities::LoadABConfigFallback(TEXT("OnlineSubsystemAccelByte"), TEXT("bEnableAsyncTaskPooling"), bEnableTaskPooling);
+	FAccelByteUtilities::LoadABConfigFallback(TEXT("OnlineSubsystemAccelByte"), TEXT("MaxPooledTasksPerSizeClass"), MaxPooledTasksPerSizeClass);
+	FAccelByteAsyncTaskPool::Get().SetMaxFreeBlocksPerSizeClass(MaxPooledTasksPerSizeClass);
+	FAccelByteAsyncTaskPool::Get().SetEnabled(bEnableTaskPooling);
+}
+
+FOnlineAsyncTaskManagerAccelByte::~FOnlineAsyncTaskManagerAccelByte()
 {
+	// Tasks still waiting in a lane are owned by us, the engine manager only cleans up its own queues
+	FScopeLock ScopeLock(&SerialLanesLock);
+	for (TPair<uint32, FSerialLane>& LanePair : SerialLanes)
+	{
+		for (FOnlineAsyncTask* PendingTask : LanePair.Value.PendingTasks)
+		{
+			delete PendingTask;
+		}
+		delete LanePair.Value.ActiveTask;
+	}
+	SerialLanes.Empty();
+
+	// Completions carried over to a frame that will never come, their delegates can't be triggered anymore
+	for (TArray<FOnlineAsyncItem*>& Completions : PendingCompletions)
+	{
+		for (FOnlineAsyncItem* Item : Completions)
+		{
+			delete Item;
+		}
+		Completions.Empty();
+	}
+
+	FScopeLock AdmissionScopeLock(&AdmissionLock);
+	for (TArray<FOnlineAsyncTaskAccelByte*>& PriorityTasks : OverflowTasks)
+	{
+		for (FOnlineAsyncTaskAccelByte* OverflowTask : PriorityTasks)
+		{
+			delete OverflowTask;
+		}
+		PriorityTasks.Empty();
+	}
 }
 
 void FOnlineAsyncTaskManagerAccelByte::OnlineTick()
 {
 	check(AccelByteSubsystem.Pin().IsValid());
 	check(FPlatformTLS::GetCurrentThreadId() == OnlineThreadId);
+
+	// Flag timed out tasks before they are ticked below, they complete themselves on their own tick
+	if (bEnableTimeoutWheel)
+	{
+		TimeoutWheel->Advance(FPlatformTime::Seconds());
+	}
+
+	if (bHasPendingCancellation.exchange(false))
+	{
+		RetireCancelledTasks();
+	}
+
+	TickSerialLanes();
+}
+
+TSharedPtr<FAccelByteTimeoutWheel, ESPMode::ThreadSafe> FOnlineAsyncTaskManagerAccelByte::GetTimeoutWheel() const
+{
+	if (!bEnableTimeoutWheel)
+	{
+		return nullptr;
+	}
+	return TimeoutWheel;
+}
+
+uint32 FOnlineAsyncTaskManagerAccelByte::MakeSerialLaneKey(int32 LocalUserNum, EAccelByteAsyncTaskLane Lane)
+{
+	// Shift the user num by one so that INVALID_CONTROLLERID still packs into an unsigned key
+	return (static_cast<uint32>(LocalUserNum + 1) << 8) | static_cast<uint32>(Lane);
+}
+
+void FOnlineAsyncTaskManagerAccelByte::AddToSerialLane(int32 LocalUserNum, EAccelByteAsyncTaskLane Lane, FOnlineAsyncTask* NewTask)
+{
+	if (NewTask == nullptr)
+	{
+		return;
+	}
+
+	FScopeLock ScopeLock(&SerialLanesLock);
+	SerialLanes.FindOrAdd(MakeSerialLaneKey(LocalUserNum, Lane)).PendingTasks.Add(NewTask);
+}
+
+int32 FOnlineAsyncTaskManagerAccelByte::GetSerialLaneTaskCount() const
+{
+	FScopeLock ScopeLock(&SerialLanesLock);
+	int32 TaskCount = 0;
+	for (const TPair<uint32, FSerialLane>& LanePair : SerialLanes)
+	{
+		TaskCount += LanePair.Value.PendingTasks.Num() + ((LanePair.Value.ActiveTask != nullptr) ? 1 : 0);
+	}
+	return TaskCount;
+}
+
+void FOnlineAsyncTaskManagerAccelByte::TickSerialLanes()
+{
+	// Promote the head of every idle lane, and collect active tasks so they can be ticked without holding the lock.
+	// Tasks are free to dispatch more tasks from Initialize or Tick, which would need the lock from another thread.
+	TArray<TPair<uint32, FOnlineAsyncTask*>, TInlineAllocator<16>> TasksToStart;
+	TArray<TPair<uint32, FOnlineAsyncTask*>, TInlineAllocator<16>> TasksToTick;
+	{
+		FScopeLock ScopeLock(&SerialLanesLock);
+		for (TPair<uint32, FSerialLane>& LanePair : SerialLanes)
+		{
+			FSerialLane& Lane = LanePair.Value;
+			if (Lane.ActiveTask == nullptr && Lane.PendingTasks.Num() > 0)
+			{
+				Lane.ActiveTask = Lane.PendingTasks[0];
+				Lane.PendingTasks.RemoveAt(0, 1, false);
+				TasksToStart.Emplace(LanePair.Key, Lane.ActiveTask);
+			}
+			else if (Lane.ActiveTask != nullptr)
+			{
+				TasksToTick.Emplace(LanePair.Key, Lane.ActiveTask);
+			}
+		}
+	}
+
+	for (const TPair<uint32, FOnlineAsyncTask*>& TaskToStart : TasksToStart)
+	{
+		TaskToStart.Value->Initialize();
+		TasksToTick.Add(TaskToStart);
+	}
+
+	TArray<uint32, TInlineAllocator<16>> FinishedLanes;
+	for (const TPair<uint32, FOnlineAsyncTask*>& TaskToTick : TasksToTick)
+	{
+		FOnlineAsyncTask* Task = TaskToTick.Value;
+		if (!Task->IsDone())
+		{
+			Task->Tick();
+		}
+
+		if (Task->IsDone())
+		{
+			FinishedLanes.Add(TaskToTick.Key);
+			AddToOutQueue(Task);
+		}
+	}
+
+	if (FinishedLanes.Num() == 0)
+	{
+		return;
+	}
+
+	FScopeLock ScopeLock(&SerialLanesLock);
+	for (const uint32 LaneKey : FinishedLanes)
+	{
+		FSerialLane* Lane = SerialLanes.Find(LaneKey);
+		if (Lane == nullptr)
+		{
+			continue;
+		}
+
+		Lane->ActiveTask = nullptr;
+		if (Lane->PendingTasks.Num() == 0)
+		{
+			SerialLanes.Remove(LaneKey);
+		}
+	}
+}
+
+void FOnlineAsyncTaskManagerAccelByte::GameTick()
+{
+	check(IsInGameThread());
+	SCOPE_CYCLE_COUNTER(STAT_AccelByteCompletionDrain);
+
+	// Replayed responses are triggered on the game thread, where the SDK calls back real responses as well
+	FAccelByteResponseRecorder::Get().PumpReplays();
+
+	CollectCompletedItems();
+
+	const double StartTimeInSeconds = FPlatformTime::Seconds();
+	const double BudgetInSeconds = GameThreadDrainBudgetMs / 1000.0;
+	int32 DrainedNum = 0;
+	bool bIsOverBudget = false;
+
+	// Interactive completions go first so that a burst of background refreshes can't delay player facing callbacks
+	for (int32 PriorityIndex = static_cast<int32>(EAccelByteAsyncTaskPriority::Num) - 1; PriorityIndex >= 0 && !bIsOverBudget; PriorityIndex--)
+	{
+		TArray<FOnlineAsyncItem*>& Completions = PendingCompletions[PriorityIndex];
+		int32 Index = 0;
+		for (; Index < Completions.Num(); Index++)
+		{
+			// Always drain at least one item per frame, so that a single slow delegate can't stall the queue forever
+			if (BudgetInSeconds > 0.0 && DrainedNum > 0 && FPlatformTime::Seconds() - StartTimeInSeconds >= BudgetInSeconds)
+			{
+				bIsOverBudget = true;
+				break;
+			}
+
+			DrainCompletedItem(Completions[Index]);
+			DrainedNum++;
+		}
+		Completions.RemoveAt(0, Index);
+	}
+
+	// Slots released by the drain above can now be given to tasks waiting in the overflow queue
+	PumpOverflowTasks();
+
+	FAccelByteAsyncTaskPool::Get().EndFrame();
+
+	// Tasks completed while we were draining wait for the next frame along with everything else carried over, so that
+	// the engine drain below doesn't run them outside of the budget
+	CollectCompletedItems();
+
+	LastFrameDrainedNum = DrainedNum;
+	LastFrameCarriedOverNum = GetPendingCompletionNum();
+	LastFrameDrainTimeMs = (FPlatformTime::Seconds() - StartTimeInSeconds) * 1000.0;
+	if (bIsOverBudget)
+	{
+		CarriedOverFrameCount++;
+		PeakCarriedOverNum = FMath::Max(PeakCarriedOverNum, LastFrameCarriedOverNum);
+	}
+	INC_DWORD_STAT_BY(STAT_AccelByteCompletionsDrained, DrainedNum);
+	SET_DWORD_STAT(STAT_AccelByteCompletionsCarriedOver, LastFrameCarriedOverNum);
+
+	// The base GameTick is deliberately not called. All it does on the game thread is drain the OutQueue, and the online
+	// thread may have added to it since our last collect, in which case it would finalize those tasks without releasing
+	// their admission slot, untracking them, completing coalesced requests, skipping cancelled ones or recording metrics.
+}
+
+int32 FOnlineAsyncTaskManagerAccelByte::GetPendingCompletionNum() const
+{
+	int32 PendingNum = 0;
+	for (const TArray<FOnlineAsyncItem*>& Completions : PendingCompletions)
+	{
+		PendingNum += Completions.Num();
+	}
+	return PendingNum;
+}
+
+void FOnlineAsyncTaskManagerAccelByte::CollectCompletedItems()
+{
+	TArray<FOnlineAsyncItem*> CompletedItems;
+	{
+		FScopeLock LockOutQueue(&OutQueueLock);
+		if (OutQueue.Num() == 0)
+		{
+			return;
+		}
+		CompletedItems = MoveTemp(OutQueue);
+		OutQueue.Reset();
+	}
+
+	for (FOnlineAsyncItem* Item : CompletedItems)
+	{
+		// Items that are not AccelByte tasks have no priority of their own, treat them as normal
+		const FOnlineAsyncTaskAccelByte* AccelByteTask = FindTrackedTask(Item);
+		const EAccelByteAsyncTaskPriority Priority = AccelByteTask != nullptr ? AccelByteTask->GetPriority() : EAccelByteAsyncTaskPriority::Normal;
+		PendingCompletions[static_cast<uint8>(Priority < EAccelByteAsyncTaskPriority::Num ? Priority : EAccelByteAsyncTaskPriority::Normal)].Add(Item);
+	}
+}
+
+void FOnlineAsyncTaskManagerAccelByte::DrainCompletedItem(FOnlineAsyncItem* Item)
+{
+	ReleaseAdmission(Item);
+
+	FOnlineAsyncTaskAccelByte* AccelByteTask = UntrackItem(Item);
+	const double DrainTimeInSeconds = FPlatformTime::Seconds();
+
+	// Finish work, cancelled tasks included, as tasks clean up the state of their interface there
+	Item->Finalize();
+
+	// Results of cancelled tasks are stale, whoever dispatched them is no longer waiting for their delegates
+	const bool bIsCancelled = AccelByteTask != nullptr && AccelByteTask->IsCancelled();
+	if (bIsCancelled)
+	{
+		CancelledTaskCount++;
+	}
+	else
+	{
+		Item->TriggerDelegates();
+	}
+
+	if (AccelByteTask != nullptr)
+	{
+		if (bEnableTaskMetrics && !bIsCancelled)
+		{
+			RecordTaskSamples(AccelByteTask, DrainTimeInSeconds, FPlatformTime::Seconds() - DrainTimeInSeconds);
+		}
+
+		RecordServiceOutcome(AccelByteTask);
+
+		// Requests that attached to this task get their callbacks right after the task's own delegates
+		const FOnlineSubsystemAccelBytePtr SubsystemPin = AccelByteSubsystem.Pin();
+		if (!AccelByteTask->GetCoalescingKey().IsEmpty() && SubsystemPin.IsValid())
+		{
+			SubsystemPin->GetRequestCoalescer().Complete(AccelByteTask->GetCoalescingKey(), AccelByteTask->WasSuccessful());
+		}
+	}
+
+	delete Item;
 }
 
 void FOnlineAsyncTaskManagerAccelByte::CheckMaxParallelTasks()
@@ -26,6 +368,550 @@ void FOnlineAsyncTaskManagerAccelByte::CheckMaxParallelTasks()
 	if (MaxParallelTasks == ParallelTasks.Num())
 	{
 		UE_LOG(LogAccelByteOSS, Warning, TEXT("The number of Parallel Tasks has reached it cap: %d, Please put some delay between each tasks."), MaxParallelTasks);
+		TaskMetrics.RecordParallelCapReached();
 	}
 #endif
 }
+
+void FOnlineAsyncTaskManagerAccelByte::AdmitParallelTask(FOnlineAsyncTaskAccelByte* NewTask, EAccelByteAsyncTaskPriority Priority)
+{
+	if (NewTask == nullptr)
+	{
+		return;
+	}
+
+	// Nested tasks bypass admission, their parent already holds a slot and may be waiting on them to complete
+	if (MaxInFlightParallelTasks <= 0 || NewTask->HasParent())
+	{
+		CheckMaxParallelTasks();
+		AddToParallelTasks(NewTask);
+		return;
+	}
+
+	Priority = (Priority < EAccelByteAsyncTaskPriority::Num) ? Priority : EAccelByteAsyncTaskPriority::Normal;
+	const uint8 PriorityIndex = static_cast<uint8>(Priority);
+	FOnlineAsyncTaskAccelByte* TaskToStart = nullptr;
+	FOnlineAsyncTaskAccelByte* TaskToShed = nullptr;
+	{
+		FScopeLock ScopeLock(&AdmissionLock);
+
+		// Never let a new task jump ahead of waiting tasks of the same or higher priority
+		bool bHasWaitingTasks = false;
+		for (uint8 Index = PriorityIndex; Index < static_cast<uint8>(EAccelByteAsyncTaskPriority::Num); Index++)
+		{
+			bHasWaitingTasks |= OverflowTasks[Index].Num() > 0;
+		}
+
+		if (!bHasWaitingTasks && HasAdmissionCapacity(Priority))
+		{
+			InFlightParallelTaskNum++;
+			AdmittedParallelTasks.Add(NewTask);
+			AdmissionStats[PriorityIndex].AdmittedCount++;
+			TaskToStart = NewTask;
+		}
+		else
+		{
+			int32 OverflowNum = 0;
+			for (const TArray<FOnlineAsyncTaskAccelByte*>& PriorityTasks : OverflowTasks)
+			{
+				OverflowNum += PriorityTasks.Num();
+			}
+
+			if (bShedOverflowTasks && OverflowNum >= MaxOverflowTasks)
+			{
+				// Make room by shedding the newest task of the lowest priority below ours, or shed the new task itself
+				TaskToShed = NewTask;
+				for (uint8 Index = 0; Index < PriorityIndex; Index++)
+				{
+					if (OverflowTasks[Index].Num() > 0)
+					{
+						TaskToShed = OverflowTasks[Index].Pop(false);
+						AdmissionStats[Index].ShedCount++;
+						break;
+					}
+				}
+
+				if (TaskToShed == NewTask)
+				{
+					AdmissionStats[PriorityIndex].ShedCount++;
+				}
+			}
+
+			if (TaskToShed != NewTask)
+			{
+				FAccelByteAsyncTaskAdmissionStats& Stats = AdmissionStats[PriorityIndex];
+				OverflowTasks[PriorityIndex].Add(NewTask);
+				Stats.OverflowedCount++;
+				Stats.PeakOverflowNum = FMath::Max(Stats.PeakOverflowNum, OverflowTasks[PriorityIndex].Num());
+			}
+		}
+	}
+
+	if (TaskToStart != nullptr)
+	{
+		AddToParallelTasks(TaskToStart);
+	}
+
+	if (TaskToShed != nullptr)
+	{
+		ShedTask(TaskToShed);
+	}
+}
+
+int32 FOnlineAsyncTaskManagerAccelByte::GetOverflowTaskCount() const
+{
+	FScopeLock ScopeLock(&AdmissionLock);
+	int32 OverflowNum = 0;
+	for (const TArray<FOnlineAsyncTaskAccelByte*>& PriorityTasks : OverflowTasks)
+	{
+		OverflowNum += PriorityTasks.Num();
+	}
+	return OverflowNum;
+}
+
+FAccelByteAsyncTaskAdmissionStats FOnlineAsyncTaskManagerAccelByte::GetAdmissionStats(EAccelByteAsyncTaskPriority Priority) const
+{
+	if (Priority >= EAccelByteAsyncTaskPriority::Num)
+	{
+		return FAccelByteAsyncTaskAdmissionStats();
+	}
+
+	FScopeLock ScopeLock(&AdmissionLock);
+	return AdmissionStats[static_cast<uint8>(Priority)];
+}
+
+bool FOnlineAsyncTaskManagerAccelByte::HasAdmissionCapacity(EAccelByteAsyncTaskPriority Priority) const
+{
+	if (Priority == EAccelByteAsyncTaskPriority::Background)
+	{
+		const int32 BackgroundCapacity = FMath::Max(1, MaxInFlightParallelTasks * BackgroundTaskAdmissionPercent / 100);
+		return InFlightParallelTaskNum < BackgroundCapacity;
+	}
+
+	return InFlightParallelTaskNum < MaxInFlightParallelTasks;
+}
+
+void FOnlineAsyncTaskManagerAccelByte::ReleaseAdmission(FOnlineAsyncItem* Item)
+{
+	FScopeLock ScopeLock(&AdmissionLock);
+	if (AdmittedParallelTasks.Remove(Item) > 0)
+	{
+		InFlightParallelTaskNum--;
+	}
+}
+
+void FOnlineAsyncTaskManagerAccelByte::PumpOverflowTasks()
+{
+	TArray<FOnlineAsyncTaskAccelByte*, TInlineAllocator<16>> TasksToStart;
+	{
+		FScopeLock ScopeLock(&AdmissionLock);
+		for (int32 Index = static_cast<int32>(EAccelByteAsyncTaskPriority::Num) - 1; Index >= 0; Index--)
+		{
+			TArray<FOnlineAsyncTaskAccelByte*>& PriorityTasks = OverflowTasks[Index];
+			while (PriorityTasks.Num() > 0 && HasAdmissionCapacity(static_cast<EAccelByteAsyncTaskPriority>(Index)))
+			{
+				FOnlineAsyncTaskAccelByte* Task = PriorityTasks[0];
+				PriorityTasks.RemoveAt(0, 1, false);
+				InFlightParallelTaskNum++;
+				AdmittedParallelTasks.Add(Task);
+				TasksToStart.Add(Task);
+			}
+
+			// Lower priorities keep waiting while a higher priority is still queued
+			if (PriorityTasks.Num() > 0)
+			{
+				break;
+			}
+		}
+	}
+
+	for (FOnlineAsyncTaskAccelByte* Task : TasksToStart)
+	{
+		AddToParallelTasks(Task);
+	}
+}
+
+void FOnlineAsyncTaskManagerAccelByte::ShedTask(FOnlineAsyncTaskAccelByte* Task)
+{
+	UE_LOG(LogAccelByteOSS, Warning, TEXT("Overflow queue of parallel tasks is full (%d), rejecting task %s"), MaxOverflowTasks, *Task->GetMetricsName());
+	Task->ForcefullySetRejectedState();
+	AddToOutQueue(Task);
+}
+
+FAccelByteCancellationTokenPtr FOnlineAsyncTaskManagerAccelByte::GetUserCancellationToken(int32 LocalUserNum)
+{
+	if (LocalUserNum == INVALID_CONTROLLERID)
+	{
+		return nullptr;
+	}
+
+	FScopeLock ScopeLock(&UserCancellationTokensLock);
+	if (const FAccelByteCancellationTokenRef* Token = UserCancellationTokens.Find(LocalUserNum))
+	{
+		return *Token;
+	}
+	return UserCancellationTokens.Add(LocalUserNum, MakeShared<FAccelByteCancellationToken, ESPMode::ThreadSafe>());
+}
+
+int32 FOnlineAsyncTaskManagerAccelByte::CancelTasksForUser(int32 LocalUserNum)
+{
+	{
+		FScopeLock ScopeLock(&UserCancellationTokensLock);
+		FAccelByteCancellationTokenRef Token = MakeShared<FAccelByteCancellationToken, ESPMode::ThreadSafe>();
+		if (!UserCancellationTokens.RemoveAndCopyValue(LocalUserNum, Token))
+		{
+			// Nothing has been dispatched for this user since the last cancellation
+			return 0;
+		}
+		Token->Cancel();
+	}
+	bHasPendingCancellation.store(true);
+
+	// Waiting tasks never started, retire them now instead of letting them take a slot only to complete as cancelled
+	TArray<FOnlineAsyncTaskAccelByte*> TasksToRetire;
+	{
+		FScopeLock ScopeLock(&AdmissionLock);
+		for (TArray<FOnlineAsyncTaskAccelByte*>& Queue : OverflowTasks)
+		{
+			for (int32 Index = Queue.Num() - 1; Index >= 0; Index--)
+			{
+				if (Queue[Index]->IsCancelled())
+				{
+					TasksToRetire.Add(Queue[Index]);
+					Queue.RemoveAt(Index, 1, false);
+				}
+			}
+		}
+	}
+	{
+		FScopeLock ScopeLock(&SerialLanesLock);
+		for (TPair<uint32, FSerialLane>& LanePair : SerialLanes)
+		{
+			TArray<FOnlineAsyncTask*>& PendingTasks = LanePair.Value.PendingTasks;
+			for (int32 Index = PendingTasks.Num() - 1; Index >= 0; Index--)
+			{
+				// Lanes only ever hold AccelByte tasks, see FOnlineSubsystemAccelByte::CreateAndDispatchAsyncTaskImplementation
+				FOnlineAsyncTaskAccelByte* Task = static_cast<FOnlineAsyncTaskAccelByte*>(PendingTasks[Index]);
+				if (Task->IsCancelled())
+				{
+					TasksToRetire.Add(Task);
+					PendingTasks.RemoveAt(Index, 1, false);
+				}
+			}
+		}
+	}
+
+	for (FOnlineAsyncTaskAccelByte* Task : TasksToRetire)
+	{
+		RetireCancelledTask(Task);
+	}
+
+	UE_LOG(LogAccelByteOSS, Log, TEXT("Cancelled async tasks of local user %d, %d waiting tasks retired"), LocalUserNum, TasksToRetire.Num());
+	return TasksToRetire.Num();
+}
+
+void FOnlineAsyncTaskManagerAccelByte::RetireCancelledTasks()
+{
+	TArray<FOnlineAsyncTaskAccelByte*> TasksToRetire;
+	{
+		FScopeLock ScopeLock(&ParallelTasksLock);
+		for (int32 Index = ParallelTasks.Num() - 1; Index >= 0; Index--)
+		{
+			FOnlineAsyncTaskAccelByte* Task = FindTrackedTask(ParallelTasks[Index]);
+			if (Task != nullptr && Task->IsCancelled())
+			{
+				TasksToRetire.Add(Task);
+				ParallelTasks.RemoveAt(Index, 1, false);
+			}
+		}
+	}
+	{
+		FScopeLock ScopeLock(&InQueueLock);
+		for (int32 Index = InQueue.Num() - 1; Index >= 0; Index--)
+		{
+			FOnlineAsyncTaskAccelByte* Task = FindTrackedTask(InQueue[Index]);
+			if (Task != nullptr && Task->IsCancelled())
+			{
+				TasksToRetire.Add(Task);
+				InQueue.RemoveAt(Index, 1, false);
+			}
+		}
+	}
+
+	for (FOnlineAsyncTaskAccelByte* Task : TasksToRetire)
+	{
+		RetireCancelledTask(Task);
+	}
+}
+
+void FOnlineAsyncTaskManagerAccelByte::RetireCancelledTask(FOnlineAsyncTaskAccelByte* Task)
+{
+	Task->ForcefullySetCancelledState();
+	AddToOutQueue(Task);
+}
+
+void FOnlineAsyncTaskManagerAccelByte::TrackTask(FOnlineAsyncTaskAccelByte* Task)
+{
+	if (Task == nullptr)
+	{
+		return;
+	}
+
+	FScopeLock ScopeLock(&TrackedTasksLock);
+	TrackedTasks.Add(static_cast<FOnlineAsyncItem*>(Task), Task);
+}
+
+void FOnlineAsyncTaskManagerAccelByte::ResetTaskMetrics()
+{
+	TaskMetrics.Reset();
+}
+
+bool FOnlineAsyncTaskManagerAccelByte::Exec(UWorld* InWorld, const TCHAR* Cmd, FOutputDevice& Ar)
+{
+	if (FParse::Command(&Cmd, TEXT("METRICS")))
+	{
+		if (FParse::Command(&Cmd, TEXT("RESET")))
+		{
+			ResetTaskMetrics();
+			Ar.Logf(TEXT("AccelByte async task metrics have been reset."));
+			return true;
+		}
+
+		if (!bEnableTaskMetrics)
+		{
+			Ar.Logf(TEXT("AccelByte async task metrics are disabled, set bEnableAsyncTaskMetrics to enable them."));
+		}
+
+		const FString Filter = FParse::Token(Cmd, false);
+		TaskMetrics.Dump(Ar, Filter);
+		return true;
+	}
+
+	if (FParse::Command(&Cmd, TEXT("LANES")))
+	{
+		FScopeLock ScopeLock(&SerialLanesLock);
+		Ar.Logf(TEXT("AccelByte serial lanes with work: %d (enabled: %s)"), SerialLanes.Num(), LOG_BOOL_FORMAT(bEnableSerialLanes));
+		for (const TPair<uint32, FSerialLane>& LanePair : SerialLanes)
+		{
+			Ar.Logf(TEXT("    LocalUserNum %d, lane %d: active %s, pending %d")
+				, static_cast<int32>(LanePair.Key >> 8) - 1
+				, static_cast<int32>(LanePair.Key & 0xFF)
+				, LOG_BOOL_FORMAT(LanePair.Value.ActiveTask != nullptr)
+				, LanePair.Value.PendingTasks.Num());
+		}
+		return true;
+	}
+
+	if (FParse::Command(&Cmd, TEXT("TIMEOUTS")))
+	{
+		Ar.Logf(TEXT("AccelByte timeout wheel (enabled: %s): scheduled now %d, total scheduled %llu, rescheduled %llu, expired %llu")
+			, LOG_BOOL_FORMAT(bEnableTimeoutWheel)
+			, TimeoutWheel->Num()
+			, TimeoutWheel->GetScheduledCount()
+			, TimeoutWheel->GetRescheduledCount()
+			, TimeoutWheel->GetExpiredCount());
+		return true;
+	}
+
+	if (FParse::Command(&Cmd, TEXT("POOL")))
+	{
+		if (FParse::Command(&Cmd, TEXT("TRIM")))
+		{
+			FAccelByteAsyncTaskPool::Get().Trim();
+			Ar.Logf(TEXT("AccelByte async task pool has been trimmed."));
+			return true;
+		}
+
+		FAccelByteAsyncTaskPool::Get().Dump(Ar);
+		return true;
+	}
+
+	if (FParse::Command(&Cmd, TEXT("DRAIN")))
+	{
+		Ar.Logf(TEXT("AccelByte game thread drain: budget %.2f ms, last frame drained %d in %.2f ms, carried over %d (peak %d, over budget in %llu frames)")
+			, GameThreadDrainBudgetMs
+			, LastFrameDrainedNum
+			, LastFrameDrainTimeMs
+			, LastFrameCarriedOverNum
+			, PeakCarriedOverNum
+			, CarriedOverFrameCount);
+		for (int32 Index = static_cast<int32>(EAccelByteAsyncTaskPriority::Num) - 1; Index >= 0; Index--)
+		{
+			Ar.Logf(TEXT("    %-11s pending %d"), *AsyncTaskPriorityToString(static_cast<EAccelByteAsyncTaskPriority>(Index)), PendingCompletions[Index].Num());
+		}
+		return true;
+	}
+
+	if (FParse::Command(&Cmd, TEXT("RECORDER")))
+	{
+		FAccelByteResponseRecorder::Get().Dump(Ar);
+		return true;
+	}
+
+	if (FParse::Command(&Cmd, TEXT("RECORD")))
+	{
+		if (FParse::Command(&Cmd, TEXT("START")))
+		{
+			FAccelByteResponseRecorder::Get().StartRecording();
+			Ar.Logf(TEXT("Recording AccelByte SDK responses."));
+			return true;
+		}
+
+		if (FParse::Command(&Cmd, TEXT("STOP")))
+		{
+			const FString FilePath = FParse::Token(Cmd, false);
+			if (FilePath.IsEmpty())
+			{
+				Ar.Logf(TEXT("Usage: ASYNCTASK RECORD STOP <File>"));
+				return true;
+			}
+
+			const bool bSaved = FAccelByteResponseRecorder::Get().StopRecording(FilePath);
+			Ar.Logf(TEXT("Stopped recording AccelByte SDK responses, saved: %s"), LOG_BOOL_FORMAT(bSaved));
+			return true;
+		}
+
+		Ar.Logf(TEXT("Usage: ASYNCTASK RECORD <START|STOP <File>>"));
+		return true;
+	}
+
+	if (FParse::Command(&Cmd, TEXT("REPLAY")))
+	{
+		if (FParse::Command(&Cmd, TEXT("STOP")))
+		{
+			FAccelByteResponseRecorder::Get().StopReplay();
+			Ar.Logf(TEXT("Stopped replaying AccelByte SDK responses."));
+			return true;
+		}
+
+		const FString FilePath = FParse::Token(Cmd, false);
+		if (FilePath.IsEmpty())
+		{
+			Ar.Logf(TEXT("Usage: ASYNCTASK REPLAY <File> [SPEED=<Multiplier>] or ASYNCTASK REPLAY STOP"));
+			return true;
+		}
+
+		double Speed = 1.0;
+		FParse::Value(Cmd, TEXT("SPEED="), Speed);
+		const bool bStarted = FAccelByteResponseRecorder::Get().StartReplay(FilePath, Speed);
+		Ar.Logf(TEXT("Replaying AccelByte SDK responses from %s, started: %s"), *FilePath, LOG_BOOL_FORMAT(bStarted));
+		return true;
+	}
+
+	if (FParse::Command(&Cmd, TEXT("BREAKERS")))
+	{
+		if (FParse::Command(&Cmd, TEXT("RESET")))
+		{
+			CircuitBreakers->Reset();
+			Ar.Logf(TEXT("AccelByte circuit breakers have been reset."));
+			return true;
+		}
+
+		Ar.Logf(TEXT("AccelByte request retry enabled: %s"), LOG_BOOL_FORMAT(bEnableRequestRetry));
+		CircuitBreakers->Dump(Ar);
+		return true;
+	}
+
+	if (FParse::Command(&Cmd, TEXT("CANCEL")))
+	{
+		const FString LocalUserNumString = FParse::Token(Cmd, false);
+		if (LocalUserNumString.IsEmpty() || !LocalUserNumString.IsNumeric())
+		{
+			Ar.Logf(TEXT("Usage: ASYNCTASK CANCEL <LocalUserNum>. Tasks drained as cancelled so far: %llu"), CancelledTaskCount);
+			return true;
+		}
+
+		const int32 LocalUserNum = FCString::Atoi(*LocalUserNumString);
+		const int32 RetiredNum = CancelTasksForUser(LocalUserNum);
+		Ar.Logf(TEXT("Cancelled async tasks of local user %d, %d waiting tasks retired"), LocalUserNum, RetiredNum);
+		return true;
+	}
+
+	if (FParse::Command(&Cmd, TEXT("ADMISSION")))
+	{
+		FScopeLock ScopeLock(&AdmissionLock);
+		Ar.Logf(TEXT("AccelByte parallel task admission: in flight %d/%d, background limit %d%%, overflow cap %d (shedding: %s)")
+			, InFlightParallelTaskNum
+			, MaxInFlightParallelTasks
+			, BackgroundTaskAdmissionPercent
+			, MaxOverflowTasks
+			, LOG_BOOL_FORMAT(bShedOverflowTasks));
+		for (uint8 Index = 0; Index < static_cast<uint8>(EAccelByteAsyncTaskPriority::Num); Index++)
+		{
+			const FAccelByteAsyncTaskAdmissionStats& Stats = AdmissionStats[Index];
+			Ar.Logf(TEXT("    %-11s waiting %d (peak %d), admitted %llu, overflowed %llu, shed %llu")
+				, *AsyncTaskPriorityToString(static_cast<EAccelByteAsyncTaskPriority>(Index))
+				, OverflowTasks[Index].Num()
+				, Stats.PeakOverflowNum
+				, Stats.AdmittedCount
+				, Stats.OverflowedCount
+				, Stats.ShedCount);
+		}
+		return true;
+	}
+
+	return false;
+}
+
+FOnlineAsyncTaskAccelByte* FOnlineAsyncTaskManagerAccelByte::FindTrackedTask(FOnlineAsyncItem* Item)
+{
+	FScopeLock ScopeLock(&TrackedTasksLock);
+	FOnlineAsyncTaskAccelByte* const* Task = TrackedTasks.Find(Item);
+	return Task != nullptr ? *Task : nullptr;
+}
+
+FOnlineAsyncTaskAccelByte* FOnlineAsyncTaskManagerAccelByte::UntrackItem(FOnlineAsyncItem* Item)
+{
+	FScopeLock ScopeLock(&TrackedTasksLock);
+	FOnlineAsyncTaskAccelByte* Task = nullptr;
+	TrackedTasks.RemoveAndCopyValue(Item, Task);
+	return Task;
+}
+
+void FOnlineAsyncTaskManagerAccelByte::RecordServiceOutcome(FOnlineAsyncTaskAccelByte* Task)
+{
+	const FName& ServiceName = Task->GetRetryPolicy().ServiceName;
+	if (ServiceName.IsNone())
+	{
+		return;
+	}
+
+	// Failed requests are recorded by the task itself as they happen, only the final outcome of the task is left here.
+	// Rejected tasks never reached the service, and cancelled tasks say nothing about its health.
+	switch (Task->GetCompleteState())
+	{
+	case EAccelByteAsyncTaskCompleteState::Success:
+		CircuitBreakers->RecordSuccess(ServiceName);
+		break;
+	case EAccelByteAsyncTaskCompleteState::TimedOut:
+		CircuitBreakers->RecordFailure(ServiceName);
+		break;
+	default:
+		break;
+	}
+}
+
+void FOnlineAsyncTaskManagerAccelByte::RecordTaskSamples(FOnlineAsyncTaskAccelByte* Task, double DrainTimeInSeconds, double DelegateTimeInSeconds)
+{
+	const FString MetricsName = Task->GetMetricsName();
+	const double InitializedTime = Task->GetInitializedTimeInSeconds();
+	const double CompletedTime = Task->GetCompletedTimeInSeconds();
+
+	// Tasks that never called the super Initialize don't have a start time, skip the phases we can't measure for them
+	if (InitializedTime > 0.0)
+	{
+		TaskMetrics.RecordSample(MetricsName, EAccelByteAsyncTaskPhase::Queued, InitializedTime - Task->GetCreatedTimeInSeconds());
+		if (CompletedTime > 0.0)
+		{
+			TaskMetrics.RecordSample(MetricsName, EAccelByteAsyncTaskPhase::Execution, CompletedTime - InitializedTime);
+		}
+	}
+
+	if (CompletedTime > 0.0)
+	{
+		TaskMetrics.RecordSample(MetricsName, EAccelByteAsyncTaskPhase::Dispatch, DrainTimeInSeconds - CompletedTime);
+	}
+
+	TaskMetrics.RecordSample(MetricsName, EAccelByteAsyncTaskPhase::Delegates, DelegateTimeInSeconds);
+	TaskMetrics.RecordOutcome(MetricsName, Task->WasSuccessful());
+}
@@ -284,7 +284,7 @@ bool FOnlineChatAccelByte::SendRoomChat(const FUniqueNetId& UserId, const FChatR
 		}
 	}
 
-	AccelByteSubsystemPtr->CreateAndDispatchAsyncTaskParallel<FOnlineAsyncTaskAccelByteChatSendRoomChat>(AccelByteSubsystemPtr.Get(), UserId, RoomId, MsgBody);
+	AccelByteSubsystemPtr->CreateAndDispatchAsyncTaskParallelWithPriority<FOnlineAsyncTaskAccelByteChatSendRoomChat>(EAccelByteAsyncTaskPriority::Interactive, AccelByteSubsystemPtr.Get(), UserId, RoomId, MsgBody);
 
 	AB_OSS_PTR_INTERFACE_TRACE_END(TEXT(""));
 
@@ -312,7 +312,7 @@ bool FOnlineChatAccelByte::SendPrivateChat(const FUniqueNetId& UserId, const FUn
 		}
 	}
 
-	AccelByteSubsystemPtr->CreateAndDispatchAsyncTaskParallel<FOnlineAsyncTaskAccelByteChatSendPersonalChat>(AccelByteSubsystemPtr.Get(), UserId, RecipientId, MsgBody);
+	AccelByteSubsystemPtr->CreateAndDispatchAsyncTaskParallelWithPriority<FOnlineAsyncTaskAccelByteChatSendPersonalChat>(EAccelByteAsyncTaskPriority::Interactive, AccelByteSubsystemPtr.Get(), UserId, RecipientId, MsgBody);
 
 	AB_OSS_PTR_INTERFACE_TRACE_END(TEXT(""));
 
@@ -413,7 +413,7 @@ bool FOnlineChatAccelByte::GetSystemMessageStats(const FUniqueNetId& UserId, con
 		return false;
 	}
 	
-	AccelByteSubsystemPtr->CreateAndDispatchAsyncTaskParallel<FOnlineAsyncTaskAccelByteChatGetSystemMessagesStats>(AccelByteSubsystemPtr.Get(), UserId, Request);
+	AccelByteSubsystemPtr->CreateAndDispatchAsyncTaskParallelWithPriority<FOnlineAsyncTaskAccelByteChatGetSystemMessagesStats>(EAccelByteAsyncTaskPriority::Background, AccelByteSubsystemPtr.Get(), UserId, Request);
 
 	AB_OSS_PTR_INTERFACE_TRACE_END(TEXT(""));
 
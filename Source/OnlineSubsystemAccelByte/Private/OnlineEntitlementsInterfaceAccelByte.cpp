@@ -167,7 +167,17 @@ bool FOnlineEntitlementsAccelByte::QueryEntitlements(const FUniqueNetId& UserId,
 		AB_OSS_PTR_INTERFACE_TRACE_END_VERBOSITY(Warning, TEXT("Failed, AccelbyteSubsystem is invalid"));
 		return false;
 	}
-	AccelByteSubsystemPtr->CreateAndDispatchAsyncTaskParallel<FOnlineAsyncTaskAccelByteQueryEntitlements>(AccelByteSubsystemPtr.Get(), UserId, Namespace, Page);
+
+	// Identical queries already in flight share the same task, and read the result from the entitlement cache. The
+	// completion delegates are multicast and already broadcast by the in-flight task, so joined queries have nothing
+	// left to run on completion.
+	FOnlineAsyncTaskInfo TaskInfo;
+	TaskInfo.Type = ETypeOfOnlineAsyncTask::Parallel;
+	const FString CoalescingKey = FAccelByteRequestCoalescer::MakeRequestKey(TEXT("FOnlineAsyncTaskAccelByteQueryEntitlements"), UserId.ToString()
+		, { FString::Printf(TEXT("Namespace=%s"), *Namespace), FString::Printf(TEXT("Start=%d"), Page.Start), FString::Printf(TEXT("Count=%d"), Page.Count) });
+	AccelByteSubsystemPtr->CreateAndDispatchCoalescedAsyncTask<FOnlineAsyncTaskAccelByteQueryEntitlements>(TaskInfo, CoalescingKey
+		, FAccelByteRequestCoalescer::FOnRequestComplete()
+		, AccelByteSubsystemPtr.Get(), UserId, Namespace, Page);
 	return true;
 }
 
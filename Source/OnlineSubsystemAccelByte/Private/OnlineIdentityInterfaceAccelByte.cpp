@@ -210,6 +210,17 @@ bool FOnlineIdentityAccelByte::Logout(int32 LocalUserNum, FString Reason)
 
 	LogoutReason = Reason;
 
+	// Results of tasks still in flight for this user are stale once they log out, free their slots right away
+	const FOnlineSubsystemAccelBytePtr SubsystemPin = AccelByteSubsystem.Pin();
+	if (SubsystemPin.IsValid())
+	{
+		const FOnlineAsyncTaskManagerAccelBytePtr AsyncTaskManager = SubsystemPin->GetAsyncTaskManager();
+		if (AsyncTaskManager.IsValid() && AsyncTaskManager->ShouldCancelTasksOnLogout())
+		{
+			AsyncTaskManager->CancelTasksForUser(LocalUserNum);
+		}
+	}
+
 	FVoidHandler OnLogoutSuccessDelegate = FVoidHandler::CreateThreadSafeSP(AsShared()
 		, &FOnlineIdentityAccelByte::OnLogout
 		, LocalUserNum
@@ -500,6 +511,7 @@ void FOnlineIdentityAccelByte::SetLoginStatus(const int32 LocalUserNum, const EL
 {
 	const ELoginStatus::Type OldStatus = GetLoginStatus(LocalUserNum);
 	LocalUserNumToLoginStatusMap.Add(LocalUserNum, NewStatus);
+	RefreshUserSlot(LocalUserNum);
 
 	if (LocalPlayerLoggingIn[LocalUserNum])
 	{
@@ -930,6 +942,7 @@ void FOnlineIdentityAccelByte::AddNewAuthenticatedUser(int32 LocalUserNum, const
 	LocalUserNumToLoginStatusMap.Emplace(LocalUserNum, ELoginStatus::NotLoggedIn);
 	NetIdToLocalUserNumMap.Emplace(UserId, LocalUserNum);
 	NetIdToOnlineAccountMap.Emplace(UserId, Account);
+	RefreshUserSlot(LocalUserNum);
 }
 
 #define ONLINE_ERROR_NAMESPACE "FOnlineAccelByteLogout"
@@ -995,6 +1008,34 @@ void FOnlineIdentityAccelByte::RemoveUserFromMappings(const int32 LocalUserNum)
 
 		LocalUserNumToNetIdMap.Remove(LocalUserNum);
 	}
+
+	FOnlineSubsystemAccelBytePtr AccelByteSubsystemPtr = AccelByteSubsystem.Pin();
+	if (AccelByteSubsystemPtr.IsValid())
+	{
+		AccelByteSubsystemPtr->GetUserSlotCache().Invalidate(LocalUserNum);
+	}
+}
+
+void FOnlineIdentityAccelByte::RefreshUserSlot(const int32 LocalUserNum)
+{
+	FOnlineSubsystemAccelBytePtr AccelByteSubsystemPtr = AccelByteSubsystem.Pin();
+	if (!AccelByteSubsystemPtr.IsValid())
+	{
+		return;
+	}
+
+	const TSharedRef<const FUniqueNetId>* UniqueId = LocalUserNumToNetIdMap.Find(LocalUserNum);
+	if (UniqueId == nullptr)
+	{
+		// Servers have a login status but no user, their tasks never resolve a user through the slot cache
+		AccelByteSubsystemPtr->GetUserSlotCache().Invalidate(LocalUserNum);
+		return;
+	}
+
+	const FUniqueNetIdAccelByteUserRef AccelByteUser = FUniqueNetIdAccelByteUser::CastChecked(*UniqueId);
+	const FAccelByteInstancePtr AccelByteInstance = AccelByteSubsystemPtr->GetAccelByteInstance().Pin();
+	const AccelByte::FApiClientPtr ApiClient = AccelByteInstance.IsValid() ? AccelByteInstance->GetApiClient(AccelByteUser->GetAccelByteId(), false) : nullptr;
+	AccelByteSubsystemPtr->GetUserSlotCache().Publish(LocalUserNum, ApiClient, AccelByteUser);
 }
 
 void FOnlineIdentityAccelByte::OnGetNativeUserPrivilegeComplete(const FUniqueNetId& UserId, EUserPrivileges::Type Privilege, uint32 PrivilegeResults, FOnGetUserPrivilegeCompleteDelegate OriginalDelegate, TSharedRef<const FUniqueNetIdAccelByteUser> AccelByteId)
@@ -1733,7 +1733,7 @@ bool FOnlinePartySystemAccelByte::LeaveParty(const FUniqueNetId& LocalUserId, co
 		return false;
 	}
 
-	AccelByteSubsystemPtr->CreateAndDispatchAsyncTaskParallel<FOnlineAsyncTaskAccelByteLeaveV1Party>(AccelByteSubsystemPtr.Get(), LocalUserId, PartyId, bSynchronizeLeave, Delegate);
+	AccelByteSubsystemPtr->CreateAndDispatchAsyncTaskParallelWithPriority<FOnlineAsyncTaskAccelByteLeaveV1Party>(EAccelByteAsyncTaskPriority::Interactive, AccelByteSubsystemPtr.Get(), LocalUserId, PartyId, bSynchronizeLeave, Delegate);
 	return true;
 }
 
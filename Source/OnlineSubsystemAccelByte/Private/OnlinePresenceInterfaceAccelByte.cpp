@@ -156,8 +156,15 @@ void FOnlinePresenceAccelByte::QueryPresence(const FUniqueNetId& User, const FOn
 	
 	int32 LocalUserNum = AccelByteSubsystemPtr->GetLocalUserNumCached();
 
-	// Async task to query presence from AccelByte backend
-	AccelByteSubsystemPtr->CreateAndDispatchAsyncTaskParallel<FOnlineAsyncTaskAccelByteQueryUserPresence>(AccelByteSubsystemPtr.Get(), User, Delegate, LocalUserNum);
+	// Async task to query presence from AccelByte backend, identical queries already in flight share the same task and
+	// read the result from the presence cache
+	FOnlineAsyncTaskInfo TaskInfo;
+	TaskInfo.Type = ETypeOfOnlineAsyncTask::Parallel;
+	TaskInfo.Priority = EAccelByteAsyncTaskPriority::Background;
+	const FString CoalescingKey = FAccelByteRequestCoalescer::MakeRequestKey(TEXT("FOnlineAsyncTaskAccelByteQueryUserPresence"), FString::FromInt(LocalUserNum), { User.ToString() });
+	AccelByteSubsystemPtr->CreateAndDispatchCoalescedAsyncTask<FOnlineAsyncTaskAccelByteQueryUserPresence>(TaskInfo, CoalescingKey
+		, [UserRef = User.AsShared(), Delegate](bool bWasSuccessful) { Delegate.ExecuteIfBound(UserRef.Get(), bWasSuccessful); }
+		, AccelByteSubsystemPtr.Get(), User, Delegate, LocalUserNum);
 }
 
 void FOnlinePresenceAccelByte::BulkQueryPresence(const FUniqueNetId& LocalUserId, const TArray<FUniqueNetIdRef>& UserIds)
@@ -169,7 +176,7 @@ void FOnlinePresenceAccelByte::BulkQueryPresence(const FUniqueNetId& LocalUserId
 		return;
 	}
 	
-	AccelByteSubsystemPtr->CreateAndDispatchAsyncTaskParallel<FOnlineAsyncTaskAccelByteBulkQueryUserPresence>(AccelByteSubsystemPtr.Get(), LocalUserId, UserIds);
+	AccelByteSubsystemPtr->CreateAndDispatchAsyncTaskParallelWithPriority<FOnlineAsyncTaskAccelByteBulkQueryUserPresence>(EAccelByteAsyncTaskPriority::Background, AccelByteSubsystemPtr.Get(), LocalUserId, UserIds);
 }
 
 EOnlineCachedResult::Type FOnlinePresenceAccelByte::GetCachedPresence(const FUniqueNetId& User, TSharedPtr<FOnlineUserPresence>& OutPresence) 
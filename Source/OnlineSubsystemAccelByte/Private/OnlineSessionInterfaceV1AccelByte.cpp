@@ -903,7 +903,7 @@ bool FOnlineSessionV1AccelByte::StartMatchmaking(const TArray<TSharedRef<const F
 	//CurrentPendingMatchData = FAccelBytePendingMatchInfo();
 	//SearchSettings->QuerySettings.Get(SETTING_GAMEMODE, CurrentPendingMatchData.GameMode);
 
-	AccelByteSubsystemPtr->CreateAndDispatchAsyncTaskParallel<FOnlineAsyncTaskAccelByteStartV1Matchmaking>(AccelByteSubsystemPtr.Get(), LocalPlayers, SessionName, NewSessionSettings, SearchSettings);
+	AccelByteSubsystemPtr->CreateAndDispatchAsyncTaskParallelWithPriority<FOnlineAsyncTaskAccelByteStartV1Matchmaking>(EAccelByteAsyncTaskPriority::Interactive, AccelByteSubsystemPtr.Get(), LocalPlayers, SessionName, NewSessionSettings, SearchSettings);
 	
 	return true;
 }
@@ -1389,7 +1389,7 @@ bool FOnlineSessionV1AccelByte::RegisterPlayers(FName SessionName, const TArray<
 	// We add both the session ID query and the register player task as serial so that we get the ID first, and then register a player
 	if (Session->bHosting && Session->SessionSettings.bIsDedicated && !Session->SessionInfo->GetSessionId().IsValid())
 	{
-		AccelByteSubsystemPtr->CreateAndDispatchAsyncTaskSerial<FOnlineAsyncTaskAccelByteGetDedicatedV1SessionId>(AccelByteSubsystemPtr.Get(), SessionName);
+		AccelByteSubsystemPtr->CreateAndDispatchAsyncTaskSerialInLane<FOnlineAsyncTaskAccelByteGetDedicatedV1SessionId>(EAccelByteAsyncTaskLane::Session, AccelByteSubsystemPtr.Get(), SessionName);
 	}
 
 	// TODO(damar): Delete check bHosting after there is fix in the BE
@@ -1409,7 +1409,7 @@ bool FOnlineSessionV1AccelByte::RegisterPlayers(FName SessionName, const TArray<
 
 		if (NewPlayers.Num() > 0)
 		{
-			AccelByteSubsystemPtr->CreateAndDispatchAsyncTaskSerial<FOnlineAsyncTaskAccelByteRegisterPlayersV1>(AccelByteSubsystemPtr.Get(), SessionName, NewPlayers, bWasInvited, false);
+			AccelByteSubsystemPtr->CreateAndDispatchAsyncTaskSerialInLane<FOnlineAsyncTaskAccelByteRegisterPlayersV1>(EAccelByteAsyncTaskLane::Session, AccelByteSubsystemPtr.Get(), SessionName, NewPlayers, bWasInvited, false);
 		}
 		else
 		{
@@ -1427,7 +1427,7 @@ bool FOnlineSessionV1AccelByte::RegisterPlayers(FName SessionName, const TArray<
 	if (Session->bHosting && Session->SessionSettings.bIsDedicated) 
 	{
 		// Get information about the session after the player has joined, used to get the latest session status for sending to the server
-		AccelByteSubsystemPtr->CreateAndDispatchAsyncTaskSerial<FOnlineAsyncTaskAccelByteRetrieveDedicatedV1SessionInfo>(AccelByteSubsystemPtr.Get(), SessionName);
+		AccelByteSubsystemPtr->CreateAndDispatchAsyncTaskSerialInLane<FOnlineAsyncTaskAccelByteRetrieveDedicatedV1SessionInfo>(EAccelByteAsyncTaskLane::Session, AccelByteSubsystemPtr.Get(), SessionName);
 	}
 	AB_OSS_PTR_INTERFACE_TRACE_END(TEXT("Spawned async tasks for registering %d players to '%s' session!"), Players.Num(), *SessionName.ToString());
 	return true;
@@ -1463,7 +1463,7 @@ bool FOnlineSessionV1AccelByte::UnregisterPlayers(FName SessionName, const TArra
 	// We add both the session ID query and the unregister player task as serial so that we get the ID first, and then unregister a player
 	if (Session->bHosting && Session->SessionSettings.bIsDedicated && !Session->SessionInfo->GetSessionId().IsValid())
 	{
-		AccelByteSubsystemPtr->CreateAndDispatchAsyncTaskSerial<FOnlineAsyncTaskAccelByteGetDedicatedV1SessionId>(AccelByteSubsystemPtr.Get(), SessionName);
+		AccelByteSubsystemPtr->CreateAndDispatchAsyncTaskSerialInLane<FOnlineAsyncTaskAccelByteGetDedicatedV1SessionId>(EAccelByteAsyncTaskLane::Session, AccelByteSubsystemPtr.Get(), SessionName);
 	}
 
 	// TODO(damar): Delete check bHosting after there is fix in the BE
@@ -1482,7 +1482,7 @@ bool FOnlineSessionV1AccelByte::UnregisterPlayers(FName SessionName, const TArra
 		}
 		if(QuitPlayers.Num() > 0)
 		{
-			AccelByteSubsystemPtr->CreateAndDispatchAsyncTaskSerial<FOnlineAsyncTaskAccelByteUnregisterPlayersV1>(AccelByteSubsystemPtr.Get(), SessionName, QuitPlayers);
+			AccelByteSubsystemPtr->CreateAndDispatchAsyncTaskSerialInLane<FOnlineAsyncTaskAccelByteUnregisterPlayersV1>(EAccelByteAsyncTaskLane::Session, AccelByteSubsystemPtr.Get(), SessionName, QuitPlayers);
 		}
 		else
 		{
@@ -1492,7 +1492,7 @@ bool FOnlineSessionV1AccelByte::UnregisterPlayers(FName SessionName, const TArra
 	if (Session->bHosting && Session->SessionSettings.bIsDedicated)
 	{
 		// Queue task to get updated session information after we removed a player from the queue
-		AccelByteSubsystemPtr->CreateAndDispatchAsyncTaskSerial<FOnlineAsyncTaskAccelByteRetrieveDedicatedV1SessionInfo>(AccelByteSubsystemPtr.Get(), SessionName);
+		AccelByteSubsystemPtr->CreateAndDispatchAsyncTaskSerialInLane<FOnlineAsyncTaskAccelByteRetrieveDedicatedV1SessionInfo>(EAccelByteAsyncTaskLane::Session, AccelByteSubsystemPtr.Get(), SessionName);
 	}
 
 	AB_OSS_PTR_INTERFACE_TRACE_END(TEXT("Spawned async tasks for unregistering %d players from '%s' session!"), Players.Num(), *SessionName.ToString());
@@ -1748,8 +1748,8 @@ void FOnlineSessionV1AccelByte::AppendSessionSettingsToPacket(FNboSerializeToBuf
 
 void FOnlineSessionV1AccelByte::ReadSessionFromPacket(FNboSerializeFromBufferAccelByte& Packet, FOnlineSession* Session)
 {
-	TSharedRef<FUniqueNetIdAccelByteUser> UniqueId = ConstCastSharedRef<FUniqueNetIdAccelByteUser>(FUniqueNetIdAccelByteUser::Invalid());
-	Packet >> *UniqueId
+	FUniqueNetIdAccelByteUserRef UniqueId = FUniqueNetIdAccelByteUser::Invalid();
+	Packet >> UniqueId
 		>> Session->OwningUserName
 		>> Session->NumOpenPrivateConnections
 		>> Session->NumOpenPublicConnections;
@@ -2067,12 +2067,12 @@ void FOnlineSessionV1AccelByte::EnqueueJoinableSession(FName SessionName, const
 	// If we do not have the ID of this session yet, then we want to queue a task serially to get the ID of the session before any other calls.
 	if (!Session->SessionInfo->GetSessionId().IsValid())
 	{
-		AccelByteSubsystemPtr->CreateAndDispatchAsyncTaskSerial<FOnlineAsyncTaskAccelByteGetDedicatedV1SessionId>(AccelByteSubsystemPtr.Get(), SessionName);
+		AccelByteSubsystemPtr->CreateAndDispatchAsyncTaskSerialInLane<FOnlineAsyncTaskAccelByteGetDedicatedV1SessionId>(EAccelByteAsyncTaskLane::Session, AccelByteSubsystemPtr.Get(), SessionName);
 	}
 
 	// Queue two tasks to first get the information about the session from the backend, and then to enqueue the session as joinable
-	AccelByteSubsystemPtr->CreateAndDispatchAsyncTaskSerial<FOnlineAsyncTaskAccelByteRetrieveDedicatedV1SessionInfo>(AccelByteSubsystemPtr.Get(), SessionName);
-	AccelByteSubsystemPtr->CreateAndDispatchAsyncTaskSerial<FOnlineAsyncTaskAccelByteEnqueueJoinableV1Session>(AccelByteSubsystemPtr.Get(), SessionName, Delegate);
+	AccelByteSubsystemPtr->CreateAndDispatchAsyncTaskSerialInLane<FOnlineAsyncTaskAccelByteRetrieveDedicatedV1SessionInfo>(EAccelByteAsyncTaskLane::Session, AccelByteSubsystemPtr.Get(), SessionName);
+	AccelByteSubsystemPtr->CreateAndDispatchAsyncTaskSerialInLane<FOnlineAsyncTaskAccelByteEnqueueJoinableV1Session>(EAccelByteAsyncTaskLane::Session, AccelByteSubsystemPtr.Get(), SessionName, Delegate);
 
 	AB_OSS_PTR_INTERFACE_TRACE_END(TEXT("Sent off tasks to enqueue joinable session on backend!"));
 }
@@ -2104,10 +2104,10 @@ void FOnlineSessionV1AccelByte::DequeueJoinableSession(FName SessionName, const
 	// If we do not have the ID of this session yet, then we want to queue a task serially to get the ID of the session.
 	if (!Session->SessionInfo->GetSessionId().IsValid())
 	{
-		AccelByteSubsystemPtr->CreateAndDispatchAsyncTaskSerial<FOnlineAsyncTaskAccelByteGetDedicatedV1SessionId>(AccelByteSubsystemPtr.Get(), SessionName);
+		AccelByteSubsystemPtr->CreateAndDispatchAsyncTaskSerialInLane<FOnlineAsyncTaskAccelByteGetDedicatedV1SessionId>(EAccelByteAsyncTaskLane::Session, AccelByteSubsystemPtr.Get(), SessionName);
 	}
 
-	AccelByteSubsystemPtr->CreateAndDispatchAsyncTaskSerial<FOnlineAsyncTaskAccelByteDequeueJoinableV1Session>(AccelByteSubsystemPtr.Get(), SessionName, Delegate);
+	AccelByteSubsystemPtr->CreateAndDispatchAsyncTaskSerialInLane<FOnlineAsyncTaskAccelByteDequeueJoinableV1Session>(EAccelByteAsyncTaskLane::Session, AccelByteSubsystemPtr.Get(), SessionName, Delegate);
 
 	AB_OSS_PTR_INTERFACE_TRACE_END(TEXT("Sent off tasks to dequeue joinable session from backend!"));
 }
@@ -2606,14 +2606,14 @@ bool FOnlineSessionV2AccelByte::LeaveSession(const FUniqueNetId& LocalUserId, co
 
 	if (SessionType == EAccelByteV2SessionType::GameSession)
 	{
-		AccelByteSubsystemPtr->CreateAndDispatchAsyncTaskParallel<FOnlineAsyncTaskAccelByteLeaveV2GameSession>(AccelByteSubsystemPtr.Get(), LocalUserId, SessionId, Delegate, bUserKicked);
+		AccelByteSubsystemPtr->CreateAndDispatchAsyncTaskParallelWithPriority<FOnlineAsyncTaskAccelByteLeaveV2GameSession>(EAccelByteAsyncTaskPriority::Interactive, AccelByteSubsystemPtr.Get(), LocalUserId, SessionId, Delegate, bUserKicked);
 	
 		AB_OSS_PTR_INTERFACE_TRACE_END(TEXT("Sending request to leave game session!"));
 		return true;
 	}
 	else if (SessionType == EAccelByteV2SessionType::PartySession)
 	{
-		AccelByteSubsystemPtr->CreateAndDispatchAsyncTaskParallel<FOnlineAsyncTaskAccelByteLeaveV2Party>(AccelByteSubsystemPtr.Get(), LocalUserId, SessionId, Delegate, bUserKicked);
+		AccelByteSubsystemPtr->CreateAndDispatchAsyncTaskParallelWithPriority<FOnlineAsyncTaskAccelByteLeaveV2Party>(EAccelByteAsyncTaskPriority::Interactive, AccelByteSubsystemPtr.Get(), LocalUserId, SessionId, Delegate, bUserKicked);
 		
 		AB_OSS_PTR_INTERFACE_TRACE_END(TEXT("Sending request to leave party session!"));
 		return true;
@@ -3727,7 +3727,7 @@ bool FOnlineSessionV2AccelByte::CancelMatchmaking(const FUniqueNetId& SearchingP
 		return true;
 	}
 
-	AccelByteSubsystemPtr->CreateAndDispatchAsyncTaskParallel<FOnlineAsyncTaskAccelByteCancelV2Matchmaking>(AccelByteSubsystemPtr.Get(), CurrentMatchmakingSearchHandle.ToSharedRef(), SessionName);
+	AccelByteSubsystemPtr->CreateAndDispatchAsyncTaskParallelWithPriority<FOnlineAsyncTaskAccelByteCancelV2Matchmaking>(EAccelByteAsyncTaskPriority::Interactive, AccelByteSubsystemPtr.Get(), CurrentMatchmakingSearchHandle.ToSharedRef(), SessionName);
 
 	AB_OSS_PTR_INTERFACE_TRACE_END(TEXT(""));
 	return true;
@@ -5377,7 +5377,7 @@ bool FOnlineSessionV2AccelByte::RestoreActiveSessions(const FUniqueNetId& LocalU
 		return false;
 	}
 	
-	AccelByteSubsystemPtr->CreateAndDispatchAsyncTaskParallel<FOnlineAsyncTaskAccelByteRestoreAllV2Sessions>(AccelByteSubsystemPtr.Get(), LocalUserId, Delegate);
+	AccelByteSubsystemPtr->CreateAndDispatchAsyncTaskParallelWithPriority<FOnlineAsyncTaskAccelByteRestoreAllV2Sessions>(EAccelByteAsyncTaskPriority::Background, AccelByteSubsystemPtr.Get(), LocalUserId, Delegate);
 	
 	AB_OSS_PTR_INTERFACE_TRACE_END(TEXT(""));
 	return true;
@@ -6118,7 +6118,7 @@ bool FOnlineSessionV2AccelByte::RefreshActiveSessions(const FOnRefreshActiveSess
 	TArray<FName> SessionNames;
 	Sessions.GetKeys(SessionNames);
 
-	AccelByteSubsystemPtr->CreateAndDispatchAsyncTaskParallel<FOnlineAsyncTaskAccelByteRefreshActiveSessions>(AccelByteSubsystemPtr.Get(), SessionNames, Delegate);
+	AccelByteSubsystemPtr->CreateAndDispatchAsyncTaskParallelWithPriority<FOnlineAsyncTaskAccelByteRefreshActiveSessions>(EAccelByteAsyncTaskPriority::Background, AccelByteSubsystemPtr.Get(), SessionNames, Delegate);
 	AB_OSS_PTR_INTERFACE_TRACE_END(TEXT("Sent off request to refresh active sessions with backend data!"));
 
 	return true;
@@ -6283,7 +6283,7 @@ bool FOnlineSessionV2AccelByte::IsCurrentUserEligiblePartyStorageAction(FUniqueN
 		return false;
 	}
 
-	if (!Session->LocalOwnerId->ToString().Equals(UserUniqueNetId->UniqueNetIdStr))
+	if (!Session->LocalOwnerId->ToString().Equals(UserUniqueNetId->ToString()))
 	{
 		return false;
 	}
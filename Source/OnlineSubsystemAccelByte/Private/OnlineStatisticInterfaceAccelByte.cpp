@@ -335,7 +335,7 @@ void FOnlineStatisticAccelByte::QueryStats(const FUniqueNetIdRef LocalUserId
 		return;
 	}
 	
-	AccelByteSubsystemPtr->CreateAndDispatchAsyncTaskParallel<FOnlineAsyncTaskAccelByteQueryStatsUsers>(AccelByteSubsystemPtr.Get()
+	AccelByteSubsystemPtr->CreateAndDispatchAsyncTaskParallelWithPriority<FOnlineAsyncTaskAccelByteQueryStatsUsers>(EAccelByteAsyncTaskPriority::Background, AccelByteSubsystemPtr.Get()
 		, LocalUserId
 		, StatsUsers
 		, StatsNames
@@ -366,7 +366,7 @@ void FOnlineStatisticAccelByte::QueryStats(int32 LocalUserNum
 		}
 		else
 		{
-			AccelByteSubsystemPtr->CreateAndDispatchAsyncTaskParallel<FOnlineAsyncTaskAccelByteQueryStatsUsers>(AccelByteSubsystemPtr.Get()
+			AccelByteSubsystemPtr->CreateAndDispatchAsyncTaskParallelWithPriority<FOnlineAsyncTaskAccelByteQueryStatsUsers>(EAccelByteAsyncTaskPriority::Background, AccelByteSubsystemPtr.Get()
 				, LocalUserNum
 				, StatsUsers
 				, StatsNames
@@ -49,9 +49,13 @@
 #include "OnlineSubsystemAccelByteUtils.h"
 #include "Core/AccelByteEntitlementTokenGenerator.h"
 #include "Interfaces/IPluginManager.h"
+#include "Utilities/AccelByteUniqueIdRegistry.h"
 
 #if WITH_DEV_AUTOMATION_TESTS
 #include "ExecTests/ExecTestBase.h"
+#include "ExecTests/ExecTestAsyncTaskBenchmark.h"
+#include "ExecTests/ExecTestUniqueIdEncodingBenchmark.h"
+#include "ExecTests/ExecTestUserCacheBenchmark.h"
 #endif
 
 using namespace AccelByte;
@@ -145,6 +149,7 @@ bool FOnlineSubsystemAccelByte::Init()
 	FAccelByteUtilities::LoadABConfigFallback(TEXT("OnlineSubsystemAccelByte"), TEXT("bAutoChatConnectAfterLoginSuccess"), bIsAutoChatConnectAfterLoginSuccess);
 	FAccelByteUtilities::LoadABConfigFallback(TEXT("OnlineSubsystemAccelByte"), TEXT("bMultipleLocalUsersEnabled"), bIsMultipleLocalUsersEnabled);
 	FAccelByteUtilities::LoadABConfigFallback(TEXT("OnlineSubsystemAccelByte"), TEXT("bNativePlatformTokenRefreshManually"), bNativePlatformTokenRefreshManually);
+	FAccelByteUtilities::LoadABConfigFallback(TEXT("OnlineSubsystemAccelByte"), TEXT("bEnableRequestCoalescing"), bIsRequestCoalescingEnabled);
 	
 	FString NativePlatformNameStr{};
 	FAccelByteUtilities::LoadABConfigFallback(TEXT("OnlineSubsystem"), TEXT("NativePlatformService"), NativePlatformNameStr);
@@ -260,6 +265,10 @@ bool FOnlineSubsystemAccelByte::Shutdown()
 	UserInterface.Reset();
 	ExternalUIInterface.Reset();
 	SessionInterface.Reset();
+	if (UserCache.IsValid())
+	{
+		UserCache->Shutdown();
+	}
 	UserCache.Reset();
 	AgreementInterface.Reset();
 	WalletInterface.Reset();
@@ -363,6 +372,21 @@ FOnlineUserCacheAccelBytePtr FOnlineSubsystemAccelByte::GetUserCache() const
 	return UserCache;
 }
 
+FOnlineAsyncTaskManagerAccelBytePtr FOnlineSubsystemAccelByte::GetAsyncTaskManager() const
+{
+	return AsyncTaskManager;
+}
+
+FAccelByteRequestCoalescer& FOnlineSubsystemAccelByte::GetRequestCoalescer()
+{
+	return RequestCoalescer;
+}
+
+bool FOnlineSubsystemAccelByte::IsRequestCoalescingEnabled() const
+{
+	return bIsRequestCoalescingEnabled;
+}
+
 IOnlineEntitlementsPtr FOnlineSubsystemAccelByte::GetEntitlementsInterface() const
 {
 	return EntitlementsInterface;
@@ -502,8 +526,93 @@ bool FOnlineSubsystemAccelByte::Exec(UWorld* InWorld, const TCHAR* Cmd, FOutputD
 		{
 			bWasHandled = UserInterface->TestExec(InWorld, Cmd, Ar);
 		}
+		else if (FParse::Command(&Cmd, TEXT("ASYNCTASK")) && FParse::Command(&Cmd, TEXT("BENCH")))
+		{
+			// Full command is ONLINE TEST ASYNCTASK BENCH <Scenario> [Options], see FExecTestAsyncTaskBenchmark
+			TArray<EAccelByteAsyncTaskBenchmarkScenario> Scenarios;
+			FExecTestAsyncTaskBenchmark::FSettings Settings;
+			if (FExecTestAsyncTaskBenchmark::ParseCommand(Cmd, Scenarios, Settings))
+			{
+				TSharedPtr<FExecTestAsyncTaskBenchmark> BenchmarkTest = MakeShared<FExecTestAsyncTaskBenchmark>(InWorld, InstanceName, Scenarios, Settings);
+				BenchmarkTest->Run();
+				AddExecTest(BenchmarkTest);
+			}
+			else
+			{
+				Ar.Logf(TEXT("Usage: ONLINE TEST ASYNCTASK BENCH <PARALLEL|SERIAL|EPIC|TIMEOUT|ALL> [COUNT=N] [WIDTH=N] [DEPTH=N] [TIMEOUT=Seconds] [FORMAT=CSV|JSON] [FILE=Path]"));
+			}
+			bWasHandled = true;
+		}
+		else if (FParse::Command(&Cmd, TEXT("NETID")) && FParse::Command(&Cmd, TEXT("BENCH")))
+		{
+			// Full command is ONLINE TEST NETID BENCH [Options], see FExecTestUniqueIdEncodingBenchmark
+			FExecTestUniqueIdEncodingBenchmark::FSettings Settings;
+			FExecTestUniqueIdEncodingBenchmark::ParseCommand(Cmd, Settings);
+			TSharedPtr<FExecTestUniqueIdEncodingBenchmark> BenchmarkTest = MakeShared<FExecTestUniqueIdEncodingBenchmark>(InWorld, InstanceName, Settings);
+			BenchmarkTest->Run();
+			AddExecTest(BenchmarkTest);
+			bWasHandled = true;
+		}
+		else if (FParse::Command(&Cmd, TEXT("USERCACHE")) && FParse::Command(&Cmd, TEXT("BENCH")))
+		{
+			// Full command is ONLINE TEST USERCACHE BENCH [Options], see FExecTestUserCacheBenchmark
+			FExecTestUserCacheBenchmark::FSettings Settings;
+			FExecTestUserCacheBenchmark::ParseCommand(Cmd, Settings);
+			TSharedPtr<FExecTestUserCacheBenchmark> BenchmarkTest = MakeShared<FExecTestUserCacheBenchmark>(InWorld, InstanceName, Settings);
+			BenchmarkTest->Run();
+			AddExecTest(BenchmarkTest);
+			bWasHandled = true;
+		}
 #endif
 	}
+	else if (FParse::Command(&Cmd, TEXT("ASYNCTASK")) && AsyncTaskManager.IsValid())
+	{
+		bWasHandled = AsyncTaskManager->Exec(InWorld, Cmd, Ar);
+	}
+	else if (FParse::Command(&Cmd, TEXT("COALESCING")))
+	{
+		if (FParse::Command(&Cmd, TEXT("RESET")))
+		{
+			RequestCoalescer.ResetStats();
+			Ar.Logf(TEXT("AccelByte request coalescing counters have been reset."));
+		}
+		else
+		{
+			Ar.Logf(TEXT("AccelByte request coalescing is %s, set bEnableRequestCoalescing to change it."), bIsRequestCoalescingEnabled ? TEXT("enabled") : TEXT("disabled"));
+			RequestCoalescer.Dump(Ar, FParse::Token(Cmd, false));
+		}
+		bWasHandled = true;
+	}
+	else if (FParse::Command(&Cmd, TEXT("NETIDS")))
+	{
+		if (FParse::Command(&Cmd, TEXT("RESET")))
+		{
+			FAccelByteUniqueIdRegistry::Get().ResetStats();
+			Ar.Logf(TEXT("AccelByte unique ID registry counters have been reset."));
+		}
+		else
+		{
+			if (FParse::Command(&Cmd, TEXT("EVICT")))
+			{
+				Ar.Logf(TEXT("Evicted %d released AccelByte unique IDs."), FAccelByteUniqueIdRegistry::Get().EvictExpired());
+			}
+			FAccelByteUniqueIdRegistry::Get().Dump(Ar);
+		}
+		bWasHandled = true;
+	}
+	else if (FParse::Command(&Cmd, TEXT("USERCACHE")) && UserCache.IsValid())
+	{
+		if (FParse::Command(&Cmd, TEXT("RESET")))
+		{
+			UserCache->ResetStats();
+			Ar.Logf(TEXT("AccelByte user cache counters have been reset."));
+		}
+		else
+		{
+			UserCache->Dump(Ar);
+		}
+		bWasHandled = true;
+	}
 	
 	// If we didn't handle any exec tests, then just pass handling to the super method
 	if (!bWasHandled)
@@ -536,6 +645,12 @@ bool FOnlineSubsystemAccelByte::Tick(float DeltaTime)
 		AsyncTaskManager->GameTick();
 	}
 
+	// After the async task manager, so that user queries made by this frame's completions are batched together
+	if (UserCache.IsValid())
+	{
+		UserCache->Tick(DeltaTime);
+	}
+
 	if (SessionInterface.IsValid())
 	{
 		SessionInterface->Tick(DeltaTime);
@@ -611,6 +726,8 @@ FOnlineAsyncEpicTaskAccelByte* FOnlineSubsystemAccelByte::CreateAndDispatchEpic(
 
 	uint32 EpicID = EpicCounter.Increment();
 	NewTask->SetEpicID(EpicID);
+	NewTask->SetCancellationToken(AsyncTaskManager->GetUserCancellationToken(LocalUserNum));
+	AsyncTaskManager->TrackTask(NewTask);
 	FOnlineAsyncTask* Upcast = static_cast<FOnlineAsyncTask*>(NewTask);
 	AsyncTaskManager->CheckMaxParallelTasks();
 	AsyncTaskManager->AddToParallelTasks(Upcast);
@@ -628,11 +745,33 @@ void FOnlineSubsystemAccelByte::CreateAndDispatchAsyncTaskImplementation(FOnline
 		return;
 	}
 
+	AccelByteNewTask->SetPriority(TaskInfo.Priority);
+	AsyncTaskManager->TrackTask(AccelByteNewTask);
+
+	// Nested tasks share the cancellation token of whatever spawned them, so that cancelling a flow reaches every task in it
 	if (ParentTaskForUpcomingTask != nullptr)
 	{
 		AccelByteNewTask->SetParentTask(ParentTaskForUpcomingTask);
-		//TODO cyclic checking 
-		//recursively check GetParentTask(...) , collect it, and detect it etc.
+		AccelByteNewTask->SetCancellationToken(ParentTaskForUpcomingTask->GetCancellationToken());
+		// Ordering between children of an Epic is owned by the Epic's dependency graph
+	}
+	else if (IsUpcomingEpicAlreadySet())
+	{
+		AccelByteNewTask->SetCancellationToken(EpicForUpcomingTask->GetCancellationToken());
+	}
+	else
+	{
+		AccelByteNewTask->SetCancellationToken(AsyncTaskManager->GetUserCancellationToken(GetSerialLaneUserNum(AccelByteNewTask)));
+	}
+
+	// Fail fast while the service of the task is known to be down, instead of waiting for yet another request to fail.
+	// This also covers Epic children, a rejected child is never added to the Epic graph so nothing ends up waiting on it.
+	if (!AsyncTaskManager->GetCircuitBreakers()->AllowRequest(AccelByteNewTask->GetRetryPolicy().ServiceName))
+	{
+		UE_LOG_AB(Warning, TEXT("Rejecting task %s, circuit breaker of service %s is open"), *AccelByteNewTask->GetMetricsName(), *AccelByteNewTask->GetRetryPolicy().ServiceName.ToString());
+		AccelByteNewTask->ForcefullySetRejectedState();
+		AsyncTaskManager->AddToOutQueue(NewTask);
+		return;
 	}
 
 	if (IsUpcomingEpicAlreadySet())
@@ -656,17 +795,42 @@ void FOnlineSubsystemAccelByte::CreateAndDispatchAsyncTaskImplementation(FOnline
 	switch (TaskInfo.Type)
 	{
 	case ETypeOfOnlineAsyncTask::Parallel:
-		AsyncTaskManager->CheckMaxParallelTasks();
-		AsyncTaskManager->AddToParallelTasks(NewTask);
+		AsyncTaskManager->AdmitParallelTask(AccelByteNewTask, TaskInfo.Priority);
 		break;
 	case ETypeOfOnlineAsyncTask::Serial:
-		AsyncTaskManager->AddToInQueue(NewTask);
+		if (TaskInfo.Lane != EAccelByteAsyncTaskLane::None && AsyncTaskManager->IsSerialLanesEnabled())
+		{
+			AsyncTaskManager->AddToSerialLane(GetSerialLaneUserNum(AccelByteNewTask), TaskInfo.Lane, NewTask);
+		}
+		else
+		{
+			AsyncTaskManager->AddToInQueue(NewTask);
+		}
 		break;
 	default:
 		break;
 	}
 }
 
+int32 FOnlineSubsystemAccelByte::GetSerialLaneUserNum(FOnlineAsyncTaskAccelByte* Task)
+{
+	int32 LaneUserNum = Task->GetLocalUserNum();
+	if (LaneUserNum != INVALID_CONTROLLERID || !IdentityInterface.IsValid())
+	{
+		return LaneUserNum;
+	}
+
+	// Tasks constructed with a user ID only resolve their local user num on Initialize, do it here so that they land in
+	// the same lane as tasks constructed with a local user num
+	const FUniqueNetIdAccelByteUserPtr TaskUserId = Task->GetTaskUserId();
+	if (TaskUserId.IsValid() && !IdentityInterface->GetLocalUserNum(TaskUserId.ToSharedRef().Get(), LaneUserNum))
+	{
+		LaneUserNum = INVALID_CONTROLLERID;
+	}
+
+	return LaneUserNum;
+}
+
 bool FOnlineSubsystemAccelByte::IsUpcomingEpicAlreadySet()
 {
 	return EpicForUpcomingTask != nullptr;
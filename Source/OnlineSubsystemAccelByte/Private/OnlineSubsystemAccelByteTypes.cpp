@@ -11,6 +11,8 @@
 #include "OnlineSubsystemAccelByteDefines.h"
 #include "Misc/Base64.h"
 #include "JsonObjectConverter.h"
+#include "Utilities/AccelByteUniqueIdEncoding.h"
+#include "Utilities/AccelByteUniqueIdRegistry.h"
 
 void FNotificationMessageManager::PublishToTopic(FString const& InTopic, const FAccelByteModelsNotificationMessage& InMessage, int32 InLocalUserNum)
 {
@@ -246,12 +248,18 @@ FUniqueNetIdAccelByteUser::FUniqueNetIdAccelByteUser(FAccelByteUniqueIdComposite
 	: FUniqueNetIdAccelByteResource(EncodedComposite, ACCELBYTE_USER_ID_TYPE)
 	, CompositeStructure(CompositeId)
 {
-	// Check if this ID is valid and cache it so that we can cut down on processing of the ID later
-	if (!bHasCachedValidState)
-	{
-		bCachedValidState = IsValid();
-		bHasCachedValidState = true;
-	}
+	// The encoded string was decoded into this composite by the caller, so only the AccelByte ID is left to check
+	bCachedValidState = IsAccelByteIDValid(CompositeStructure.Id);
+	bHasCachedValidState = true;
+}
+
+FUniqueNetIdAccelByteUser::FUniqueNetIdAccelByteUser(FAccelByteUniqueIdComposite const& CompositeId)
+	: FUniqueNetIdAccelByteResource(FString(), ACCELBYTE_USER_ID_TYPE)
+	, CompositeStructure(CompositeId)
+	, bIsEncoded(false)
+{
+	bCachedValidState = IsAccelByteIDValid(CompositeStructure.Id);
+	bHasCachedValidState = true;
 }
 
 FUniqueNetIdAccelByteUserRef FUniqueNetIdAccelByteUser::Create(FAccelByteUniqueIdComposite const& CompositeId)
@@ -262,24 +270,11 @@ FUniqueNetIdAccelByteUserRef FUniqueNetIdAccelByteUser::Create(FAccelByteUniqueI
 		return Invalid();
 	}
 
-	FString CompositeString;
-	if (!FJsonObjectConverter::UStructToJsonObjectString(CompositeId, CompositeString))
-	{
-		UE_LOG_AB(Warning, TEXT("Failed to convert composite structure for an FUniqueNetIdAccelByte to a JSON string!"));
-		return Invalid();
-	}
-
-	FString EncodedString = FBase64::Encode(CompositeString);
-	if (EncodedString.IsEmpty())
+	// Every later call shares the ID interned here, which is only encoded once its string form is first needed
+	return FAccelByteUniqueIdRegistry::Get().FindOrAdd(CompositeId, [&CompositeId]() -> FUniqueNetIdAccelByteUserRef
 	{
-		UE_LOG_AB(Warning, TEXT("Failed to encode composite structure for an FUniqueNetIdAccelByte to a Base64 string!"));
-		return Invalid();
-	}
-
-	FUniqueNetIdAccelByteUser* User = new FUniqueNetIdAccelByteUser(MoveTemp(EncodedString), ACCELBYTE_USER_ID_TYPE);
-	User->CompositeStructure = CompositeId;
-	
-	return MakeShareable(User);
+		return MakeShareable<FUniqueNetIdAccelByteUser const>(new FUniqueNetIdAccelByteUser(CompositeId));
+	});
 }
 
 FUniqueNetIdAccelByteUserRef FUniqueNetIdAccelByteUser::Create(FString const& InNetIdStr)
@@ -291,21 +286,25 @@ FUniqueNetIdAccelByteUserRef FUniqueNetIdAccelByteUser::Create(FString const& In
 		return Create(FAccelByteUniqueIdComposite(InNetIdStr));
 	}
 
-	// Check if this is a Base64 encoded string first before anything. If it is, then we want to check if we can parse
-	// JSON from it. If so, then we just want to pass it directly into a new instance of a FUniqueNetIdAccelByteUser.
-	// Otherwise, we want to pass the string directly as the AccelByte ID component of a new FUniqueNetIdAccelByteUser's
-	// encoded data.
-	FString DecodedString{};
-	FAccelByteUniqueIdComposite CompositeId{};
-
-	const bool bIsEncodedCompositeString = FBase64::Decode(InNetIdStr, DecodedString) &&
-		FJsonObjectConverter::JsonObjectStringToUStruct(DecodedString, &CompositeId, 0, 0);
-	if (!bIsEncodedCompositeString)
+	// Only decode the string the first time it is seen, every later call shares the ID interned then
+	return FAccelByteUniqueIdRegistry::Get().FindOrAddEncoded(InNetIdStr, [&InNetIdStr]() -> FUniqueNetIdAccelByteUserRef
 	{
-		return Create(FAccelByteUniqueIdComposite(InNetIdStr));
-	}
+		// Check if this is a Base64 encoded string first before anything. If it is, then we want to check if we can parse
+		// JSON from it. If so, then we just want to pass it directly into a new instance of a FUniqueNetIdAccelByteUser.
+		// Otherwise, we want to pass the string directly as the AccelByte ID component of a new FUniqueNetIdAccelByteUser's
+		// encoded data.
+		FString DecodedString{};
+		FAccelByteUniqueIdComposite CompositeId{};
+
+		const bool bIsEncodedCompositeString = FBase64::Decode(InNetIdStr, DecodedString) &&
+			FJsonObjectConverter::JsonObjectStringToUStruct(DecodedString, &CompositeId, 0, 0);
+		if (!bIsEncodedCompositeString)
+		{
+			return Create(FAccelByteUniqueIdComposite(InNetIdStr));
+		}
 
-	return MakeShareable<FUniqueNetIdAccelByteUser const>(new FUniqueNetIdAccelByteUser(CompositeId, InNetIdStr));
+		return MakeShareable<FUniqueNetIdAccelByteUser const>(new FUniqueNetIdAccelByteUser(CompositeId, InNetIdStr));
+	});
 }
 
 FUniqueNetIdAccelByteUserRef FUniqueNetIdAccelByteUser::Create(FUniqueNetId const& InNetId)
@@ -403,6 +402,29 @@ bool FUniqueNetIdAccelByteUser::IsValid() const
 	return true;
 }
 
+FString FUniqueNetIdAccelByteUser::ToString() const
+{
+	EnsureEncoded();
+	return UniqueNetIdStr;
+}
+
+const uint8* FUniqueNetIdAccelByteUser::GetBytes() const
+{
+	EnsureEncoded();
+	return FUniqueNetIdAccelByteResource::GetBytes();
+}
+
+int32 FUniqueNetIdAccelByteUser::GetSize() const
+{
+	EnsureEncoded();
+	return FUniqueNetIdAccelByteResource::GetSize();
+}
+
+uint32 FUniqueNetIdAccelByteUser::GetTypeHash() const
+{
+	return ::GetTypeHash(CompositeStructure.Id);
+}
+
 FString FUniqueNetIdAccelByteUser::ToDebugString() const
 {
 	// Apin: using FJsonObjectConverter::UStructToJsonObjectString make crashes when OSS shutdown
@@ -469,9 +491,15 @@ FAccelByteUniqueIdComposite FUniqueNetIdAccelByteUser::GetCompositeStructure() c
 
 bool FUniqueNetIdAccelByteUser::Compare(FUniqueNetId const& Other) const
 {
+	// Interned IDs are shared, so equal IDs are usually the same instance
+	if (&Other == this)
+	{
+		return true;
+	}
+
 	if (Other.GetType() == ACCELBYTE_USER_ID_TYPE)
 	{
-		const FUniqueNetIdAccelByteUserRef OtherCompositeId = FUniqueNetIdAccelByteUser::CastChecked(Other);
+		const FUniqueNetIdAccelByteUser* OtherCompositeId = static_cast<const FUniqueNetIdAccelByteUser*>(&Other);
 
 		// First check whether AccelByte IDs match, if they do then these IDs are definitely equal
 		if (GetAccelByteId() == OtherCompositeId->GetAccelByteId())
@@ -488,6 +516,7 @@ bool FUniqueNetIdAccelByteUser::Compare(FUniqueNetId const& Other) const
 		return false;
 	}
 
+	EnsureEncoded();
 	return FUniqueNetIdString::Compare(Other);
 }
 
@@ -521,6 +550,32 @@ void FUniqueNetIdAccelByteUser::DecodeIDElements()
 	}
 }
 
+void FUniqueNetIdAccelByteUser::EnsureEncoded() const
+{
+	if (bIsEncoded.load(std::memory_order_acquire))
+	{
+		return;
+	}
+
+	// Every ID is encoded at most once, so a single lock shared by all of them is enough
+	static FCriticalSection EncodeLock;
+	FScopeLock ScopeLock(&EncodeLock);
+	if (bIsEncoded.load(std::memory_order_relaxed))
+	{
+		return;
+	}
+
+	FString EncodedString = FAccelByteUniqueIdEncoding::EncodeLegacy(CompositeStructure);
+	if (EncodedString.IsEmpty())
+	{
+		UE_LOG_AB(Warning, TEXT("Failed to encode composite structure for an FUniqueNetIdAccelByte to a Base64 JSON string! ID composite object: %s"), *ToDebugString());
+	}
+
+	// Written once before being published through bIsEncoded, readers never see it change
+	const_cast<FUniqueNetIdAccelByteUser*>(this)->UniqueNetIdStr = MoveTemp(EncodedString);
+	bIsEncoded.store(true, std::memory_order_release);
+}
+
 #pragma endregion // FUniquneNetIdAccelByteUser
 
 #pragma region FOnlineSessionInfoAccelByte
@@ -10,7 +10,109 @@
 #include "AsyncTasks/User/OnlineAsyncTaskAccelByteQueryUsersByIds.h"
 #include "AsyncTasks/User/OnlineAsyncTaskAccelByteQueryUserProfile.h"
 #include "OnlineUserInterfaceAccelByte.h"
+#include "OnlineAsyncTaskManagerAccelByte.h"
 #include "OnlineSubsystemUtils.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("User Cache Entries"), STAT_AccelByteUserCacheEntries, STATGROUP_AccelByteOSS);
+DECLARE_MEMORY_STAT(TEXT("User Cache Memory"), STAT_AccelByteUserCacheMemory, STATGROUP_AccelByteOSS);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("User Cache IDs In Flight"), STAT_AccelByteUserCacheInFlightIds, STATGROUP_AccelByteOSS);
+DECLARE_DWORD_COUNTER_STAT(TEXT("User Cache Hits"), STAT_AccelByteUserCacheHits, STATGROUP_AccelByteOSS);
+DECLARE_DWORD_COUNTER_STAT(TEXT("User Cache Stale Hits"), STAT_AccelByteUserCacheStaleHits, STATGROUP_AccelByteOSS);
+DECLARE_DWORD_COUNTER_STAT(TEXT("User Cache Misses"), STAT_AccelByteUserCacheMisses, STATGROUP_AccelByteOSS);
+DECLARE_DWORD_COUNTER_STAT(TEXT("User Cache Purges"), STAT_AccelByteUserCachePurges, STATGROUP_AccelByteOSS);
+
+namespace
+{
+	/** Approximate memory held by a JSON value, counting strings by their length and containers recursively */
+	int64 EstimateJsonValueBytes(const TSharedPtr<FJsonValue>& Value)
+	{
+		if (!Value.IsValid())
+		{
+			return 0;
+		}
+
+		int64 Bytes = sizeof(FJsonValue);
+		switch (Value->Type)
+		{
+		case EJson::String:
+			Bytes += (Value->AsString().Len() + 1) * sizeof(TCHAR);
+			break;
+		case EJson::Array:
+			for (const TSharedPtr<FJsonValue>& Element : Value->AsArray())
+			{
+				Bytes += EstimateJsonValueBytes(Element);
+			}
+			break;
+		case EJson::Object:
+			if (const TSharedPtr<FJsonObject> Object = Value->AsObject())
+			{
+				Bytes += sizeof(FJsonObject) + Object->Values.GetAllocatedSize();
+				for (const TPair<FString, TSharedPtr<FJsonValue>>& Field : Object->Values)
+				{
+					Bytes += Field.Key.GetAllocatedSize() + EstimateJsonValueBytes(Field.Value);
+				}
+			}
+			break;
+		default:
+			break;
+		}
+		return Bytes;
+	}
+
+	/** Approximate memory held by a cached user, counting strings and arrays by their allocation */
+	int64 EstimateUserInfoBytes(const FAccelByteUserInfo& User)
+	{
+		int64 Bytes = sizeof(FAccelByteUserInfo);
+		Bytes += User.DisplayName.GetAllocatedSize();
+		Bytes += User.UniqueDisplayName.GetAllocatedSize();
+		Bytes += User.PublicCode.GetAllocatedSize();
+		Bytes += User.GameAvatarUrl.GetAllocatedSize();
+		Bytes += User.PublisherAvatarUrl.GetAllocatedSize();
+		Bytes += User.CustomAttributes.Values.GetAllocatedSize();
+		for (const TPair<FString, TSharedPtr<FJsonValue>>& Attribute : User.CustomAttributes.Values)
+		{
+			Bytes += Attribute.Key.GetAllocatedSize() + EstimateJsonValueBytes(Attribute.Value);
+		}
+		Bytes += User.LinkedPlatformInfo.GetAllocatedSize();
+		for (const FAccelByteLinkedUserInfo& LinkedInfo : User.LinkedPlatformInfo)
+		{
+			Bytes += LinkedInfo.DisplayName.GetAllocatedSize();
+			Bytes += LinkedInfo.PlatformId.GetAllocatedSize();
+			Bytes += LinkedInfo.AvatarUrl.GetAllocatedSize();
+		}
+		return Bytes;
+	}
+
+	/** Case sensitive hash of the data that callers see for a user, to tell whether a refresh changed anything */
+	uint32 HashUserInfoData(const FAccelByteUserInfo& User)
+	{
+		uint32 Hash = FCrc::StrCrc32(*User.DisplayName);
+		Hash = FCrc::StrCrc32(*User.UniqueDisplayName, Hash);
+		Hash = FCrc::StrCrc32(*User.PublicCode, Hash);
+		Hash = FCrc::StrCrc32(*User.GameAvatarUrl, Hash);
+		Hash = FCrc::StrCrc32(*User.PublisherAvatarUrl, Hash);
+		for (const TPair<FString, TSharedPtr<FJsonValue>>& Attribute : User.CustomAttributes.Values)
+		{
+			Hash = FCrc::StrCrc32(*Attribute.Key, Hash);
+
+			// Nested objects and arrays only count by their key
+			FString Value;
+			if (Attribute.Value.IsValid() && Attribute.Value->TryGetString(Value))
+			{
+				Hash = FCrc::StrCrc32(*Value, Hash);
+			}
+		}
+		for (const FAccelByteLinkedUserInfo& LinkedInfo : User.LinkedPlatformInfo)
+		{
+			Hash = FCrc::StrCrc32(*LinkedInfo.DisplayName, Hash);
+			Hash = FCrc::StrCrc32(*LinkedInfo.PlatformId, Hash);
+			Hash = FCrc::StrCrc32(*LinkedInfo.AvatarUrl, Hash);
+		}
+		return Hash;
+	}
+}
 
 FAccelByteUserPlatformLinkInformation::FAccelByteUserPlatformLinkInformation
 	(const FString& InUserId /*= TEXT("")*/)
@@ -199,6 +301,79 @@ void FOnlineUserCacheAccelByte::Init()
 		UE_LOG_AB(Verbose, TEXT("'TimeUntilStaleSeconds' is not specified in DefaultEngine.ini, or on command line. Defaulting to %d seconds."), TimeUntilStaleSecondsInt);
 	}
 	TimeUntilStaleSeconds = static_cast<double>(TimeUntilStaleSecondsInt);
+
+	int32 UserCachePurgeTimeoutSecondsInt { static_cast<int32>(UserCachePurgeTimeoutSeconds) };
+	FAccelByteUtilities::LoadABConfigFallback(TEXT("OnlineSubsystemAccelByte"), TEXT("UserCachePurgeTimeoutSeconds"), UserCachePurgeTimeoutSecondsInt);
+	UserCachePurgeTimeoutSeconds = static_cast<double>(UserCachePurgeTimeoutSecondsInt);
+
+	// Using int here as 'LoadABConfigFallback' does not have an override for int64 values
+	int32 UserCacheMaxKilobytes { 0 };
+	FAccelByteUtilities::LoadABConfigFallback(TEXT("OnlineSubsystemAccelByte"), TEXT("UserCacheMaxEntries"), UserCacheMaxEntries);
+	FAccelByteUtilities::LoadABConfigFallback(TEXT("OnlineSubsystemAccelByte"), TEXT("UserCacheMaxKilobytes"), UserCacheMaxKilobytes);
+	FAccelByteUtilities::LoadABConfigFallback(TEXT("OnlineSubsystemAccelByte"), TEXT("UserCacheMaxEvictionsPerTick"), UserCacheMaxEvictionsPerTick);
+	UserCacheMaxBytes = static_cast<int64>(FMath::Max(UserCacheMaxKilobytes, 0)) * 1024;
+	UserCacheMaxEvictionsPerTick = FMath::Max(UserCacheMaxEvictionsPerTick, 1);
+
+	FAccelByteUtilities::LoadABConfigFallback(TEXT("OnlineSubsystemAccelByte"), TEXT("bEnableUserQueryBatching"), bEnableUserQueryBatching);
+
+	int32 UserQueryBatchWindowMs { 0 };
+	FAccelByteUtilities::LoadABConfigFallback(TEXT("OnlineSubsystemAccelByte"), TEXT("UserQueryBatchWindowMs"), UserQueryBatchWindowMs);
+	UserQueryBatchWindowSeconds = FMath::Max(UserQueryBatchWindowMs, 0) / 1000.0;
+
+	FAccelByteUtilities::LoadABConfigFallback(TEXT("OnlineSubsystemAccelByte"), TEXT("UserQueryMaxConcurrentRequests"), UserQueryMaxConcurrentRequests);
+	UserQueryMaxConcurrentRequests = FMath::Max(UserQueryMaxConcurrentRequests, 1);
+
+	FAccelByteUtilities::LoadABConfigFallback(TEXT("OnlineSubsystemAccelByte"), TEXT("bEnableStaleWhileRevalidate"), bEnableStaleWhileRevalidate);
+
+	FAccelByteUtilities::LoadABConfigFallback(TEXT("OnlineSubsystemAccelByte"), TEXT("bEnableUserCacheSnapshot"), bEnableUserCacheSnapshot);
+	FAccelByteUtilities::LoadABConfigFallback(TEXT("OnlineSubsystemAccelByte"), TEXT("UserCacheSnapshotMaxEntries"), UserCacheSnapshotMaxEntries);
+	UserCacheSnapshotMaxEntries = FMath::Max(UserCacheSnapshotMaxEntries, 0);
+
+	int32 UserCacheSnapshotMaxAgeSecondsInt { static_cast<int32>(UserCacheSnapshotMaxAgeSeconds) };
+	FAccelByteUtilities::LoadABConfigFallback(TEXT("OnlineSubsystemAccelByte"), TEXT("UserCacheSnapshotMaxAgeSeconds"), UserCacheSnapshotMaxAgeSecondsInt);
+	UserCacheSnapshotMaxAgeSeconds = static_cast<double>(FMath::Max(UserCacheSnapshotMaxAgeSecondsInt, 0));
+
+	if (bEnableUserCacheSnapshot)
+	{
+		SnapshotFilePath = FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("AccelByte"), TEXT("UserCache"), Subsystem->GetInstanceName().ToString() + TEXT(".bin"));
+		LoadSnapshot();
+	}
+}
+
+void FOnlineUserCacheAccelByte::Shutdown()
+{
+	if (bEnableUserCacheSnapshot)
+	{
+		SaveSnapshot();
+	}
+	Snapshot.Reset();
+}
+
+void FOnlineUserCacheAccelByte::Tick(float DeltaTime)
+{
+	TArray<TPair<int32, FUserQueryBatch>> DueBatches;
+	{
+		// Lock while we access the query batches
+		FScopeLock ScopeLock(&CacheLock);
+
+		const double CurrentTimeInSeconds = FPlatformTime::Seconds();
+		for (TMap<int32, FUserQueryBatch>::TIterator It(QueryBatches); It; ++It)
+		{
+			if (It.Value().DispatchTimeInSeconds <= CurrentTimeInSeconds)
+			{
+				DueBatches.Emplace(It.Key(), MoveTemp(It.Value()));
+				It.RemoveCurrent();
+			}
+		}
+	}
+
+	for (const TPair<int32, FUserQueryBatch>& DueBatch : DueBatches)
+	{
+		DispatchQueryBatch(DueBatch.Key, DueBatch.Value.AccelByteIds);
+	}
+
+	Purge();
+	UpdateStats();
 }
 
 bool FOnlineUserCacheAccelByte::GetFromSubsystem(const IOnlineSubsystem* Subsystem, FOnlineUserCacheAccelBytePtr& OutInterfaceInstance)
@@ -231,37 +406,40 @@ int32 FOnlineUserCacheAccelByte::Purge()
 	// Lock while we attempt to purge from the caches
 	FScopeLock ScopeLock(&CacheLock);
 
-	// Filter all of the users in the map that have gone past their elapsed time and aren't marked as important so we can
-	// purge them from the user cache maps
 	const double CurrentTimeInSeconds = FPlatformTime::Seconds();
+	int32 ItemsPurged = 0;
 
-	TMap<FString, FAccelByteUserInfoRef> FilteredUserMap;
-	FilteredUserMap.Reserve(AccelByteIdToUserInfoMap.Num());
-	for (const TPair<FString, FAccelByteUserInfoRef>& UserIdToUserInfo : AccelByteIdToUserInfoMap)
+	// Only look at a bounded number of users per call, whatever is left over is picked up on the next tick
+	for (int32 UsersExamined = 0; UsersExamined < UserCacheMaxEvictionsPerTick && EvictableUsers.Tail != nullptr; UsersExamined++)
 	{
-		const double ElapsedTimeInSeconds = CurrentTimeInSeconds - UserIdToUserInfo.Value->LastAccessedTimeInSeconds;
-		if (ElapsedTimeInSeconds >= UserCachePurgeTimeoutSeconds && !UserIdToUserInfo.Value->bIsImportant)
+		FAccelByteUserInfo& User = *EvictableUsers.Tail;
+
+		// Lookups only update the access time, so a user accessed since it was last moved gets moved to the head now
+		if (User.LastAccessedTimeInSeconds.load(std::memory_order_relaxed) > User.LruPositionTimeInSeconds)
 		{
-			FilteredUserMap.Add(UserIdToUserInfo);
+			TouchUserEntry(User);
+			continue;
 		}
-	}
-	
-	int32 ItemsPurged = 0;
 
-	// Now iterate through the users that we got back from the filter and remove them from the real maps
-	for (const TPair<FString, FAccelByteUserInfoRef>& UserIdToUserInfo : FilteredUserMap)
-	{
-		// Remove the user from the AccelByte ID cache map
-		TSharedPtr<const FAccelByteUserInfo, ESPMode::ThreadSafe> UserInfo = UserIdToUserInfo.Value;
-		AccelByteIdToUserInfoMap.Remove(UserIdToUserInfo.Key);
+		const bool bIsOverCapacity = (UserCacheMaxEntries > 0 && EvictableUsers.Num + ImportantUsers.Num > UserCacheMaxEntries)
+			|| (UserCacheMaxBytes > 0 && CachedUserBytes > UserCacheMaxBytes);
+		const double ElapsedTimeInSeconds = CurrentTimeInSeconds - User.LastAccessedTimeInSeconds.load(std::memory_order_relaxed);
+		if (!bIsOverCapacity && ElapsedTimeInSeconds < UserCachePurgeTimeoutSeconds)
+		{
+			// Every other user in the list has been accessed more recently than this one
+			break;
+		}
 
-		// Check if the user has a platform ID, if so format it and remove them from the platform cache
-		if (UserInfo->Id.IsValid() && UserInfo->Id->HasPlatformInformation())
+		if (bIsOverCapacity)
 		{
-			const FString PlatformId = ConvertPlatformTypeAndIdToCacheKey(UserInfo->Id->GetPlatformType(), UserInfo->Id->GetPlatformId());
-			PlatformIdToUserInfoMap.Remove(PlatformId);
+			EvictedCount.fetch_add(1, std::memory_order_relaxed);
+		}
+		else
+		{
+			ExpiredCount.fetch_add(1, std::memory_order_relaxed);
 		}
 
+		EvictUserEntry(User);
 		ItemsPurged++;
 	}
 
@@ -270,13 +448,10 @@ int32 FOnlineUserCacheAccelByte::Purge()
 
 bool FOnlineUserCacheAccelByte::IsUserCached(const FAccelByteUniqueIdComposite& Id)
 {
-	// Lock while we access the cache
-	FScopeLock ScopeLock(&CacheLock);
-
 	// Start by checking the cache for the user associated with the AccelByte ID, if we have one to query
 	if (!Id.Id.IsEmpty())
 	{
-		return AccelByteIdToUserInfoMap.Contains(Id.Id);
+		return FindOrRestoreUser(Id.Id).IsValid();
 	}
 
 	// Next, if we didn't already find the user using the AccelByte ID, and we have platform type and ID try and query by that
@@ -293,15 +468,15 @@ void FOnlineUserCacheAccelByte::GetQueryAndCacheArrays(const TArray<FString>& Ac
 {
 	for (const FString& AccelByteId : AccelByteIds)
 	{
-		const FAccelByteUserInfoRef* FoundCachedUser = AccelByteIdToUserInfoMap.Find(AccelByteId);
-		if (FoundCachedUser != nullptr)
+		const FAccelByteUserInfoPtr FoundCachedUser = FindOrRestoreUser(AccelByteId);
+		if (FoundCachedUser.IsValid())
 		{
 			// We have found a user in our cache, check if their data is stale
-			const bool bIsStale = bEnableStalenessChecking && IsUserDataStale(*(*FoundCachedUser)->Id.Get());
+			const bool bIsStale = bEnableStalenessChecking && IsUserDataStale(*FoundCachedUser->Id.Get());
 			if (!bIsStale)
 			{
 				// Data is not stale, return this user as a cached user and continue to next ID to check
-				UsersInCache.Add(*FoundCachedUser);
+				UsersInCache.Add(FoundCachedUser.ToSharedRef());
 				continue;
 			}
 
@@ -313,7 +488,7 @@ void FOnlineUserCacheAccelByte::GetQueryAndCacheArrays(const TArray<FString>& Ac
 	}
 }
 
-bool FOnlineUserCacheAccelByte::QueryUsersByAccelByteIds(int32 LocalUserNum, const TArray<FString>& AccelByteIds, const FOnQueryUsersComplete& Delegate, bool bIsImportant/*=false*/)
+bool FOnlineUserCacheAccelByte::QueryUsersByAccelByteIds(int32 LocalUserNum, const TArray<FString>& AccelByteIds, const FOnQueryUsersComplete& Delegate, bool bIsImportant/*=false*/, const FOnQueryUsersPartialResults& PartialDelegate/*=FOnQueryUsersPartialResults()*/)
 {
 	if (!FOnlineSubsystemAccelByteUtils::IsValidLocalUserNum(LocalUserNum))
 	{
@@ -341,13 +516,21 @@ bool FOnlineUserCacheAccelByte::QueryUsersByAccelByteIds(int32 LocalUserNum, con
 		return false;
 	}
 
+	// Only query the users that are neither cached nor already being queried by another call
+	TArray<FString> IdsToFetch;
+	AddQueryWaiter(FilteredIds, Delegate, PartialDelegate, bIsImportant, IdsToFetch);
+	if (IdsToFetch.Num() <= 0 || AddToQueryBatch(LocalUserNum, IdsToFetch))
+	{
+		return true;
+	}
+
 	//Run QueryUserProfile after QueryUsersByIds to get Info like FriendId
-	Subsystem->CreateAndDispatchAsyncTaskSerial<FOnlineAsyncTaskAccelByteQueryUsersByIds>(Subsystem, LocalUserNum, FilteredIds, bIsImportant, Delegate);
-	Subsystem->CreateAndDispatchAsyncTaskSerial<FOnlineAsyncTaskAccelByteQueryUserProfile>(Subsystem, LocalUserNum, FilteredIds, UserInterface->OnQueryUserProfileCompleteDelegates[LocalUserNum]);
+	Subsystem->CreateAndDispatchAsyncTaskSerialInLane<FOnlineAsyncTaskAccelByteQueryUsersByIds>(EAccelByteAsyncTaskLane::User, Subsystem, LocalUserNum, IdsToFetch, bIsImportant, MakePendingQueryDelegate(IdsToFetch), MakePendingQueryPartialDelegate());
+	Subsystem->CreateAndDispatchAsyncTaskSerialInLane<FOnlineAsyncTaskAccelByteQueryUserProfile>(EAccelByteAsyncTaskLane::User, Subsystem, LocalUserNum, IdsToFetch, UserInterface->OnQueryUserProfileCompleteDelegates[LocalUserNum]);
 	return true;
 }
 
-bool FOnlineUserCacheAccelByte::QueryUsersByPlatformIds(int32 LocalUserNum, const FString& PlatformType, const TArray<FString>& PlatformIds, const FOnQueryUsersComplete& Delegate, bool bIsImportant /*= false*/)
+bool FOnlineUserCacheAccelByte::QueryUsersByPlatformIds(int32 LocalUserNum, const FString& PlatformType, const TArray<FString>& PlatformIds, const FOnQueryUsersComplete& Delegate, bool bIsImportant /*= false*/, const FOnQueryUsersPartialResults& PartialDelegate /*= FOnQueryUsersPartialResults()*/)
 {
 	if (PlatformType.IsEmpty())
 	{
@@ -363,11 +546,12 @@ bool FOnlineUserCacheAccelByte::QueryUsersByPlatformIds(int32 LocalUserNum, cons
 		return false;
 	}
 
-	Subsystem->CreateAndDispatchAsyncTaskParallel<FOnlineAsyncTaskAccelByteQueryUsersByIds>(Subsystem, LocalUserNum, PlatformType, PlatformIds, bIsImportant, Delegate);
+	RecordPlatformIdLookups(PlatformType, PlatformIds);
+	Subsystem->CreateAndDispatchAsyncTaskParallel<FOnlineAsyncTaskAccelByteQueryUsersByIds>(Subsystem, LocalUserNum, PlatformType, PlatformIds, bIsImportant, MakePlatformQueryDelegate(Delegate), PartialDelegate);
 	return true;
 }
 
-bool FOnlineUserCacheAccelByte::QueryUsersByAccelByteIds(const FUniqueNetId& UserId, const TArray<FString>& AccelByteIds, const FOnQueryUsersComplete& Delegate, bool bIsImportant /*= false*/)
+bool FOnlineUserCacheAccelByte::QueryUsersByAccelByteIds(const FUniqueNetId& UserId, const TArray<FString>& AccelByteIds, const FOnQueryUsersComplete& Delegate, bool bIsImportant /*= false*/, const FOnQueryUsersPartialResults& PartialDelegate /*= FOnQueryUsersPartialResults()*/)
 {
 	// Remove all IDs that are not valid AccelByte IDs
 	TArray<FString> FilteredIds = AccelByteIds;
@@ -406,13 +590,21 @@ bool FOnlineUserCacheAccelByte::QueryUsersByAccelByteIds(const FUniqueNetId& Use
 		return false;
 	}
 	
+	// Only query the users that are neither cached nor already being queried by another call
+	TArray<FString> IdsToFetch;
+	AddQueryWaiter(FilteredIds, Delegate, PartialDelegate, bIsImportant, IdsToFetch);
+	if (IdsToFetch.Num() <= 0 || AddToQueryBatch(LocalUserNum, IdsToFetch))
+	{
+		return true;
+	}
+
 	//Run QueryUserProfile after QueryUsersByIds to get Info like FriendId
-	Subsystem->CreateAndDispatchAsyncTaskSerial<FOnlineAsyncTaskAccelByteQueryUsersByIds>(Subsystem, UserId, FilteredIds, bIsImportant, Delegate);
-	Subsystem->CreateAndDispatchAsyncTaskSerial<FOnlineAsyncTaskAccelByteQueryUserProfile>(Subsystem, UserId, FilteredIds, UserInterface->OnQueryUserProfileCompleteDelegates[LocalUserNum]);
+	Subsystem->CreateAndDispatchAsyncTaskSerialInLane<FOnlineAsyncTaskAccelByteQueryUsersByIds>(EAccelByteAsyncTaskLane::User, Subsystem, UserId, IdsToFetch, bIsImportant, MakePendingQueryDelegate(IdsToFetch), MakePendingQueryPartialDelegate());
+	Subsystem->CreateAndDispatchAsyncTaskSerialInLane<FOnlineAsyncTaskAccelByteQueryUserProfile>(EAccelByteAsyncTaskLane::User, Subsystem, UserId, IdsToFetch, UserInterface->OnQueryUserProfileCompleteDelegates[LocalUserNum]);
 	return true;
 }
 
-bool FOnlineUserCacheAccelByte::QueryUsersByPlatformIds(const FUniqueNetId& UserId, const FString& PlatformType, const TArray<FString>& PlatformIds, const FOnQueryUsersComplete& Delegate, bool bIsImportant /*= false*/)
+bool FOnlineUserCacheAccelByte::QueryUsersByPlatformIds(const FUniqueNetId& UserId, const FString& PlatformType, const TArray<FString>& PlatformIds, const FOnQueryUsersComplete& Delegate, bool bIsImportant /*= false*/, const FOnQueryUsersPartialResults& PartialDelegate /*= FOnQueryUsersPartialResults()*/)
 {
 	if (PlatformType.IsEmpty())
 	{
@@ -428,15 +620,13 @@ bool FOnlineUserCacheAccelByte::QueryUsersByPlatformIds(const FUniqueNetId& User
 		return false;
 	}
 
-	Subsystem->CreateAndDispatchAsyncTaskParallel<FOnlineAsyncTaskAccelByteQueryUsersByIds>(Subsystem, UserId, PlatformType, PlatformIds, bIsImportant, Delegate);
+	RecordPlatformIdLookups(PlatformType, PlatformIds);
+	Subsystem->CreateAndDispatchAsyncTaskParallel<FOnlineAsyncTaskAccelByteQueryUsersByIds>(Subsystem, UserId, PlatformType, PlatformIds, bIsImportant, MakePlatformQueryDelegate(Delegate), PartialDelegate);
 	return true;
 }
 
 TSharedPtr<const FAccelByteUserInfo, ESPMode::ThreadSafe> FOnlineUserCacheAccelByte::GetUser(const FUniqueNetId& UserId)
 {
-	// Lock while we access the cache
-	FScopeLock ScopeLock(&CacheLock);
-
 	// If this unique ID is an AccelByte composite ID already, then forward to the GetUser using the composite structure
 	if (UserId.GetType() == ACCELBYTE_USER_ID_TYPE)
 	{
@@ -446,11 +636,12 @@ TSharedPtr<const FAccelByteUserInfo, ESPMode::ThreadSafe> FOnlineUserCacheAccelB
 
 	// Otherwise, query as if it is a platform ID
 	const FString PlatformId = ConvertPlatformTypeAndIdToCacheKey(UserId.GetType().ToString(), UserId.ToString());
-	const FAccelByteUserInfoRef* FoundUserInfo = PlatformIdToUserInfoMap.Find(PlatformId);
-	if (FoundUserInfo != nullptr)
+	const FAccelByteUserInfoPtr FoundUserInfo = PlatformIdToUserInfoMap.Find(PlatformId);
+	RecordLookup(EAccelByteUserCacheEntryPoint::GetUser, FoundUserInfo.IsValid());
+	if (FoundUserInfo.IsValid())
 	{
-		(*FoundUserInfo)->LastAccessedTimeInSeconds = FPlatformTime::Seconds();
-		return *FoundUserInfo;
+		FoundUserInfo->LastAccessedTimeInSeconds.store(FPlatformTime::Seconds(), std::memory_order_relaxed);
+		return FoundUserInfo;
 	}
 
 	return nullptr;
@@ -458,35 +649,39 @@ TSharedPtr<const FAccelByteUserInfo, ESPMode::ThreadSafe> FOnlineUserCacheAccelB
 
 TSharedPtr<const FAccelByteUserInfo, ESPMode::ThreadSafe> FOnlineUserCacheAccelByte::GetUser(const FAccelByteUniqueIdComposite& UserId)
 {
-	// Lock while we access the cache
-	FScopeLock ScopeLock(&CacheLock);
+	const FAccelByteUserInfoPtr FoundUserInfo = FindUser(UserId);
+	RecordLookup(EAccelByteUserCacheEntryPoint::GetUser, FoundUserInfo.IsValid());
+	if (FoundUserInfo.IsValid())
+	{
+		FoundUserInfo->LastAccessedTimeInSeconds.store(FPlatformTime::Seconds(), std::memory_order_relaxed);
+		return FoundUserInfo;
+	}
 
+	return nullptr;
+}
+
+FAccelByteUserInfoPtr FOnlineUserCacheAccelByte::FindUser(const FAccelByteUniqueIdComposite& UserId)
+{
 	// Start by checking the cache for the user associated with the AccelByte ID, if we have one to query
-	FAccelByteUserInfoRef* FoundUserInfo = nullptr;
+	FAccelByteUserInfoPtr FoundUserInfo;
 	if (!UserId.Id.IsEmpty())
 	{
-		FoundUserInfo = AccelByteIdToUserInfoMap.Find(UserId.Id);
+		FoundUserInfo = FindOrRestoreUser(UserId.Id);
 	}
 
 	// Next, if we didn't already find the user using the AccelByte ID, and we have platform type and ID try and query by that
-	if (FoundUserInfo == nullptr && (!UserId.PlatformType.IsEmpty() && !UserId.PlatformId.IsEmpty()))
+	if (!FoundUserInfo.IsValid() && (!UserId.PlatformType.IsEmpty() && !UserId.PlatformId.IsEmpty()))
 	{
 		const FString PlatformId = ConvertPlatformTypeAndIdToCacheKey(UserId.PlatformType, UserId.PlatformId);
-		FAccelByteUserInfoRef* FoundUserInfoTemp = PlatformIdToUserInfoMap.Find(PlatformId);
+		const FAccelByteUserInfoPtr FoundUserInfoTemp = PlatformIdToUserInfoMap.Find(PlatformId);
 		// Check if platform accelbyte id is match with composite user id. If the same then set the user info from platform cache
-		if (FoundUserInfoTemp && FoundUserInfoTemp->Get().Id->GetAccelByteId() == UserId.Id)
+		if (FoundUserInfoTemp.IsValid() && FoundUserInfoTemp->Id->GetAccelByteId() == UserId.Id)
 		{
 			FoundUserInfo = FoundUserInfoTemp;
 		}
 	}
 
-	if (FoundUserInfo != nullptr)
-	{
-		(*FoundUserInfo)->LastAccessedTimeInSeconds = FPlatformTime::Seconds();
-		return *FoundUserInfo;
-	}
-
-	return nullptr;
+	return FoundUserInfo;
 }
 
 bool FOnlineUserCacheAccelByte::IsStalenessCheckEnabled() const
@@ -494,6 +689,11 @@ bool FOnlineUserCacheAccelByte::IsStalenessCheckEnabled() const
 	return bEnableStalenessChecking;
 }
 
+int32 FOnlineUserCacheAccelByte::GetUserQueryMaxConcurrentRequests() const
+{
+	return UserQueryMaxConcurrentRequests;
+}
+
 double FOnlineUserCacheAccelByte::GetTimeUntilStaleSeconds() const
 {
 	return TimeUntilStaleSeconds;
@@ -523,13 +723,13 @@ bool FOnlineUserCacheAccelByte::SetUserDataAsStale(const FUniqueNetId& UserUniqu
 
 bool FOnlineUserCacheAccelByte::SetUserDataAsStale(const FString& InAccelByteId)
 {
-	const FAccelByteUserInfoRef* FoundCachedUser = AccelByteIdToUserInfoMap.Find(InAccelByteId);
-	if (FoundCachedUser == nullptr)
+	const FAccelByteUserInfoPtr FoundCachedUser = AccelByteIdToUserInfoMap.Find(InAccelByteId);
+	if (!FoundCachedUser.IsValid())
 	{
 		return false;
 	}
 
-	(*FoundCachedUser)->bIsForcedStale = true;
+	FoundCachedUser->bIsForcedStale = true;
 	return true;
 }
 
@@ -547,62 +747,107 @@ bool FOnlineUserCacheAccelByte::IsUserDataStale(const FUniqueNetId& UserUniqueId
 
 bool FOnlineUserCacheAccelByte::IsUserDataStale(const FString& InAccelByteId)
 {
-	const FAccelByteUserInfoRef* FoundCachedUser = AccelByteIdToUserInfoMap.Find(InAccelByteId);
-	if (FoundCachedUser == nullptr)
+	const FAccelByteUserInfoPtr FoundCachedUser = AccelByteIdToUserInfoMap.Find(InAccelByteId);
+	if (!FoundCachedUser.IsValid())
 	{
 		return true;
 	}
 
-	if ((*FoundCachedUser)->bIsForcedStale)
+	if (FoundCachedUser->bIsForcedStale)
 	{
 		return true;
 	}
 
-	return ((*FoundCachedUser)->LastUpdatedTime + FTimespan::FromSeconds(GetTimeUntilStaleSeconds())) >= FDateTime::UtcNow();
+	return (FoundCachedUser->LastUpdatedTime + FTimespan::FromSeconds(GetTimeUntilStaleSeconds())) <= FDateTime::UtcNow();
 }
 
 void FOnlineUserCacheAccelByte::AddUsersToCache(const TArray<FAccelByteUserInfoRef>& UsersQueried)
 {
+	// Lock while we access the cache
+	FScopeLock ScopeLock(&CacheLock);
+
 	for (const FAccelByteUserInfoRef& User : UsersQueried)
 	{
-		if (User->PublicCode.IsEmpty())
-		{
-			const auto CachedUserInfo = GetUser(*User->Id.ToSharedRef());
-			if (CachedUserInfo.IsValid())
-			{
-				if (!CachedUserInfo->PublicCode.IsEmpty())
-				{
-					User->PublicCode = CachedUserInfo->PublicCode;
-				}
-			}
-		}
-
-		// Add the user to the AccelByte ID mapping cache first
-		if (AccelByteIdToUserInfoMap.Find(User->Id->GetAccelByteId()))
-		{
-			AccelByteIdToUserInfoMap[User->Id->GetAccelByteId()]->CopyValue(User.Get());
-		}
-		else
+		// Cached entries are handed out to readers that do not take any lock, so they are never updated in place. The
+		// queried instance takes their place instead, and is filled in here before the maps publish it.
+		const FAccelByteUserInfoPtr CachedUserInfo = FindUser(User->Id->GetCompositeStructure());
+		if (CachedUserInfo.Get() == &User.Get())
 		{
-			AccelByteIdToUserInfoMap.Emplace(User->Id->GetAccelByteId(), User);
+			User->LastAccessedTimeInSeconds.store(FPlatformTime::Seconds(), std::memory_order_relaxed);
+			TouchUserEntry(User.Get());
+			continue;
 		}
 
-		// Try and add the user to the platform mapping cache if they have platform information
-		if (User->Id->HasPlatformInformation())
+		if (CachedUserInfo.IsValid())
 		{
-			const FString PlatformId = ConvertPlatformTypeAndIdToCacheKey(User->Id->GetPlatformType(), User->Id->GetPlatformId());
-			if (PlatformIdToUserInfoMap.Find(PlatformId))
+			if (User->PublicCode.IsEmpty())
 			{
-				PlatformIdToUserInfoMap[PlatformId]->CopyValue(User.Get());
-			}
-			else
-			{
-				PlatformIdToUserInfoMap.Emplace(PlatformId, User);
+				User->PublicCode = CachedUserInfo->PublicCode;
 			}
+			User->LastUpdatedTime = FDateTime::UtcNow();
+			User->bIsForcedStale = false;
 		}
+
+		User->LastAccessedTimeInSeconds.store(FPlatformTime::Seconds(), std::memory_order_relaxed);
+		ReplaceUserEntry(User);
 	}
 }
 
+void FOnlineUserCacheAccelByte::ReplaceUserEntry(const FAccelByteUserInfoRef& User)
+{
+	const FString AccelByteId = User->Id->GetAccelByteId();
+	const FAccelByteUserInfoPtr ReplacedUser = AccelByteIdToUserInfoMap.Find(AccelByteId);
+	AccelByteIdToUserInfoMap.Add(AccelByteId, User);
+
+	FAccelByteUserInfoPtr ReplacedPlatformUser;
+	if (User->Id->HasPlatformInformation())
+	{
+		const FString PlatformId = ConvertPlatformTypeAndIdToCacheKey(User->Id->GetPlatformType(), User->Id->GetPlatformId());
+		ReplacedPlatformUser = PlatformIdToUserInfoMap.Find(PlatformId);
+		PlatformIdToUserInfoMap.Add(PlatformId, User);
+	}
+
+	UntrackReplacedEntry(ReplacedUser, User.Get());
+	if (ReplacedPlatformUser != ReplacedUser)
+	{
+		UntrackReplacedEntry(ReplacedPlatformUser, User.Get());
+	}
+	TouchUserEntry(User.Get());
+}
+
+void FOnlineUserCacheAccelByte::UntrackReplacedEntry(const FAccelByteUserInfoPtr& ReplacedUser, const FAccelByteUserInfo& User)
+{
+	if (!ReplacedUser.IsValid() || ReplacedUser.Get() == &User || !ReplacedUser->Id.IsValid())
+	{
+		return;
+	}
+
+	// The replaced instance stays tracked while one of its own keys still maps to it, such as a platform ID that the
+	// new instance does not have
+	const bool bIsStillMapped = AccelByteIdToUserInfoMap.Find(ReplacedUser->Id->GetAccelByteId()) == ReplacedUser
+		|| (ReplacedUser->Id->HasPlatformInformation()
+			&& PlatformIdToUserInfoMap.Find(ConvertPlatformTypeAndIdToCacheKey(ReplacedUser->Id->GetPlatformType(), ReplacedUser->Id->GetPlatformId())) == ReplacedUser);
+	if (bIsStillMapped)
+	{
+		return;
+	}
+
+	RemoveFromLru(*ReplacedUser);
+	CachedUserBytes -= ReplacedUser->EstimatedBytes;
+	ReplacedUser->EstimatedBytes = 0;
+}
+
+FAccelByteUserInfoRef FOnlineUserCacheAccelByte::CloneUserEntry(const FAccelByteUserInfo& User) const
+{
+	const FAccelByteUserInfoRef Clone = MakeShared<FAccelByteUserInfo, ESPMode::ThreadSafe>();
+	Clone->CopyValue(User);
+
+	// Only the fields being changed are fresh, keep the staleness of the rest
+	Clone->LastUpdatedTime = User.LastUpdatedTime;
+	Clone->bIsForcedStale = User.bIsForcedStale.load();
+	return Clone;
+}
+
 void FOnlineUserCacheAccelByte::AddPublicCodeToCache(const FUniqueNetId& UserId, const FString& PublicCode)
 {
 	// Lock while we access the cache
@@ -618,11 +863,13 @@ void FOnlineUserCacheAccelByte::AddPublicCodeToCache(const FUniqueNetId& UserId,
 
 	// Otherwise, query as if it is a platform ID
 	const FString PlatformId = ConvertPlatformTypeAndIdToCacheKey(UserId.GetType().ToString(), UserId.ToString());
-	const FAccelByteUserInfoRef* FoundUserInfo = PlatformIdToUserInfoMap.Find(PlatformId);
-	if (FoundUserInfo != nullptr)
+	const FAccelByteUserInfoPtr FoundUserInfo = PlatformIdToUserInfoMap.Find(PlatformId);
+	if (FoundUserInfo.IsValid())
 	{
-		(*FoundUserInfo)->LastAccessedTimeInSeconds = FPlatformTime::Seconds();
-		FoundUserInfo->Get().PublicCode = PublicCode;
+		// Cached entries are never updated in place, see AddUsersToCache
+		const FAccelByteUserInfoRef User = CloneUserEntry(*FoundUserInfo);
+		User->PublicCode = PublicCode;
+		ReplaceUserEntry(User);
 	}
 	else
 	{
@@ -641,23 +888,25 @@ void FOnlineUserCacheAccelByte::AddPublicCodeToCache(const FAccelByteUniqueIdCom
 	FScopeLock ScopeLock(&CacheLock);
 
 	// Start by checking the cache for the user associated with the AccelByte ID, if we have one to query
-	FAccelByteUserInfoRef* FoundUserInfo = nullptr;
+	FAccelByteUserInfoPtr FoundUserInfo;
 	if (!UserId.Id.IsEmpty())
 	{
 		FoundUserInfo = AccelByteIdToUserInfoMap.Find(UserId.Id);
 	}
 
 	// Next, if we didn't already find the user using the AccelByte ID, and we have platform type and ID try and query by that
-	if (FoundUserInfo == nullptr && (!UserId.PlatformType.IsEmpty() && !UserId.PlatformId.IsEmpty()))
+	if (!FoundUserInfo.IsValid() && (!UserId.PlatformType.IsEmpty() && !UserId.PlatformId.IsEmpty()))
 	{
 		const FString PlatformId = ConvertPlatformTypeAndIdToCacheKey(UserId.PlatformType, UserId.PlatformId);
 		FoundUserInfo = PlatformIdToUserInfoMap.Find(PlatformId);
 	}
 
-	if (FoundUserInfo != nullptr)
+	if (FoundUserInfo.IsValid())
 	{
-		(*FoundUserInfo)->LastAccessedTimeInSeconds = FPlatformTime::Seconds();
-		FoundUserInfo->Get().PublicCode = PublicCode;
+		// Cached entries are never updated in place, see AddUsersToCache
+		const FAccelByteUserInfoRef User = CloneUserEntry(*FoundUserInfo);
+		User->PublicCode = PublicCode;
+		ReplaceUserEntry(User);
 	}
 	else
 	{
@@ -684,11 +933,13 @@ void FOnlineUserCacheAccelByte::AddLinkedPlatformInfoToCache(const FUniqueNetId&
 
 	// Otherwise, query as if it is a platform ID
 	const FString PlatformId = ConvertPlatformTypeAndIdToCacheKey(UserId.GetType().ToString(), UserId.ToString());
-	const FAccelByteUserInfoRef* FoundUserInfo = PlatformIdToUserInfoMap.Find(PlatformId);
-	if (FoundUserInfo != nullptr)
+	const FAccelByteUserInfoPtr FoundUserInfo = PlatformIdToUserInfoMap.Find(PlatformId);
+	if (FoundUserInfo.IsValid())
 	{
-		(*FoundUserInfo)->LastAccessedTimeInSeconds = FPlatformTime::Seconds();
-		FoundUserInfo->Get().LinkedPlatformInfo = LinkedPlatformInfo;
+		// Cached entries are never updated in place, see AddUsersToCache
+		const FAccelByteUserInfoRef User = CloneUserEntry(*FoundUserInfo);
+		User->LinkedPlatformInfo = LinkedPlatformInfo;
+		ReplaceUserEntry(User);
 	}
 	else
 	{
@@ -707,23 +958,25 @@ void FOnlineUserCacheAccelByte::AddLinkedPlatformInfoToCache(const FAccelByteUni
 	FScopeLock ScopeLock(&CacheLock);
 
 	// Start by checking the cache for the user associated with the AccelByte ID, if we have one to query
-	FAccelByteUserInfoRef* FoundUserInfo = nullptr;
+	FAccelByteUserInfoPtr FoundUserInfo;
 	if (!UserId.Id.IsEmpty())
 	{
 		FoundUserInfo = AccelByteIdToUserInfoMap.Find(UserId.Id);
 	}
 
 	// Next, if we didn't already find the user using the AccelByte ID, and we have platform type and ID try and query by that
-	if (FoundUserInfo == nullptr && (!UserId.PlatformType.IsEmpty() && !UserId.PlatformId.IsEmpty()))
+	if (!FoundUserInfo.IsValid() && (!UserId.PlatformType.IsEmpty() && !UserId.PlatformId.IsEmpty()))
 	{
 		const FString PlatformId = ConvertPlatformTypeAndIdToCacheKey(UserId.PlatformType, UserId.PlatformId);
 		FoundUserInfo = PlatformIdToUserInfoMap.Find(PlatformId);
 	}
 
-	if (FoundUserInfo != nullptr)
+	if (FoundUserInfo.IsValid())
 	{
-		(*FoundUserInfo)->LastAccessedTimeInSeconds = FPlatformTime::Seconds();
-		FoundUserInfo->Get().LinkedPlatformInfo = LinkedPlatformInfo;
+		// Cached entries are never updated in place, see AddUsersToCache
+		const FAccelByteUserInfoRef User = CloneUserEntry(*FoundUserInfo);
+		User->LinkedPlatformInfo = LinkedPlatformInfo;
+		ReplaceUserEntry(User);
 	}
 	else
 	{
@@ -735,12 +988,605 @@ void FOnlineUserCacheAccelByte::AddLinkedPlatformInfoToCache(const FAccelByteUni
 	}
 }
 
+FAccelByteUserInfoPtr FOnlineUserCacheAccelByte::FShardedUserMap::Find(const FString& Key) const
+{
+	const FShard& Shard = GetShard(Key);
+	FReadScopeLock ReadLock(Shard.Lock);
+	const FAccelByteUserInfoRef* FoundUser = Shard.Users.Find(Key);
+	return FoundUser != nullptr ? FAccelByteUserInfoPtr(*FoundUser) : nullptr;
+}
+
+bool FOnlineUserCacheAccelByte::FShardedUserMap::Contains(const FString& Key) const
+{
+	const FShard& Shard = GetShard(Key);
+	FReadScopeLock ReadLock(Shard.Lock);
+	return Shard.Users.Contains(Key);
+}
+
+void FOnlineUserCacheAccelByte::FShardedUserMap::Add(const FString& Key, const FAccelByteUserInfoRef& User)
+{
+	FShard& Shard = GetShard(Key);
+	FWriteScopeLock WriteLock(Shard.Lock);
+	Shard.Users.Add(Key, User);
+}
+
+FAccelByteUserInfoPtr FOnlineUserCacheAccelByte::FShardedUserMap::RemoveIfSame(const FString& Key, const FAccelByteUserInfo& User)
+{
+	FAccelByteUserInfoPtr RemovedUser;
+
+	FShard& Shard = GetShard(Key);
+	FWriteScopeLock WriteLock(Shard.Lock);
+	const FAccelByteUserInfoRef* FoundUser = Shard.Users.Find(Key);
+	if (FoundUser != nullptr && &FoundUser->Get() == &User)
+	{
+		RemovedUser = *FoundUser;
+		Shard.Users.Remove(Key);
+	}
+	return RemovedUser;
+}
+
+int32 FOnlineUserCacheAccelByte::FShardedUserMap::Num() const
+{
+	int32 UserNum = 0;
+	for (const FShard& Shard : Shards)
+	{
+		FReadScopeLock ReadLock(Shard.Lock);
+		UserNum += Shard.Users.Num();
+	}
+	return UserNum;
+}
+
 FString FOnlineUserCacheAccelByte::ConvertPlatformTypeAndIdToCacheKey(const FString& Type, const FString& Id) const
 {
 	const FString PlatformId = FString::Printf(TEXT("%s;%s"), *Type, *Id);
 	return PlatformId;
 }
 
+void FOnlineUserCacheAccelByte::TouchUserEntry(FAccelByteUserInfo& User)
+{
+	const int64 EstimatedBytes = EstimateUserInfoBytes(User);
+	CachedUserBytes += EstimatedBytes - User.EstimatedBytes;
+	User.EstimatedBytes = EstimatedBytes;
+
+	// Also moves the user between lists if its importance has changed
+	RemoveFromLru(User);
+	User.LruPositionTimeInSeconds = User.LastAccessedTimeInSeconds.load(std::memory_order_relaxed);
+	AddToLruHead(User);
+}
+
+void FOnlineUserCacheAccelByte::EvictUserEntry(FAccelByteUserInfo& User)
+{
+	RemoveFromLru(User);
+	CachedUserBytes -= User.EstimatedBytes;
+	User.EstimatedBytes = 0;
+
+	if (!User.Id.IsValid())
+	{
+		return;
+	}
+
+	// Gather the keys first, the user may only be referenced by the maps
+	const FString AccelByteId = User.Id->GetAccelByteId();
+	const FString PlatformId = User.Id->HasPlatformInformation()
+		? ConvertPlatformTypeAndIdToCacheKey(User.Id->GetPlatformType(), User.Id->GetPlatformId())
+		: FString();
+
+	// Only remove the keys that still map to this instance, the platform map may hold another instance for the same user.
+	// Removed instances are held until both maps are updated, as removing the last map entry would free the user.
+	const FAccelByteUserInfoPtr RemovedPlatformUser = PlatformId.IsEmpty() ? nullptr : PlatformIdToUserInfoMap.RemoveIfSame(PlatformId, User);
+	const FAccelByteUserInfoPtr RemovedUser = AccelByteIdToUserInfoMap.RemoveIfSame(AccelByteId, User);
+}
+
+FAccelByteUserInfoPtr FOnlineUserCacheAccelByte::FindOrRestoreUser(const FString& AccelByteId)
+{
+	const FAccelByteUserInfoPtr FoundUser = AccelByteIdToUserInfoMap.Find(AccelByteId);
+	if (FoundUser.IsValid() || Snapshot.IsEmpty())
+	{
+		return FoundUser;
+	}
+
+	const FAccelByteUserInfoPtr RestoredUser = Snapshot.Take(AccelByteId);
+	if (RestoredUser.IsValid())
+	{
+		AddUsersToCache({ RestoredUser.ToSharedRef() });
+		RestoredCount.fetch_add(1, std::memory_order_relaxed);
+	}
+
+	// Another thread may have taken the record and be adding it right now
+	return AccelByteIdToUserInfoMap.Find(AccelByteId);
+}
+
+void FOnlineUserCacheAccelByte::LoadSnapshot()
+{
+	TArray<uint8> SnapshotBytes;
+	if (!FFileHelper::LoadFileToArray(SnapshotBytes, *SnapshotFilePath, FILEREAD_Silent))
+	{
+		UE_LOG_AB(Verbose, TEXT("No user cache snapshot found at %s"), *SnapshotFilePath);
+		return;
+	}
+
+	const FDateTime MinUpdatedTime = FDateTime::UtcNow() - FTimespan::FromSeconds(UserCacheSnapshotMaxAgeSeconds);
+	if (!Snapshot.Load(MoveTemp(SnapshotBytes), MinUpdatedTime))
+	{
+		UE_LOG_AB(Warning, TEXT("Ignoring user cache snapshot at %s as it is not of a supported version"), *SnapshotFilePath);
+		return;
+	}
+
+	UE_LOG_AB(Verbose, TEXT("Loaded user cache snapshot from %s"), *SnapshotFilePath);
+}
+
+void FOnlineUserCacheAccelByte::SaveSnapshot()
+{
+	const FDateTime MinUpdatedTime = FDateTime::UtcNow() - FTimespan::FromSeconds(UserCacheSnapshotMaxAgeSeconds);
+
+	TArray<uint8> SnapshotBytes;
+	FAccelByteUserCacheSnapshot::WriteHeader(SnapshotBytes);
+
+	TSet<FString> WrittenIds;
+	{
+		// Lock while we walk the LRU lists
+		FScopeLock ScopeLock(&CacheLock);
+
+		for (const FUserLruList* List : { &ImportantUsers, &EvictableUsers })
+		{
+			for (const FAccelByteUserInfo* User = List->Head; User != nullptr && WrittenIds.Num() < UserCacheSnapshotMaxEntries; User = User->LruNext)
+			{
+				// Users that were never queried, such as ones only given a public code, have nothing worth restoring
+				if (!User->Id.IsValid() || User->LastUpdatedTime < MinUpdatedTime)
+				{
+					continue;
+				}
+
+				bool bIsAlreadyWritten = false;
+				WrittenIds.Add(User->Id->GetAccelByteId(), &bIsAlreadyWritten);
+				if (!bIsAlreadyWritten)
+				{
+					FAccelByteUserCacheSnapshot::WriteRecord(*User, SnapshotBytes);
+				}
+			}
+		}
+	}
+
+	// Users of the previous session that were not looked up in this one are still worth keeping
+	const int32 RemainingNum = Snapshot.WriteRemainingRecords(WrittenIds, UserCacheSnapshotMaxEntries - WrittenIds.Num(), SnapshotBytes);
+
+	if (!FFileHelper::SaveArrayToFile(SnapshotBytes, *SnapshotFilePath))
+	{
+		UE_LOG_AB(Warning, TEXT("Failed to save user cache snapshot to %s"), *SnapshotFilePath);
+		return;
+	}
+
+	UE_LOG_AB(Verbose, TEXT("Saved %d users to user cache snapshot at %s"), WrittenIds.Num() + RemainingNum, *SnapshotFilePath);
+}
+
+void FOnlineUserCacheAccelByte::RecordLookup(EAccelByteUserCacheEntryPoint EntryPoint, bool bIsFound, bool bIsStale)
+{
+	FAtomicEntryPointStats& Stats = EntryPointStats[static_cast<int32>(EntryPoint)];
+	if (!bIsFound)
+	{
+		Stats.MissCount.fetch_add(1, std::memory_order_relaxed);
+	}
+	else if (bIsStale)
+	{
+		Stats.StaleHitCount.fetch_add(1, std::memory_order_relaxed);
+	}
+	else
+	{
+		Stats.HitCount.fetch_add(1, std::memory_order_relaxed);
+	}
+}
+
+void FOnlineUserCacheAccelByte::RecordPlatformIdLookups(const FString& PlatformType, const TArray<FString>& PlatformIds)
+{
+	for (const FString& PlatformId : PlatformIds)
+	{
+		const FAccelByteUserInfoPtr FoundUser = PlatformIdToUserInfoMap.Find(ConvertPlatformTypeAndIdToCacheKey(PlatformType, PlatformId));
+		const bool bIsStale = FoundUser.IsValid() && FoundUser->Id.IsValid() && bEnableStalenessChecking && IsUserDataStale(FoundUser->Id->GetAccelByteId());
+		RecordLookup(EAccelByteUserCacheEntryPoint::QueryUsersByPlatformIds, FoundUser.IsValid(), bIsStale);
+	}
+}
+
+FOnQueryUsersComplete FOnlineUserCacheAccelByte::MakePlatformQueryDelegate(const FOnQueryUsersComplete& Delegate)
+{
+	InFlightPlatformQueryNum.fetch_add(1, std::memory_order_relaxed);
+
+	// Forward to the caller even if the cache is gone by then
+	const TWeakPtr<FOnlineUserCacheAccelByte, ESPMode::ThreadSafe> UserCacheWeak = AsShared();
+	return FOnQueryUsersComplete::CreateLambda([UserCacheWeak, Delegate](bool bIsSuccessful, TArray<FAccelByteUserInfoRef> UsersQueried)
+	{
+		if (const TSharedPtr<FOnlineUserCacheAccelByte, ESPMode::ThreadSafe> UserCache = UserCacheWeak.Pin())
+		{
+			UserCache->InFlightPlatformQueryNum.fetch_sub(1, std::memory_order_relaxed);
+		}
+		Delegate.ExecuteIfBound(bIsSuccessful, UsersQueried);
+	});
+}
+
+FAccelByteUserCacheStats FOnlineUserCacheAccelByte::GetStats() const
+{
+	FAccelByteUserCacheStats Stats;
+	for (int32 Index = 0; Index < static_cast<int32>(EAccelByteUserCacheEntryPoint::Num); Index++)
+	{
+		Stats.EntryPoints[Index].HitCount = EntryPointStats[Index].HitCount.load(std::memory_order_relaxed);
+		Stats.EntryPoints[Index].StaleHitCount = EntryPointStats[Index].StaleHitCount.load(std::memory_order_relaxed);
+		Stats.EntryPoints[Index].MissCount = EntryPointStats[Index].MissCount.load(std::memory_order_relaxed);
+	}
+	Stats.ExpiredCount = ExpiredCount.load(std::memory_order_relaxed);
+	Stats.EvictedCount = EvictedCount.load(std::memory_order_relaxed);
+	Stats.RestoredCount = RestoredCount.load(std::memory_order_relaxed);
+	Stats.InFlightPlatformQueryNum = InFlightPlatformQueryNum.load(std::memory_order_relaxed);
+
+	// Lock while we read the LRU lists and the pending queries
+	FScopeLock ScopeLock(&CacheLock);
+	Stats.EntryNum = EvictableUsers.Num + ImportantUsers.Num;
+	Stats.ImportantNum = ImportantUsers.Num;
+	Stats.Bytes = CachedUserBytes;
+	Stats.InFlightIdNum = PendingQueryWaiters.Num();
+	return Stats;
+}
+
+void FOnlineUserCacheAccelByte::ResetStats()
+{
+	for (FAtomicEntryPointStats& Stats : EntryPointStats)
+	{
+		Stats.HitCount.store(0, std::memory_order_relaxed);
+		Stats.StaleHitCount.store(0, std::memory_order_relaxed);
+		Stats.MissCount.store(0, std::memory_order_relaxed);
+	}
+	ExpiredCount.store(0, std::memory_order_relaxed);
+	EvictedCount.store(0, std::memory_order_relaxed);
+	RestoredCount.store(0, std::memory_order_relaxed);
+	LastTickStats = FAccelByteUserCacheStats();
+}
+
+void FOnlineUserCacheAccelByte::Dump(FOutputDevice& Ar) const
+{
+	static const TCHAR* const EntryPointNames[] = { TEXT("QueryUsersByAccelByteIds"), TEXT("QueryUsersByPlatformIds"), TEXT("GetUser") };
+	static_assert(UE_ARRAY_COUNT(EntryPointNames) == static_cast<int32>(EAccelByteUserCacheEntryPoint::Num), "Every entry point needs a name");
+
+	const FAccelByteUserCacheStats Stats = GetStats();
+	Ar.Logf(TEXT("AccelByte user cache: users %d (%d important), %.1f KB, IDs in flight %d, platform queries in flight %d, expired %llu, evicted %llu, restored %llu")
+		, Stats.EntryNum
+		, Stats.ImportantNum
+		, Stats.Bytes / 1024.0
+		, Stats.InFlightIdNum
+		, Stats.InFlightPlatformQueryNum
+		, Stats.ExpiredCount
+		, Stats.EvictedCount
+		, Stats.RestoredCount);
+
+	for (int32 Index = 0; Index < static_cast<int32>(EAccelByteUserCacheEntryPoint::Num); Index++)
+	{
+		const FAccelByteUserCacheEntryPointStats& EntryPoint = Stats.EntryPoints[Index];
+		const uint64 LookupCount = EntryPoint.HitCount + EntryPoint.StaleHitCount + EntryPoint.MissCount;
+		Ar.Logf(TEXT("    %s: hits %llu, stale hits %llu, misses %llu, hit rate %.1f%%")
+			, EntryPointNames[Index]
+			, EntryPoint.HitCount
+			, EntryPoint.StaleHitCount
+			, EntryPoint.MissCount
+			, LookupCount > 0 ? 100.0 * EntryPoint.HitCount / LookupCount : 0.0);
+	}
+}
+
+void FOnlineUserCacheAccelByte::UpdateStats()
+{
+#if STATS
+	const FAccelByteUserCacheStats Stats = GetStats();
+
+	// Counters may have been reset since the last tick, in which case everything counted since is new
+	const auto GetDelta = [](uint64 Current, uint64 Last) { return static_cast<uint32>(Current >= Last ? Current - Last : Current); };
+
+	uint64 HitCount = 0, LastHitCount = 0;
+	uint64 StaleHitCount = 0, LastStaleHitCount = 0;
+	uint64 MissCount = 0, LastMissCount = 0;
+	for (int32 Index = 0; Index < static_cast<int32>(EAccelByteUserCacheEntryPoint::Num); Index++)
+	{
+		HitCount += Stats.EntryPoints[Index].HitCount;
+		StaleHitCount += Stats.EntryPoints[Index].StaleHitCount;
+		MissCount += Stats.EntryPoints[Index].MissCount;
+		LastHitCount += LastTickStats.EntryPoints[Index].HitCount;
+		LastStaleHitCount += LastTickStats.EntryPoints[Index].StaleHitCount;
+		LastMissCount += LastTickStats.EntryPoints[Index].MissCount;
+	}
+
+	SET_DWORD_STAT(STAT_AccelByteUserCacheEntries, Stats.EntryNum);
+	SET_MEMORY_STAT(STAT_AccelByteUserCacheMemory, Stats.Bytes);
+	SET_DWORD_STAT(STAT_AccelByteUserCacheInFlightIds, Stats.InFlightIdNum);
+	INC_DWORD_STAT_BY(STAT_AccelByteUserCacheHits, GetDelta(HitCount, LastHitCount));
+	INC_DWORD_STAT_BY(STAT_AccelByteUserCacheStaleHits, GetDelta(StaleHitCount, LastStaleHitCount));
+	INC_DWORD_STAT_BY(STAT_AccelByteUserCacheMisses, GetDelta(MissCount, LastMissCount));
+	INC_DWORD_STAT_BY(STAT_AccelByteUserCachePurges, GetDelta(Stats.ExpiredCount + Stats.EvictedCount, LastTickStats.ExpiredCount + LastTickStats.EvictedCount));
+
+	LastTickStats = Stats;
+#endif
+}
+
+void FOnlineUserCacheAccelByte::AddToLruHead(FAccelByteUserInfo& User)
+{
+	FUserLruList& List = User.bIsImportant ? ImportantUsers : EvictableUsers;
+	User.LruList = User.bIsImportant ? FAccelByteUserInfo::ELruList::Important : FAccelByteUserInfo::ELruList::Evictable;
+	User.LruPrev = nullptr;
+	User.LruNext = List.Head;
+	if (List.Head != nullptr)
+	{
+		List.Head->LruPrev = &User;
+	}
+	else
+	{
+		List.Tail = &User;
+	}
+	List.Head = &User;
+	List.Num++;
+}
+
+void FOnlineUserCacheAccelByte::RemoveFromLru(FAccelByteUserInfo& User)
+{
+	if (User.LruList == FAccelByteUserInfo::ELruList::None)
+	{
+		return;
+	}
+
+	FUserLruList& List = User.LruList == FAccelByteUserInfo::ELruList::Important ? ImportantUsers : EvictableUsers;
+	if (User.LruPrev != nullptr)
+	{
+		User.LruPrev->LruNext = User.LruNext;
+	}
+	else
+	{
+		List.Head = User.LruNext;
+	}
+	if (User.LruNext != nullptr)
+	{
+		User.LruNext->LruPrev = User.LruPrev;
+	}
+	else
+	{
+		List.Tail = User.LruPrev;
+	}
+	User.LruPrev = nullptr;
+	User.LruNext = nullptr;
+	User.LruList = FAccelByteUserInfo::ELruList::None;
+	List.Num--;
+}
+
+void FOnlineUserCacheAccelByte::AddQueryWaiter(const TArray<FString>& AccelByteIds, const FOnQueryUsersComplete& Delegate, const FOnQueryUsersPartialResults& PartialDelegate, bool bIsImportant, TArray<FString>& OutIdsToFetch)
+{
+	const FUserQueryWaiterRef Waiter = MakeShared<FUserQueryWaiter, ESPMode::ThreadSafe>();
+	Waiter->Delegate = Delegate;
+	Waiter->PartialDelegate = PartialDelegate;
+	Waiter->bIsImportant = bIsImportant;
+
+	{
+		// Lock while we access the cache and the pending queries
+		FScopeLock ScopeLock(&CacheLock);
+
+		TSet<FString> SeenIds;
+		SeenIds.Reserve(AccelByteIds.Num());
+		for (const FString& AccelByteId : AccelByteIds)
+		{
+			bool bIsAlreadySeen = false;
+			SeenIds.Add(AccelByteId, &bIsAlreadySeen);
+			if (bIsAlreadySeen)
+			{
+				continue;
+			}
+
+			const FAccelByteUserInfoPtr FoundCachedUser = FindOrRestoreUser(AccelByteId);
+			const bool bIsStale = FoundCachedUser.IsValid() && bEnableStalenessChecking && IsUserDataStale(AccelByteId);
+			RecordLookup(EAccelByteUserCacheEntryPoint::QueryUsersByAccelByteIds, FoundCachedUser.IsValid(), bIsStale);
+			if (FoundCachedUser.IsValid() && (!bIsStale || bEnableStaleWhileRevalidate))
+			{
+				Waiter->Users.Add(FoundCachedUser.ToSharedRef());
+
+				// Refresh stale users in the background, along with the IDs this caller claims, but nobody waits for it
+				if (bIsStale && !PendingQueryWaiters.Contains(AccelByteId))
+				{
+					PendingQueryWaiters.Add(AccelByteId, {});
+					RevalidatingUserHashes.Add(AccelByteId, HashUserInfoData(*FoundCachedUser));
+					OutIdsToFetch.Add(AccelByteId);
+				}
+				continue;
+			}
+
+			TArray<FUserQueryWaiterRef>* FoundWaiters = PendingQueryWaiters.Find(AccelByteId);
+			if (FoundWaiters != nullptr)
+			{
+				// Another call is already fetching this user, wait for it instead of querying it again
+				FoundWaiters->Add(Waiter);
+				Waiter->PendingNum++;
+				continue;
+			}
+
+			PendingQueryWaiters.Add(AccelByteId, { Waiter });
+			Waiter->PendingNum++;
+			OutIdsToFetch.Add(AccelByteId);
+		}
+	}
+
+	if (Waiter->PendingNum > 0)
+	{
+		return;
+	}
+
+	// Every user was cached, still answer on the next tick as callers expect the delegate to fire asynchronously
+	Subsystem->ExecuteNextTick([Waiter]()
+	{
+		Waiter->Delegate.ExecuteIfBound(true, Waiter->Users);
+	});
+}
+
+FOnQueryUsersComplete FOnlineUserCacheAccelByte::MakePendingQueryDelegate(const TArray<FString>& FetchedIds)
+{
+	return FOnQueryUsersComplete::CreateThreadSafeSP(AsShared(), &FOnlineUserCacheAccelByte::OnPendingQueryComplete, FetchedIds);
+}
+
+FOnQueryUsersPartialResults FOnlineUserCacheAccelByte::MakePendingQueryPartialDelegate()
+{
+	return FOnQueryUsersPartialResults::CreateThreadSafeSP(AsShared(), &FOnlineUserCacheAccelByte::OnPendingQueryPartialResults);
+}
+
+bool FOnlineUserCacheAccelByte::AddToQueryBatch(int32 LocalUserNum, const TArray<FString>& IdsToFetch)
+{
+	if (!bEnableUserQueryBatching)
+	{
+		return false;
+	}
+
+	FUserQueryBatch FullBatch;
+	{
+		// Lock while we access the query batches
+		FScopeLock ScopeLock(&CacheLock);
+
+		FUserQueryBatch* Batch = QueryBatches.Find(LocalUserNum);
+		if (Batch == nullptr)
+		{
+			Batch = &QueryBatches.Add(LocalUserNum);
+			Batch->DispatchTimeInSeconds = FPlatformTime::Seconds() + UserQueryBatchWindowSeconds;
+		}
+
+		// IDs are only ever claimed by one caller, so batches never hold duplicates
+		Batch->AccelByteIds.Append(IdsToFetch);
+
+		// No point in waiting for more calls once the batch fills a bulk query
+		if (Batch->AccelByteIds.Num() >= MaximumQueryLimit)
+		{
+			QueryBatches.RemoveAndCopyValue(LocalUserNum, FullBatch);
+		}
+	}
+
+	if (FullBatch.AccelByteIds.Num() > 0)
+	{
+		DispatchQueryBatch(LocalUserNum, FullBatch.AccelByteIds);
+	}
+	return true;
+}
+
+void FOnlineUserCacheAccelByte::DispatchQueryBatch(int32 LocalUserNum, const TArray<FString>& AccelByteIds)
+{
+	FOnlineUserAccelBytePtr UserInterface = StaticCastSharedPtr<FOnlineUserAccelByte>(Subsystem->GetUserInterface());
+	if (!UserInterface.IsValid())
+	{
+		UE_LOG_AB(Warning, TEXT("FOnlineUserStoreAccelByte::DispatchQueryBatch UserInterface is invalid, failing the %d batched IDs!"), AccelByteIds.Num());
+		OnPendingQueryComplete(false, TArray<FAccelByteUserInfoRef>(), AccelByteIds);
+		return;
+	}
+
+	// One task for the whole batch, as tasks of a lane run one after another while the chunks of a task run in parallel.
+	// Run QueryUserProfile after QueryUsersByIds to get Info like FriendId
+	Subsystem->CreateAndDispatchAsyncTaskSerialInLane<FOnlineAsyncTaskAccelByteQueryUsersByIds>(EAccelByteAsyncTaskLane::User, Subsystem, LocalUserNum, AccelByteIds, false, MakePendingQueryDelegate(AccelByteIds), MakePendingQueryPartialDelegate());
+	Subsystem->CreateAndDispatchAsyncTaskSerialInLane<FOnlineAsyncTaskAccelByteQueryUserProfile>(EAccelByteAsyncTaskLane::User, Subsystem, LocalUserNum, AccelByteIds, UserInterface->OnQueryUserProfileCompleteDelegates[LocalUserNum]);
+}
+
+void FOnlineUserCacheAccelByte::OnPendingQueryComplete(bool bWasSuccessful, TArray<FAccelByteUserInfoRef> QueriedUsers, TArray<FString> FetchedIds)
+{
+	TMap<FString, FAccelByteUserInfoRef> QueriedUsersById;
+	QueriedUsersById.Reserve(QueriedUsers.Num());
+	for (const FAccelByteUserInfoRef& User : QueriedUsers)
+	{
+		if (User->Id.IsValid())
+		{
+			QueriedUsersById.Add(User->Id->GetAccelByteId(), User);
+		}
+	}
+
+	TArray<FUserQueryWaiterRef> CompletedWaiters;
+	TMap<FUserQueryWaiterRef, TArray<FAccelByteUserInfoRef>> PartialUsersByWaiter;
+	TArray<FAccelByteUserInfoRef> ChangedUsers;
+	{
+		// Lock while we access the pending queries
+		FScopeLock ScopeLock(&CacheLock);
+
+		for (const FString& AccelByteId : FetchedIds)
+		{
+			// The query has already updated the cache, compare with what was returned while the user was stale
+			uint32 StaleHash = 0;
+			if (RevalidatingUserHashes.RemoveAndCopyValue(AccelByteId, StaleHash) && QueriedUsersById.Contains(AccelByteId))
+			{
+				const FAccelByteUserInfoPtr RefreshedUser = AccelByteIdToUserInfoMap.Find(AccelByteId);
+				if (RefreshedUser.IsValid() && HashUserInfoData(*RefreshedUser) != StaleHash)
+				{
+					ChangedUsers.Add(RefreshedUser.ToSharedRef());
+				}
+			}
+
+			TArray<FUserQueryWaiterRef> Waiters;
+			if (!PendingQueryWaiters.RemoveAndCopyValue(AccelByteId, Waiters))
+			{
+				continue;
+			}
+
+			const FAccelByteUserInfoRef* FoundUser = QueriedUsersById.Find(AccelByteId);
+			for (const FUserQueryWaiterRef& Waiter : Waiters)
+			{
+				if (FoundUser != nullptr)
+				{
+					// The query only knew whether its own caller wanted the user kept, honor the callers that joined it
+					if (Waiter->bIsImportant && !(*FoundUser)->bIsImportant)
+					{
+						(*FoundUser)->bIsImportant = true;
+
+						// Move the user out of the reach of purges, unless it never made it into the cache
+						if ((*FoundUser)->LruList != FAccelByteUserInfo::ELruList::None)
+						{
+							TouchUserEntry(FoundUser->Get());
+						}
+					}
+					Waiter->Users.Add(*FoundUser);
+					if (Waiter->PartialDelegate.IsBound())
+					{
+						PartialUsersByWaiter.FindOrAdd(Waiter).Add(*FoundUser);
+					}
+				}
+
+				Waiter->bWasSuccessful &= bWasSuccessful;
+				Waiter->PendingNum--;
+				if (Waiter->PendingNum == 0)
+				{
+					CompletedWaiters.Add(Waiter);
+				}
+			}
+		}
+
+		// Callers that got all of their users are answered by their completion delegate alone
+		for (const FUserQueryWaiterRef& Waiter : CompletedWaiters)
+		{
+			PartialUsersByWaiter.Remove(Waiter);
+		}
+	}
+
+	// Fire outside of the lock, as delegates are likely to query the cache again
+	for (const TPair<FUserQueryWaiterRef, TArray<FAccelByteUserInfoRef>>& PartialUsers : PartialUsersByWaiter)
+	{
+		PartialUsers.Key->PartialDelegate.ExecuteIfBound(PartialUsers.Value);
+	}
+
+	for (const FUserQueryWaiterRef& Waiter : CompletedWaiters)
+	{
+		Waiter->Delegate.ExecuteIfBound(Waiter->bWasSuccessful, Waiter->Users);
+	}
+
+	if (ChangedUsers.Num() > 0)
+	{
+		TriggerOnCachedUsersChangedDelegates(ChangedUsers);
+	}
+}
+
+void FOnlineUserCacheAccelByte::OnPendingQueryPartialResults(const TArray<FAccelByteUserInfoRef>& QueriedUsers)
+{
+	// Only the users that were found are resolved now, the ones that were not are resolved once the query completes
+	TArray<FString> FoundIds;
+	FoundIds.Reserve(QueriedUsers.Num());
+	for (const FAccelByteUserInfoRef& User : QueriedUsers)
+	{
+		if (User->Id.IsValid())
+		{
+			FoundIds.Add(User->Id->GetAccelByteId());
+		}
+	}
+
+	OnPendingQueryComplete(true, QueriedUsers, FoundIds);
+}
+
 void FAccelByteUserInfo::CopyValue(const FAccelByteUserInfo& Data)
 {
 	Id = Data.Id;
@@ -752,7 +1598,7 @@ void FAccelByteUserInfo::CopyValue(const FAccelByteUserInfo& Data)
 	CustomAttributes = Data.CustomAttributes;
 	LinkedPlatformInfo = Data.LinkedPlatformInfo;
 	bIsImportant = Data.bIsImportant;
-	LastAccessedTimeInSeconds = FPlatformTime::Seconds();
+	LastAccessedTimeInSeconds.store(FPlatformTime::Seconds(), std::memory_order_relaxed);
 	LastUpdatedTime = FDateTime::UtcNow();
 	bIsForcedStale = false;
 }
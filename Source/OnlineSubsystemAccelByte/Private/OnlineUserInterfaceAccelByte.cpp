@@ -158,10 +158,23 @@ if (!AccelByteSubsystemPtr.IsValid())
 		return false;
 	}
 
+	// Identical queries already in flight share the same task, and read the result from the user info cache. The
+	// completion delegates are multicast and already broadcast by the in-flight task, so joined queries have nothing
+	// left to run on completion.
+	TArray<FString> UserIdStrings;
+	UserIdStrings.Reserve(UserIds.Num());
+	for (const TSharedRef<const FUniqueNetId>& UserId : UserIds)
+	{
+		UserIdStrings.Emplace(UserId->ToString());
+	}
+
 	FOnlineAsyncTaskInfo TaskInfo;
 	TaskInfo.Type = ETypeOfOnlineAsyncTask::Parallel;
 	TaskInfo.bCreateEpicForThis = true;
-	AccelByteSubsystemPtr->CreateAndDispatchAsyncTask<FOnlineAsyncTaskAccelByteQueryUserInfo>(TaskInfo, AccelByteSubsystemPtr.Get(), LocalUserNum, UserIds, OnQueryUserInfoCompleteDelegates[LocalUserNum]);
+	const FString CoalescingKey = FAccelByteRequestCoalescer::MakeRequestKey(TEXT("FOnlineAsyncTaskAccelByteQueryUserInfo"), FString::FromInt(LocalUserNum), MoveTemp(UserIdStrings));
+	AccelByteSubsystemPtr->CreateAndDispatchCoalescedAsyncTask<FOnlineAsyncTaskAccelByteQueryUserInfo>(TaskInfo, CoalescingKey
+		, FAccelByteRequestCoalescer::FOnRequestComplete()
+		, AccelByteSubsystemPtr.Get(), LocalUserNum, UserIds, OnQueryUserInfoCompleteDelegates[LocalUserNum]);
 
 	AB_OSS_PTR_INTERFACE_TRACE_END(TEXT("Created and dispatched async task to query user information for %d IDs!"), UserIds.Num());
 	return true;
@@ -0,0 +1,175 @@
+// Copyright (c) 2025 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#include "Utilities/AccelByteAsyncTaskMetrics.h"
+
+const double FAccelByteLatencyHistogram::BucketUpperBoundsMs[FAccelByteLatencyHistogram::NumBuckets] =
+{
+	1.0, 2.0, 5.0, 10.0, 20.0, 50.0, 100.0, 200.0, 500.0, 1000.0, 2000.0, 5000.0, 10000.0, 20000.0, 30000.0, TNumericLimits<double>::Max()
+};
+
+void FAccelByteLatencyHistogram::AddSample(double SampleMs)
+{
+	SampleMs = FMath::Max(SampleMs, 0.0);
+
+	int32 BucketIndex = 0;
+	while (BucketIndex < NumBuckets - 1 && SampleMs > BucketUpperBoundsMs[BucketIndex])
+	{
+		BucketIndex++;
+	}
+	BucketCounts[BucketIndex]++;
+
+	MinMs = (SampleCount == 0) ? SampleMs : FMath::Min(MinMs, SampleMs);
+	MaxMs = (SampleCount == 0) ? SampleMs : FMath::Max(MaxMs, SampleMs);
+	TotalMs += SampleMs;
+	SampleCount++;
+}
+
+double FAccelByteLatencyHistogram::GetMeanMs() const
+{
+	return (SampleCount == 0) ? 0.0 : TotalMs / static_cast<double>(SampleCount);
+}
+
+double FAccelByteLatencyHistogram::GetPercentileMs(double Percentile) const
+{
+	if (SampleCount == 0)
+	{
+		return 0.0;
+	}
+
+	const uint64 TargetCount = FMath::Max<uint64>(1, static_cast<uint64>(FMath::CeilToDouble(SampleCount * FMath::Clamp(Percentile, 0.0, 100.0) / 100.0)));
+	uint64 RunningCount = 0;
+	for (int32 BucketIndex = 0; BucketIndex < NumBuckets; BucketIndex++)
+	{
+		RunningCount += BucketCounts[BucketIndex];
+		if (RunningCount >= TargetCount)
+		{
+			// Bucket bounds are coarse, never report more than what we have actually observed
+			return FMath::Min(BucketUpperBoundsMs[BucketIndex], MaxMs);
+		}
+	}
+
+	return MaxMs;
+}
+
+void FAccelByteLatencyHistogram::Merge(const FAccelByteLatencyHistogram& Other)
+{
+	if (Other.SampleCount == 0)
+	{
+		return;
+	}
+
+	for (int32 BucketIndex = 0; BucketIndex < NumBuckets; BucketIndex++)
+	{
+		BucketCounts[BucketIndex] += Other.BucketCounts[BucketIndex];
+	}
+
+	MinMs = (SampleCount == 0) ? Other.MinMs : FMath::Min(MinMs, Other.MinMs);
+	MaxMs = (SampleCount == 0) ? Other.MaxMs : FMath::Max(MaxMs, Other.MaxMs);
+	TotalMs += Other.TotalMs;
+	SampleCount += Other.SampleCount;
+}
+
+void FAccelByteLatencyHistogram::Reset()
+{
+	*this = FAccelByteLatencyHistogram();
+}
+
+void FAccelByteAsyncTaskMetrics::RecordSample(const FString& TaskName, EAccelByteAsyncTaskPhase Phase, double Seconds)
+{
+	if (Phase >= EAccelByteAsyncTaskPhase::Num)
+	{
+		return;
+	}
+
+	FScopeLock ScopeLock(&MetricsLock);
+	MetricsByTaskName.FindOrAdd(TaskName).Phases[static_cast<uint8>(Phase)].AddSample(Seconds * 1000.0);
+}
+
+void FAccelByteAsyncTaskMetrics::RecordOutcome(const FString& TaskName, bool bWasSuccessful)
+{
+	FScopeLock ScopeLock(&MetricsLock);
+	FAccelByteAsyncTaskClassMetrics& Metrics = MetricsByTaskName.FindOrAdd(TaskName);
+	if (bWasSuccessful)
+	{
+		Metrics.SucceededCount++;
+	}
+	else
+	{
+		Metrics.FailedCount++;
+	}
+}
+
+void FAccelByteAsyncTaskMetrics::RecordParallelCapReached()
+{
+	FScopeLock ScopeLock(&MetricsLock);
+	ParallelCapReachedCount++;
+}
+
+bool FAccelByteAsyncTaskMetrics::GetTaskMetrics(const FString& TaskName, FAccelByteAsyncTaskClassMetrics& OutMetrics) const
+{
+	FScopeLock ScopeLock(&MetricsLock);
+	const FAccelByteAsyncTaskClassMetrics* FoundMetrics = MetricsByTaskName.Find(TaskName);
+	if (FoundMetrics == nullptr)
+	{
+		return false;
+	}
+
+	OutMetrics = *FoundMetrics;
+	return true;
+}
+
+TMap<FString, FAccelByteAsyncTaskClassMetrics> FAccelByteAsyncTaskMetrics::GetAllTaskMetrics() const
+{
+	FScopeLock ScopeLock(&MetricsLock);
+	return MetricsByTaskName;
+}
+
+uint64 FAccelByteAsyncTaskMetrics::GetParallelCapReachedCount() const
+{
+	FScopeLock ScopeLock(&MetricsLock);
+	return ParallelCapReachedCount;
+}
+
+void FAccelByteAsyncTaskMetrics::Reset()
+{
+	FScopeLock ScopeLock(&MetricsLock);
+	MetricsByTaskName.Empty();
+	ParallelCapReachedCount = 0;
+}
+
+void FAccelByteAsyncTaskMetrics::Dump(FOutputDevice& Ar, const FString& Filter) const
+{
+	// Copy out so that we don't hold the lock while formatting
+	const TMap<FString, FAccelByteAsyncTaskClassMetrics> Snapshot = GetAllTaskMetrics();
+
+	Ar.Logf(TEXT("AccelByte async task metrics (%d task classes, parallel cap reached %llu times)"), Snapshot.Num(), GetParallelCapReachedCount());
+	for (const TPair<FString, FAccelByteAsyncTaskClassMetrics>& Entry : Snapshot)
+	{
+		if (!Filter.IsEmpty() && !Entry.Key.Contains(Filter))
+		{
+			continue;
+		}
+
+		Ar.Logf(TEXT("%s: succeeded %llu, failed %llu"), *Entry.Key, Entry.Value.SucceededCount, Entry.Value.FailedCount);
+		for (uint8 PhaseIndex = 0; PhaseIndex < static_cast<uint8>(EAccelByteAsyncTaskPhase::Num); PhaseIndex++)
+		{
+			const FAccelByteLatencyHistogram& Histogram = Entry.Value.Phases[PhaseIndex];
+			if (Histogram.SampleCount == 0)
+			{
+				continue;
+			}
+
+			Ar.Logf(TEXT("    %-10s n=%llu mean=%.2fms min=%.2fms p50=%.2fms p90=%.2fms p99=%.2fms max=%.2fms")
+				, *AsyncTaskPhaseToString(static_cast<EAccelByteAsyncTaskPhase>(PhaseIndex))
+				, Histogram.SampleCount
+				, Histogram.GetMeanMs()
+				, Histogram.MinMs
+				, Histogram.GetPercentileMs(50.0)
+				, Histogram.GetPercentileMs(90.0)
+				, Histogram.GetPercentileMs(99.0)
+				, Histogram.MaxMs);
+		}
+	}
+}
@@ -0,0 +1,187 @@
+// Copyright (c) 2025 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#include "Utilities/AccelByteAsyncTaskPool.h"
+#include "Misc/OutputDevice.h"
+
+FAccelByteAsyncTaskPool& FAccelByteAsyncTaskPool::Get()
+{
+	static FAccelByteAsyncTaskPool Instance;
+	return Instance;
+}
+
+FAccelByteAsyncTaskPool::~FAccelByteAsyncTaskPool()
+{
+	Trim();
+}
+
+int32 FAccelByteAsyncTaskPool::GetSizeClassIndex(SIZE_T Size)
+{
+	if (Size == 0 || Size > SizeClassGranularity * SizeClassNum)
+	{
+		return INDEX_NONE;
+	}
+	return static_cast<int32>((Size - 1) / SizeClassGranularity);
+}
+
+void* FAccelByteAsyncTaskPool::Allocate(SIZE_T Size)
+{
+	const int32 Index = GetSizeClassIndex(Size);
+	if (Index == INDEX_NONE)
+	{
+		return FMemory::Malloc(Size);
+	}
+
+	FSizeClass& SizeClass = SizeClasses[Index];
+	{
+		FScopeLock Lock(&SizeClass.Lock);
+		SizeClass.LiveNum++;
+		if (SizeClass.FreeBlocks.Num() > 0)
+		{
+			SizeClass.ReusedCount++;
+			TotalReusedCount.fetch_add(1, std::memory_order_relaxed);
+			return SizeClass.FreeBlocks.Pop(false);
+		}
+		SizeClass.AllocatedCount++;
+	}
+
+	// Always allocate the full block size, so the block can be reused by any task of the same size class later on
+	return FMemory::Malloc((Index + 1) * SizeClassGranularity);
+}
+
+void FAccelByteAsyncTaskPool::Release(void* Block, SIZE_T Size)
+{
+	if (Block == nullptr)
+	{
+		return;
+	}
+
+	const int32 Index = GetSizeClassIndex(Size);
+	if (Index == INDEX_NONE)
+	{
+		FMemory::Free(Block);
+		return;
+	}
+
+	FSizeClass& SizeClass = SizeClasses[Index];
+	{
+		FScopeLock Lock(&SizeClass.Lock);
+		SizeClass.LiveNum--;
+		if (IsEnabled() && SizeClass.FreeBlocks.Num() < MaxFreeBlocksPerSizeClass.load(std::memory_order_relaxed))
+		{
+			SizeClass.FreeBlocks.Add(Block);
+			return;
+		}
+		SizeClass.DiscardedCount++;
+	}
+
+	FMemory::Free(Block);
+}
+
+void FAccelByteAsyncTaskPool::SetEnabled(bool bInEnabled)
+{
+	bEnabled.store(bInEnabled, std::memory_order_relaxed);
+	if (!bInEnabled)
+	{
+		Trim();
+	}
+}
+
+void FAccelByteAsyncTaskPool::SetMaxFreeBlocksPerSizeClass(int32 InMaxFreeBlocks)
+{
+	MaxFreeBlocksPerSizeClass.store(FMath::Max(InMaxFreeBlocks, 0), std::memory_order_relaxed);
+}
+
+void FAccelByteAsyncTaskPool::Trim()
+{
+	for (FSizeClass& SizeClass : SizeClasses)
+	{
+		TArray<void*> BlocksToFree;
+		{
+			FScopeLock Lock(&SizeClass.Lock);
+			BlocksToFree = MoveTemp(SizeClass.FreeBlocks);
+			SizeClass.FreeBlocks.Reset();
+		}
+
+		for (void* Block : BlocksToFree)
+		{
+			FMemory::Free(Block);
+		}
+	}
+}
+
+void FAccelByteAsyncTaskPool::EndFrame()
+{
+	check(IsInGameThread());
+
+	if (LastClosedFrame == GFrameCounter)
+	{
+		return;
+	}
+	LastClosedFrame = GFrameCounter;
+
+	const uint64 CurrentReusedCount = TotalReusedCount.load(std::memory_order_relaxed);
+	const uint64 FrameReusedCount = CurrentReusedCount - FrameStartReusedCount;
+	FrameStartReusedCount = CurrentReusedCount;
+
+	LastFrameReusedCount.store(FrameReusedCount, std::memory_order_relaxed);
+	if (FrameReusedCount > PeakFrameReusedCount.load(std::memory_order_relaxed))
+	{
+		PeakFrameReusedCount.store(FrameReusedCount, std::memory_order_relaxed);
+	}
+}
+
+TArray<FAccelByteAsyncTaskPoolStats> FAccelByteAsyncTaskPool::GetStats() const
+{
+	TArray<FAccelByteAsyncTaskPoolStats> Result;
+	for (int32 Index = 0; Index < SizeClassNum; Index++)
+	{
+		const FSizeClass& SizeClass = SizeClasses[Index];
+		FScopeLock Lock(&SizeClass.Lock);
+		if (SizeClass.ReusedCount == 0 && SizeClass.AllocatedCount == 0)
+		{
+			continue;
+		}
+
+		FAccelByteAsyncTaskPoolStats& Stats = Result.AddDefaulted_GetRef();
+		Stats.BlockSize = (Index + 1) * SizeClassGranularity;
+		Stats.ReusedCount = SizeClass.ReusedCount;
+		Stats.AllocatedCount = SizeClass.AllocatedCount;
+		Stats.DiscardedCount = SizeClass.DiscardedCount;
+		Stats.FreeNum = SizeClass.FreeBlocks.Num();
+		Stats.LiveNum = SizeClass.LiveNum;
+	}
+	return Result;
+}
+
+void FAccelByteAsyncTaskPool::Dump(FOutputDevice& Ar) const
+{
+	const TArray<FAccelByteAsyncTaskPoolStats> Stats = GetStats();
+
+	uint64 TotalReused = 0;
+	uint64 TotalAllocated = 0;
+	for (const FAccelByteAsyncTaskPoolStats& SizeClassStats : Stats)
+	{
+		TotalReused += SizeClassStats.ReusedCount;
+		TotalAllocated += SizeClassStats.AllocatedCount;
+	}
+
+	Ar.Logf(TEXT("Async task pool (%s): %llu allocations avoided, %llu heap allocations, %llu avoided last frame, %llu avoided at peak frame")
+		, IsEnabled() ? TEXT("enabled") : TEXT("disabled")
+		, TotalReused
+		, TotalAllocated
+		, GetLastFrameReusedCount()
+		, GetPeakFrameReusedCount());
+
+	for (const FAccelByteAsyncTaskPoolStats& SizeClassStats : Stats)
+	{
+		Ar.Logf(TEXT("  %5llu bytes: reused=%llu allocated=%llu discarded=%llu free=%d live=%d")
+			, static_cast<uint64>(SizeClassStats.BlockSize)
+			, SizeClassStats.ReusedCount
+			, SizeClassStats.AllocatedCount
+			, SizeClassStats.DiscardedCount
+			, SizeClassStats.FreeNum
+			, SizeClassStats.LiveNum);
+	}
+}
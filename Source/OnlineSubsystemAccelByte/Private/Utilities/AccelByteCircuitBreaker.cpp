@@ -0,0 +1,159 @@
+// Copyright (c) 2025 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#include "Utilities/AccelByteCircuitBreaker.h"
+#include "OnlineSubsystemAccelByte.h"
+#include "Misc/OutputDevice.h"
+
+FAccelByteCircuitBreakers::FAccelByteCircuitBreakers(int32 InFailureThreshold, double InOpenDurationSeconds)
+	: FailureThreshold(InFailureThreshold)
+	, OpenDurationSeconds(FMath::Max(InOpenDurationSeconds, 0.0))
+{
+}
+
+bool FAccelByteCircuitBreakers::AllowRequest(const FName& ServiceName)
+{
+	if (FailureThreshold <= 0 || ServiceName.IsNone())
+	{
+		return true;
+	}
+
+	FScopeLock ScopeLock(&BreakersLock);
+	FBreaker& Breaker = Breakers.FindOrAdd(ServiceName);
+	const double CurrentTime = FPlatformTime::Seconds();
+
+	switch (Breaker.Stats.State)
+	{
+	case EAccelByteCircuitBreakerState::Closed:
+		return true;
+	case EAccelByteCircuitBreakerState::Open:
+		if (CurrentTime - Breaker.StateChangeTimeInSeconds >= OpenDurationSeconds)
+		{
+			Breaker.Stats.State = EAccelByteCircuitBreakerState::HalfOpen;
+			Breaker.StateChangeTimeInSeconds = CurrentTime;
+			Breaker.bIsProbeInFlight = true;
+			UE_LOG(LogAccelByteOSS, Log, TEXT("Circuit breaker of service %s is half open, sending a probe request"), *ServiceName.ToString());
+			return true;
+		}
+		break;
+	case EAccelByteCircuitBreakerState::HalfOpen:
+		// A probe that never reported back, for example because its task was cancelled, must not keep the breaker stuck
+		if (!Breaker.bIsProbeInFlight || CurrentTime - Breaker.StateChangeTimeInSeconds >= OpenDurationSeconds)
+		{
+			Breaker.StateChangeTimeInSeconds = CurrentTime;
+			Breaker.bIsProbeInFlight = true;
+			return true;
+		}
+		break;
+	}
+
+	Breaker.Stats.RejectedCount++;
+	return false;
+}
+
+void FAccelByteCircuitBreakers::RecordSuccess(const FName& ServiceName)
+{
+	if (ServiceName.IsNone())
+	{
+		return;
+	}
+
+	FScopeLock ScopeLock(&BreakersLock);
+	FBreaker& Breaker = Breakers.FindOrAdd(ServiceName);
+	Breaker.Stats.SuccessCount++;
+	Breaker.Stats.ConsecutiveFailureNum = 0;
+	Breaker.bIsProbeInFlight = false;
+
+	if (Breaker.Stats.State != EAccelByteCircuitBreakerState::Closed)
+	{
+		Breaker.Stats.State = EAccelByteCircuitBreakerState::Closed;
+		UE_LOG(LogAccelByteOSS, Log, TEXT("Circuit breaker of service %s closed, service has recovered"), *ServiceName.ToString());
+	}
+}
+
+void FAccelByteCircuitBreakers::RecordFailure(const FName& ServiceName)
+{
+	if (ServiceName.IsNone())
+	{
+		return;
+	}
+
+	FScopeLock ScopeLock(&BreakersLock);
+	FBreaker& Breaker = Breakers.FindOrAdd(ServiceName);
+	Breaker.Stats.FailureCount++;
+	Breaker.Stats.ConsecutiveFailureNum++;
+
+	if (FailureThreshold <= 0)
+	{
+		return;
+	}
+
+	const double CurrentTime = FPlatformTime::Seconds();
+	if (Breaker.Stats.State == EAccelByteCircuitBreakerState::HalfOpen)
+	{
+		Trip(Breaker, CurrentTime);
+		UE_LOG(LogAccelByteOSS, Warning, TEXT("Probe request to service %s failed, circuit breaker opened again"), *ServiceName.ToString());
+	}
+	else if (Breaker.Stats.State == EAccelByteCircuitBreakerState::Closed && Breaker.Stats.ConsecutiveFailureNum >= FailureThreshold)
+	{
+		Trip(Breaker, CurrentTime);
+		UE_LOG(LogAccelByteOSS, Warning, TEXT("Circuit breaker of service %s opened after %d failures in a row, failing requests fast for %.1f s")
+			, *ServiceName.ToString(), Breaker.Stats.ConsecutiveFailureNum, OpenDurationSeconds);
+	}
+}
+
+void FAccelByteCircuitBreakers::RecordRetry(const FName& ServiceName)
+{
+	if (ServiceName.IsNone())
+	{
+		return;
+	}
+
+	FScopeLock ScopeLock(&BreakersLock);
+	Breakers.FindOrAdd(ServiceName).Stats.RetryCount++;
+}
+
+void FAccelByteCircuitBreakers::Trip(FBreaker& Breaker, double CurrentTimeInSeconds)
+{
+	Breaker.Stats.State = EAccelByteCircuitBreakerState::Open;
+	Breaker.Stats.TripCount++;
+	Breaker.StateChangeTimeInSeconds = CurrentTimeInSeconds;
+	Breaker.bIsProbeInFlight = false;
+}
+
+TMap<FName, FAccelByteCircuitBreakerStats> FAccelByteCircuitBreakers::GetStats() const
+{
+	FScopeLock ScopeLock(&BreakersLock);
+	TMap<FName, FAccelByteCircuitBreakerStats> Result;
+	for (const TPair<FName, FBreaker>& BreakerPair : Breakers)
+	{
+		Result.Add(BreakerPair.Key, BreakerPair.Value.Stats);
+	}
+	return Result;
+}
+
+void FAccelByteCircuitBreakers::Reset()
+{
+	FScopeLock ScopeLock(&BreakersLock);
+	Breakers.Empty();
+}
+
+void FAccelByteCircuitBreakers::Dump(FOutputDevice& Ar) const
+{
+	const TMap<FName, FAccelByteCircuitBreakerStats> Stats = GetStats();
+	Ar.Logf(TEXT("AccelByte circuit breakers: %d services (failure threshold %d, open duration %.1f s)"), Stats.Num(), FailureThreshold, OpenDurationSeconds);
+	for (const TPair<FName, FAccelByteCircuitBreakerStats>& StatsPair : Stats)
+	{
+		const FAccelByteCircuitBreakerStats& ServiceStats = StatsPair.Value;
+		Ar.Logf(TEXT("    %s: %s, failures in a row %d, success %llu, failure %llu, retried %llu, rejected %llu, tripped %llu")
+			, *StatsPair.Key.ToString()
+			, *CircuitBreakerStateToString(ServiceStats.State)
+			, ServiceStats.ConsecutiveFailureNum
+			, ServiceStats.SuccessCount
+			, ServiceStats.FailureCount
+			, ServiceStats.RetryCount
+			, ServiceStats.RejectedCount
+			, ServiceStats.TripCount);
+	}
+}
@@ -0,0 +1,103 @@
+// Copyright (c) 2025 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#include "Utilities/AccelByteRequestCoalescer.h"
+
+FString FAccelByteRequestCoalescer::MakeRequestKey(const FString& TaskName, const FString& UserKey, TArray<FString> Arguments)
+{
+	Arguments.Sort();
+	return FString::Printf(TEXT("%s|%s|%s"), *TaskName, *UserKey, *FString::Join(Arguments, TEXT(",")));
+}
+
+FString FAccelByteRequestCoalescer::GetRequestKind(const FString& Key)
+{
+	int32 SeparatorIndex = INDEX_NONE;
+	if (Key.FindChar(TEXT('|'), SeparatorIndex))
+	{
+		return Key.Left(SeparatorIndex);
+	}
+	return Key;
+}
+
+bool FAccelByteRequestCoalescer::TryJoin(const FString& Key, FOnRequestComplete&& OnComplete)
+{
+	FScopeLock ScopeLock(&CoalescerLock);
+	FAccelByteCoalescingKindStats& Stats = StatsByKind.FindOrAdd(GetRequestKind(Key));
+
+	TArray<FOnRequestComplete>* Waiters = InFlightRequests.Find(Key);
+	if (Waiters != nullptr)
+	{
+		Waiters->Emplace(MoveTemp(OnComplete));
+		Stats.CoalescedCount++;
+		return true;
+	}
+
+	InFlightRequests.Add(Key);
+	Stats.DispatchedCount++;
+	return false;
+}
+
+void FAccelByteRequestCoalescer::Complete(const FString& Key, bool bWasSuccessful)
+{
+	TArray<FOnRequestComplete> Waiters;
+	{
+		FScopeLock ScopeLock(&CoalescerLock);
+		InFlightRequests.RemoveAndCopyValue(Key, Waiters);
+	}
+
+	// Run outside of the lock, callbacks are free to start a new request for the same key
+	for (FOnRequestComplete& Waiter : Waiters)
+	{
+		if (Waiter)
+		{
+			Waiter(bWasSuccessful);
+		}
+	}
+}
+
+int32 FAccelByteRequestCoalescer::GetInFlightNum() const
+{
+	FScopeLock ScopeLock(&CoalescerLock);
+	return InFlightRequests.Num();
+}
+
+TMap<FString, FAccelByteCoalescingKindStats> FAccelByteRequestCoalescer::GetStats() const
+{
+	FScopeLock ScopeLock(&CoalescerLock);
+	return StatsByKind;
+}
+
+void FAccelByteRequestCoalescer::ResetStats()
+{
+	FScopeLock ScopeLock(&CoalescerLock);
+	StatsByKind.Empty();
+}
+
+void FAccelByteRequestCoalescer::Dump(FOutputDevice& Ar, const FString& Filter) const
+{
+	const TMap<FString, FAccelByteCoalescingKindStats> Snapshot = GetStats();
+
+	uint64 TotalDispatched = 0;
+	uint64 TotalCoalesced = 0;
+	for (const TPair<FString, FAccelByteCoalescingKindStats>& Entry : Snapshot)
+	{
+		TotalDispatched += Entry.Value.DispatchedCount;
+		TotalCoalesced += Entry.Value.CoalescedCount;
+	}
+
+	Ar.Logf(TEXT("AccelByte request coalescing (%d kinds, %d in flight): dispatched %llu, coalesced %llu")
+		, Snapshot.Num()
+		, GetInFlightNum()
+		, TotalDispatched
+		, TotalCoalesced);
+	for (const TPair<FString, FAccelByteCoalescingKindStats>& Entry : Snapshot)
+	{
+		if (!Filter.IsEmpty() && !Entry.Key.Contains(Filter))
+		{
+			continue;
+		}
+
+		Ar.Logf(TEXT("    %s: dispatched %llu, coalesced %llu"), *Entry.Key, Entry.Value.DispatchedCount, Entry.Value.CoalescedCount);
+	}
+}
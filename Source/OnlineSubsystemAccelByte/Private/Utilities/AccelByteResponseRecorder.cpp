@@ -0,0 +1,299 @@
+// Copyright (c) 2025 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#include "Utilities/AccelByteResponseRecorder.h"
+#include "OnlineSubsystemAccelByte.h"
+#include "Misc/FileHelper.h"
+#include "Misc/OutputDevice.h"
+#include "Misc/Paths.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+
+FAccelByteResponseRecorder& FAccelByteResponseRecorder::Get()
+{
+	static FAccelByteResponseRecorder Instance;
+	return Instance;
+}
+
+void FAccelByteResponseRecorder::StartRecording()
+{
+	FScopeLock ScopeLock(&Lock);
+	RecordedResponses.Empty();
+	ReplayQueues.Empty();
+	ScheduledReplays.Empty();
+	Mode.store(EAccelByteResponseRecorderMode::Record, std::memory_order_release);
+	UE_LOG_AB(Log, TEXT("Recording SDK responses"));
+}
+
+bool FAccelByteResponseRecorder::StopRecording(const FString& FilePath)
+{
+	TArray<FAccelByteRecordedResponse> Responses;
+	{
+		FScopeLock ScopeLock(&Lock);
+		if (GetMode() != EAccelByteResponseRecorderMode::Record)
+		{
+			return false;
+		}
+		Mode.store(EAccelByteResponseRecorderMode::Off, std::memory_order_release);
+		Responses = MoveTemp(RecordedResponses);
+		RecordedResponses.Empty();
+	}
+
+	FString Output;
+	const TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&Output);
+	Writer->WriteObjectStart();
+	Writer->WriteArrayStart(TEXT("responses"));
+	for (const FAccelByteRecordedResponse& Response : Responses)
+	{
+		Writer->WriteObjectStart();
+		Writer->WriteValue(TEXT("request"), Response.RequestName);
+		Writer->WriteValue(TEXT("latencySeconds"), Response.LatencyInSeconds);
+		Writer->WriteValue(TEXT("success"), Response.bWasSuccessful);
+		Writer->WriteValue(TEXT("payload"), Response.Payload);
+		Writer->WriteValue(TEXT("errorCode"), Response.ErrorCode);
+		Writer->WriteValue(TEXT("errorMessage"), Response.ErrorMessage);
+		Writer->WriteObjectEnd();
+	}
+	Writer->WriteArrayEnd();
+	Writer->WriteObjectEnd();
+	Writer->Close();
+
+	const FString FullPath = GetRecordingPath(FilePath);
+	if (!FFileHelper::SaveStringToFile(Output, *FullPath))
+	{
+		UE_LOG_AB(Warning, TEXT("Failed to save %d recorded SDK responses to %s"), Responses.Num(), *FullPath);
+		return false;
+	}
+
+	UE_LOG_AB(Log, TEXT("Saved %d recorded SDK responses to %s"), Responses.Num(), *FullPath);
+	return true;
+}
+
+bool FAccelByteResponseRecorder::StartReplay(const FString& FilePath, double InSpeed)
+{
+	StopReplay();
+
+	const FString FullPath = GetRecordingPath(FilePath);
+	FString Input;
+	TSharedPtr<FJsonObject> JsonObject;
+	if (!FFileHelper::LoadFileToString(Input, *FullPath)
+		|| !FJsonSerializer::Deserialize(TJsonReaderFactory<>::Create(Input), JsonObject)
+		|| !JsonObject.IsValid())
+	{
+		UE_LOG_AB(Warning, TEXT("Failed to load recorded SDK responses from %s"), *FullPath);
+		return false;
+	}
+
+	const TArray<TSharedPtr<FJsonValue>>* ResponseValues = nullptr;
+	if (!JsonObject->TryGetArrayField(TEXT("responses"), ResponseValues))
+	{
+		UE_LOG_AB(Warning, TEXT("Recording %s has no responses"), *FullPath);
+		return false;
+	}
+
+	FScopeLock ScopeLock(&Lock);
+	int32 LoadedNum = 0;
+	for (const TSharedPtr<FJsonValue>& ResponseValue : *ResponseValues)
+	{
+		const TSharedPtr<FJsonObject>* ResponseObject = nullptr;
+		if (!ResponseValue.IsValid() || !ResponseValue->TryGetObject(ResponseObject))
+		{
+			continue;
+		}
+
+		FAccelByteRecordedResponse Response;
+		(*ResponseObject)->TryGetStringField(TEXT("request"), Response.RequestName);
+		(*ResponseObject)->TryGetNumberField(TEXT("latencySeconds"), Response.LatencyInSeconds);
+		(*ResponseObject)->TryGetBoolField(TEXT("success"), Response.bWasSuccessful);
+		(*ResponseObject)->TryGetStringField(TEXT("payload"), Response.Payload);
+		(*ResponseObject)->TryGetNumberField(TEXT("errorCode"), Response.ErrorCode);
+		(*ResponseObject)->TryGetStringField(TEXT("errorMessage"), Response.ErrorMessage);
+		if (Response.RequestName.IsEmpty())
+		{
+			continue;
+		}
+
+		ReplayQueues.FindOrAdd(Response.RequestName).Add(MoveTemp(Response));
+		LoadedNum++;
+	}
+
+	ReplaySpeed = InSpeed;
+	MissingResponseNum = 0;
+	ReplayedResponseNum = 0;
+	Mode.store(EAccelByteResponseRecorderMode::Replay, std::memory_order_release);
+	UE_LOG_AB(Log, TEXT("Replaying %d SDK responses of %d requests from %s at %.2fx speed"), LoadedNum, ReplayQueues.Num(), *FullPath, ReplaySpeed);
+	return true;
+}
+
+void FAccelByteResponseRecorder::StopReplay()
+{
+	FScopeLock ScopeLock(&Lock);
+	if (GetMode() != EAccelByteResponseRecorderMode::Replay)
+	{
+		return;
+	}
+
+	Mode.store(EAccelByteResponseRecorderMode::Off, std::memory_order_release);
+	ReplayQueues.Empty();
+	ScheduledReplays.Empty();
+}
+
+void FAccelByteResponseRecorder::PumpReplays()
+{
+	if (GetMode() != EAccelByteResponseRecorderMode::Replay)
+	{
+		return;
+	}
+
+	TArray<FScheduledReplay> DueReplays;
+	{
+		FScopeLock ScopeLock(&Lock);
+		const double CurrentTime = FPlatformTime::Seconds();
+		for (int32 Index = 0; Index < ScheduledReplays.Num(); )
+		{
+			if (ScheduledReplays[Index].DueTimeInSeconds <= CurrentTime)
+			{
+				DueReplays.Add(MoveTemp(ScheduledReplays[Index]));
+				ScheduledReplays.RemoveAt(Index);
+			}
+			else
+			{
+				Index++;
+			}
+		}
+		ReplayedResponseNum += DueReplays.Num();
+	}
+
+	// Triggered outside of the lock, handlers usually send the next request of their task straight away
+	for (const FScheduledReplay& Replay : DueReplays)
+	{
+		Replay.Trigger(Replay.Response);
+	}
+}
+
+void FAccelByteResponseRecorder::Dump(FOutputDevice& Ar) const
+{
+	FScopeLock ScopeLock(&Lock);
+	switch (GetMode())
+	{
+	case EAccelByteResponseRecorderMode::Off:
+		Ar.Logf(TEXT("AccelByte response recorder is off"));
+		break;
+	case EAccelByteResponseRecorderMode::Record:
+		Ar.Logf(TEXT("AccelByte response recorder is recording: %d responses recorded"), RecordedResponses.Num());
+		break;
+	case EAccelByteResponseRecorderMode::Replay:
+	{
+		int32 RemainingNum = 0;
+		for (const TPair<FString, TArray<FAccelByteRecordedResponse>>& QueuePair : ReplayQueues)
+		{
+			RemainingNum += QueuePair.Value.Num();
+		}
+		Ar.Logf(TEXT("AccelByte response recorder is replaying at %.2fx: replayed %d, scheduled %d, remaining %d, missing %d")
+			, ReplaySpeed
+			, ReplayedResponseNum
+			, ScheduledReplays.Num()
+			, RemainingNum
+			, MissingResponseNum);
+		break;
+	}
+	}
+}
+
+bool FAccelByteResponseRecorder::Intercept(const FString& RequestName, AccelByte::FVoidHandler& OnSuccess, AccelByte::FErrorHandler& OnError)
+{
+	const EAccelByteResponseRecorderMode CurrentMode = GetMode();
+	if (CurrentMode == EAccelByteResponseRecorderMode::Off)
+	{
+		return false;
+	}
+
+	if (CurrentMode == EAccelByteResponseRecorderMode::Record)
+	{
+		const double SentTimeInSeconds = FPlatformTime::Seconds();
+		OnSuccess = AccelByte::FVoidHandler::CreateLambda([RequestName, SentTimeInSeconds, Inner = OnSuccess]()
+		{
+			Get().RecordResponse(RequestName, SentTimeInSeconds, true, FString(), 0, FString());
+			Inner.ExecuteIfBound();
+		});
+		WrapErrorForRecording(RequestName, SentTimeInSeconds, OnError);
+		return false;
+	}
+
+	ScheduleReplay(RequestName, [OnSuccess, OnError](const FAccelByteRecordedResponse& Response)
+	{
+		if (Response.bWasSuccessful)
+		{
+			OnSuccess.ExecuteIfBound();
+		}
+		else
+		{
+			OnError.ExecuteIfBound(Response.ErrorCode, Response.ErrorMessage);
+		}
+	});
+	return true;
+}
+
+void FAccelByteResponseRecorder::RecordResponse(const FString& RequestName, double SentTimeInSeconds, bool bWasSuccessful, const FString& Payload, int32 ErrorCode, const FString& ErrorMessage)
+{
+	FScopeLock ScopeLock(&Lock);
+	if (GetMode() != EAccelByteResponseRecorderMode::Record)
+	{
+		return;
+	}
+
+	FAccelByteRecordedResponse& Response = RecordedResponses.AddDefaulted_GetRef();
+	Response.RequestName = RequestName;
+	Response.LatencyInSeconds = FPlatformTime::Seconds() - SentTimeInSeconds;
+	Response.bWasSuccessful = bWasSuccessful;
+	Response.Payload = Payload;
+	Response.ErrorCode = ErrorCode;
+	Response.ErrorMessage = ErrorMessage;
+}
+
+void FAccelByteResponseRecorder::WrapErrorForRecording(const FString& RequestName, double SentTimeInSeconds, AccelByte::FErrorHandler& OnError)
+{
+	OnError = AccelByte::FErrorHandler::CreateLambda([RequestName, SentTimeInSeconds, Inner = OnError](int32 ErrorCode, const FString& ErrorMessage)
+	{
+		Get().RecordResponse(RequestName, SentTimeInSeconds, false, FString(), ErrorCode, ErrorMessage);
+		Inner.ExecuteIfBound(ErrorCode, ErrorMessage);
+	});
+}
+
+void FAccelByteResponseRecorder::ScheduleReplay(const FString& RequestName, TFunction<void(const FAccelByteRecordedResponse&)>&& Trigger)
+{
+	FScopeLock ScopeLock(&Lock);
+
+	FScheduledReplay& Replay = ScheduledReplays.AddDefaulted_GetRef();
+	Replay.Trigger = MoveTemp(Trigger);
+
+	TArray<FAccelByteRecordedResponse>* Queue = ReplayQueues.Find(RequestName);
+	if (Queue != nullptr && Queue->Num() > 0)
+	{
+		Replay.Response = MoveTemp((*Queue)[0]);
+		Queue->RemoveAt(0);
+	}
+	else
+	{
+		// The session being replayed never sent this request, fail it rather than leaving the task to time out
+		MissingResponseNum++;
+		Replay.Response.RequestName = RequestName;
+		Replay.Response.ErrorCode = static_cast<int32>(AccelByte::ErrorCodes::InvalidRequest);
+		Replay.Response.ErrorMessage = TEXT("no-recorded-response");
+		UE_LOG_AB(Warning, TEXT("No recorded response left for request %s, failing it"), *RequestName);
+	}
+
+	const double Latency = ReplaySpeed > 0.0 ? Replay.Response.LatencyInSeconds / ReplaySpeed : 0.0;
+	Replay.DueTimeInSeconds = FPlatformTime::Seconds() + Latency;
+}
+
+FString FAccelByteResponseRecorder::GetRecordingPath(const FString& FilePath)
+{
+	if (FPaths::IsRelative(FilePath))
+	{
+		return FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("AccelByte"), TEXT("Recordings"), FilePath);
+	}
+	return FilePath;
+}
@@ -0,0 +1,179 @@
+// Copyright (c) 2025 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#include "Utilities/AccelByteTimeoutWheel.h"
+#include "AsyncTasks/OnlineAsyncTaskAccelByte.h"
+
+namespace
+{
+	constexpr int64 SlotMask = FAccelByteTimeoutWheel::SlotsPerLevel - 1;
+	constexpr int64 SlotBits = 6;
+	static_assert((1 << SlotBits) == FAccelByteTimeoutWheel::SlotsPerLevel, "SlotBits must match SlotsPerLevel");
+}
+
+FAccelByteTimeoutWheel::FAccelByteTimeoutWheel(double InResolutionSeconds)
+	: ResolutionSeconds(FMath::Max(InResolutionSeconds, 0.001))
+{
+}
+
+int64 FAccelByteTimeoutWheel::ToTick(double TimeInSeconds) const
+{
+	return static_cast<int64>(FMath::CeilToDouble(TimeInSeconds / ResolutionSeconds));
+}
+
+void FAccelByteTimeoutWheel::Schedule(FOnlineAsyncTaskAccelByte* Task, double DeadlineInSeconds)
+{
+	if (Task == nullptr)
+	{
+		return;
+	}
+
+	FScopeLock ScopeLock(&WheelLock);
+	if (!bHasStarted)
+	{
+		CurrentTick = ToTick(FPlatformTime::Seconds());
+		bHasStarted = true;
+	}
+
+	Remove(Task);
+	Insert(FEntry{ Task, ToTick(DeadlineInSeconds) });
+	ScheduledCount++;
+}
+
+void FAccelByteTimeoutWheel::Cancel(FOnlineAsyncTaskAccelByte* Task)
+{
+	FScopeLock ScopeLock(&WheelLock);
+	Remove(Task);
+}
+
+void FAccelByteTimeoutWheel::Insert(const FEntry& Entry)
+{
+	// Anything already due goes in the next bucket so it is checked on the next advance
+	const int64 DeadlineTick = FMath::Max(Entry.DeadlineTick, CurrentTick + 1);
+	const int64 TicksLeft = DeadlineTick - CurrentTick;
+
+	FLocation Location;
+	if (TicksLeft < SlotsPerLevel)
+	{
+		Location.Level = 0;
+		Location.Slot = static_cast<int32>(DeadlineTick & SlotMask);
+	}
+	else if (TicksLeft < (static_cast<int64>(SlotsPerLevel) << SlotBits))
+	{
+		Location.Level = 1;
+		Location.Slot = static_cast<int32>((DeadlineTick >> SlotBits) & SlotMask);
+	}
+
+	TArray<FEntry>& Bucket = (Location.Level == INDEX_NONE) ? Overflow : Levels[Location.Level][Location.Slot];
+	Bucket.Add(FEntry{ Entry.Task, DeadlineTick });
+	Locations.Add(Entry.Task, Location);
+}
+
+void FAccelByteTimeoutWheel::Remove(FOnlineAsyncTaskAccelByte* Task)
+{
+	FLocation Location;
+	if (!Locations.RemoveAndCopyValue(Task, Location))
+	{
+		return;
+	}
+
+	TArray<FEntry>& Bucket = (Location.Level == INDEX_NONE) ? Overflow : Levels[Location.Level][Location.Slot];
+	const int32 Index = Bucket.IndexOfByPredicate([Task](const FEntry& Entry) { return Entry.Task == Task; });
+	if (Index != INDEX_NONE)
+	{
+		Bucket.RemoveAtSwap(Index, 1, false);
+	}
+}
+
+void FAccelByteTimeoutWheel::Cascade(TArray<FEntry>& Entries)
+{
+	TArray<FEntry> EntriesToMove = MoveTemp(Entries);
+	Entries.Reset();
+	for (const FEntry& Entry : EntriesToMove)
+	{
+		Locations.Remove(Entry.Task);
+		Insert(Entry);
+	}
+}
+
+int32 FAccelByteTimeoutWheel::Advance(double CurrentTimeInSeconds)
+{
+	FScopeLock ScopeLock(&WheelLock);
+	const int64 TargetTick = static_cast<int64>(FMath::FloorToDouble(CurrentTimeInSeconds / ResolutionSeconds));
+	if (!bHasStarted || Locations.Num() == 0)
+	{
+		// Nothing to expire, skip straight to the current time rather than walking every empty bucket
+		CurrentTick = FMath::Max(CurrentTick, TargetTick);
+		bHasStarted = true;
+		return 0;
+	}
+
+	int32 ExpiredNum = 0;
+	while (CurrentTick < TargetTick)
+	{
+		CurrentTick++;
+
+		// Pull the next block of the upper levels down whenever the level below wraps around
+		if ((CurrentTick & SlotMask) == 0)
+		{
+			if (((CurrentTick >> SlotBits) & SlotMask) == 0)
+			{
+				Cascade(Overflow);
+			}
+			Cascade(Levels[1][(CurrentTick >> SlotBits) & SlotMask]);
+		}
+
+		TArray<FEntry> DueEntries = MoveTemp(Levels[0][CurrentTick & SlotMask]);
+		Levels[0][CurrentTick & SlotMask].Reset();
+		for (const FEntry& Entry : DueEntries)
+		{
+			Locations.Remove(Entry.Task);
+
+			// Entries that were cascaded late may still belong to a later lap of this level
+			if (Entry.DeadlineTick > CurrentTick)
+			{
+				Insert(Entry);
+				continue;
+			}
+
+			const int64 LatestDeadlineTick = ToTick(Entry.Task->GetTimeoutDeadlineInSeconds());
+			if (LatestDeadlineTick > CurrentTick)
+			{
+				Insert(FEntry{ Entry.Task, LatestDeadlineTick });
+				RescheduledCount++;
+				continue;
+			}
+
+			Entry.Task->MarkTimeoutExpired();
+			ExpiredCount++;
+			ExpiredNum++;
+		}
+	}
+
+	return ExpiredNum;
+}
+
+int32 FAccelByteTimeoutWheel::Num() const
+{
+	FScopeLock ScopeLock(&WheelLock);
+	return Locations.Num();
+}
+
+uint64 FAccelByteTimeoutWheel::GetScheduledCount() const
+{
+	FScopeLock ScopeLock(&WheelLock);
+	return ScheduledCount;
+}
+
+uint64 FAccelByteTimeoutWheel::GetRescheduledCount() const
+{
+	FScopeLock ScopeLock(&WheelLock);
+	return RescheduledCount;
+}
+
+uint64 FAccelByteTimeoutWheel::GetExpiredCount() const
+{
+	FScopeLock ScopeLock(&WheelLock);
+	return ExpiredCount;
+}
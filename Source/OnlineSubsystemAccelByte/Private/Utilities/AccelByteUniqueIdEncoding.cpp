@@ -0,0 +1,266 @@
+// Copyright (c) 2025 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#include "Utilities/AccelByteUniqueIdEncoding.h"
+#include "OnlineSubsystemAccelByte.h"
+#include "Misc/Base64.h"
+#include "JsonObjectConverter.h"
+
+namespace
+{
+	/** Platform types of the compact form by index, append only */
+	const TCHAR* const KnownPlatformTypes[] =
+	{
+		TEXT(""),
+		TEXT("STEAM"),
+		TEXT("PS4"),
+		TEXT("PS5"),
+		TEXT("GDK"),
+		TEXT("LIVE"),
+		TEXT("EOS"),
+		TEXT("GOOGLEPLAY"),
+		TEXT("APPLE"),
+		TEXT("IOS"),
+		TEXT("SWITCH"),
+		TEXT("steam"),
+		TEXT("ps4"),
+		TEXT("ps5"),
+		TEXT("live"),
+		TEXT("xbox"),
+		TEXT("epicgames"),
+		TEXT("google"),
+		TEXT("apple"),
+		TEXT("device"),
+		TEXT("oculus"),
+		TEXT("nintendo"),
+	};
+
+	constexpr int32 AccelByteUuidByteNum = 16;
+
+	int32 HexDigitValue(TCHAR Character)
+	{
+		if (Character >= TEXT('0') && Character <= TEXT('9'))
+		{
+			return Character - TEXT('0');
+		}
+		if (Character >= TEXT('a') && Character <= TEXT('f'))
+		{
+			return Character - TEXT('a') + 10;
+		}
+		return INDEX_NONE;
+	}
+
+	/** Only lowercase UUIDs are packed, so that decoding always gives back the exact same string */
+	bool TryPackUuid(const FString& AccelByteId, uint8 (&OutBytes)[AccelByteUuidByteNum])
+	{
+		if (AccelByteId.Len() != AccelByteUuidByteNum * 2)
+		{
+			return false;
+		}
+
+		for (int32 Index = 0; Index < AccelByteUuidByteNum; Index++)
+		{
+			const int32 High = HexDigitValue(AccelByteId[Index * 2]);
+			const int32 Low = HexDigitValue(AccelByteId[Index * 2 + 1]);
+			if (High == INDEX_NONE || Low == INDEX_NONE)
+			{
+				return false;
+			}
+			OutBytes[Index] = static_cast<uint8>((High << 4) | Low);
+		}
+		return true;
+	}
+
+	FString UnpackUuid(const uint8* Bytes)
+	{
+		static const TCHAR HexDigits[] = TEXT("0123456789abcdef");
+		FString Result;
+		Result.Reserve(AccelByteUuidByteNum * 2);
+		for (int32 Index = 0; Index < AccelByteUuidByteNum; Index++)
+		{
+			Result.AppendChar(HexDigits[Bytes[Index] >> 4]);
+			Result.AppendChar(HexDigits[Bytes[Index] & 0x0F]);
+		}
+		return Result;
+	}
+}
+
+bool FAccelByteUniqueIdEncoding::IsCompactNboEnabled()
+{
+	static const bool bIsEnabled = []()
+	{
+		// Off by default, peers running an older version can only read the legacy form
+		bool bUseCompactUniqueIdEncoding = false;
+		FAccelByteUtilities::LoadABConfigFallback(TEXT("OnlineSubsystemAccelByte"), TEXT("bUseCompactUniqueIdEncoding"), bUseCompactUniqueIdEncoding);
+		return bUseCompactUniqueIdEncoding;
+	}();
+	return bIsEnabled;
+}
+
+void FAccelByteUniqueIdEncoding::EncodeCompact(const FAccelByteUniqueIdComposite& CompositeId, TArray<uint8>& OutBytes)
+{
+	uint8 UuidBytes[AccelByteUuidByteNum];
+	const bool bIsPackedUuid = TryPackUuid(CompositeId.Id, UuidBytes);
+
+	OutBytes.Add(CompactVersion);
+	OutBytes.Add(bIsPackedUuid ? 0 : StringAccelByteId);
+	if (bIsPackedUuid)
+	{
+		OutBytes.Append(UuidBytes, AccelByteUuidByteNum);
+	}
+	else
+	{
+		WriteString(CompositeId.Id, OutBytes);
+	}
+
+	uint8 PlatformTypeIndex = CustomPlatformType;
+	for (int32 Index = 0; Index < static_cast<int32>(UE_ARRAY_COUNT(KnownPlatformTypes)); Index++)
+	{
+		if (CompositeId.PlatformType.Equals(KnownPlatformTypes[Index], ESearchCase::CaseSensitive))
+		{
+			PlatformTypeIndex = static_cast<uint8>(Index);
+			break;
+		}
+	}
+
+	OutBytes.Add(PlatformTypeIndex);
+	if (PlatformTypeIndex == CustomPlatformType)
+	{
+		WriteString(CompositeId.PlatformType, OutBytes);
+	}
+	WriteString(CompositeId.PlatformId, OutBytes);
+}
+
+bool FAccelByteUniqueIdEncoding::DecodeCompact(const uint8* Bytes, int32 Size, FAccelByteUniqueIdComposite& OutCompositeId)
+{
+	if (Bytes == nullptr || Size < 2 || Bytes[0] != CompactVersion)
+	{
+		return false;
+	}
+
+	const uint8 Flags = Bytes[1];
+	int32 Offset = 2;
+
+	FAccelByteUniqueIdComposite CompositeId;
+	if ((Flags & StringAccelByteId) != 0)
+	{
+		if (!ReadString(Bytes, Size, Offset, CompositeId.Id))
+		{
+			return false;
+		}
+	}
+	else
+	{
+		if (Size - Offset < AccelByteUuidByteNum)
+		{
+			return false;
+		}
+		CompositeId.Id = UnpackUuid(Bytes + Offset);
+		Offset += AccelByteUuidByteNum;
+	}
+
+	if (Offset >= Size)
+	{
+		return false;
+	}
+
+	const uint8 PlatformTypeIndex = Bytes[Offset++];
+	if (PlatformTypeIndex == CustomPlatformType)
+	{
+		if (!ReadString(Bytes, Size, Offset, CompositeId.PlatformType))
+		{
+			return false;
+		}
+	}
+	else if (PlatformTypeIndex < UE_ARRAY_COUNT(KnownPlatformTypes))
+	{
+		CompositeId.PlatformType = KnownPlatformTypes[PlatformTypeIndex];
+	}
+	else
+	{
+		// Appended by a newer build, the platform type cannot be recovered
+		return false;
+	}
+
+	if (!ReadString(Bytes, Size, Offset, CompositeId.PlatformId))
+	{
+		return false;
+	}
+
+	OutCompositeId = MoveTemp(CompositeId);
+	return true;
+}
+
+FString FAccelByteUniqueIdEncoding::EncodeLegacy(const FAccelByteUniqueIdComposite& CompositeId)
+{
+	FString CompositeString;
+	if (!FJsonObjectConverter::UStructToJsonObjectString(CompositeId, CompositeString))
+	{
+		return FString();
+	}
+	return FBase64::Encode(CompositeString);
+}
+
+bool FAccelByteUniqueIdEncoding::DecodeLegacy(const FString& EncodedId, FAccelByteUniqueIdComposite& OutCompositeId)
+{
+	FString DecodedString;
+	return FBase64::Decode(EncodedId, DecodedString)
+		&& FJsonObjectConverter::JsonObjectStringToUStruct(DecodedString, &OutCompositeId, 0, 0);
+}
+
+void FAccelByteUniqueIdEncoding::WriteLength(uint32 Length, TArray<uint8>& OutBytes)
+{
+	do
+	{
+		uint8 Byte = Length & 0x7F;
+		Length >>= 7;
+		if (Length != 0)
+		{
+			Byte |= 0x80;
+		}
+		OutBytes.Add(Byte);
+	}
+	while (Length != 0);
+}
+
+bool FAccelByteUniqueIdEncoding::ReadLength(const uint8* Bytes, int32 Size, int32& InOutOffset, uint32& OutLength)
+{
+	OutLength = 0;
+	for (int32 Shift = 0; Shift < 32; Shift += 7)
+	{
+		if (InOutOffset >= Size)
+		{
+			return false;
+		}
+
+		const uint8 Byte = Bytes[InOutOffset++];
+		OutLength |= static_cast<uint32>(Byte & 0x7F) << Shift;
+		if ((Byte & 0x80) == 0)
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+void FAccelByteUniqueIdEncoding::WriteString(const FString& Value, TArray<uint8>& OutBytes)
+{
+	const FTCHARToUTF8 Utf8Value(*Value);
+	WriteLength(static_cast<uint32>(Utf8Value.Length()), OutBytes);
+	OutBytes.Append(reinterpret_cast<const uint8*>(Utf8Value.Get()), Utf8Value.Length());
+}
+
+bool FAccelByteUniqueIdEncoding::ReadString(const uint8* Bytes, int32 Size, int32& InOutOffset, FString& OutValue)
+{
+	uint32 Length = 0;
+	if (!ReadLength(Bytes, Size, InOutOffset, Length) || Length > static_cast<uint32>(Size - InOutOffset))
+	{
+		return false;
+	}
+
+	const FUTF8ToTCHAR TCharValue(reinterpret_cast<const ANSICHAR*>(Bytes + InOutOffset), static_cast<int32>(Length));
+	OutValue = FString(TCharValue.Length(), TCharValue.Get());
+	InOutOffset += static_cast<int32>(Length);
+	return true;
+}
@@ -0,0 +1,164 @@
+// Copyright (c) 2025 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#include "Utilities/AccelByteUniqueIdRegistry.h"
+
+FAccelByteUniqueIdRegistry& FAccelByteUniqueIdRegistry::Get()
+{
+	static FAccelByteUniqueIdRegistry Instance;
+	return Instance;
+}
+
+FUniqueNetIdAccelByteUserRef FAccelByteUniqueIdRegistry::FindOrAdd(const FAccelByteUniqueIdComposite& CompositeId, TFunctionRef<FUniqueNetIdAccelByteUserRef()> Factory)
+{
+	{
+		FReadScopeLock ReadLock(RegistryLock);
+		if (const TWeakPtr<FUniqueNetIdAccelByteUser const>* Found = IdsByComposite.Find(CompositeId))
+		{
+			if (const FUniqueNetIdAccelByteUserPtr UserId = Found->Pin())
+			{
+				HitCount.fetch_add(1, std::memory_order_relaxed);
+				return UserId.ToSharedRef();
+			}
+		}
+	}
+
+	MissCount.fetch_add(1, std::memory_order_relaxed);
+	const FUniqueNetIdAccelByteUserRef NewUserId = Factory();
+	if (!NewUserId->IsValid())
+	{
+		return NewUserId;
+	}
+
+	FWriteScopeLock WriteLock(RegistryLock);
+	EvictExpiredIfNeeded();
+	return AddToCompositeIndex(NewUserId);
+}
+
+FUniqueNetIdAccelByteUserRef FAccelByteUniqueIdRegistry::FindOrAddEncoded(const FString& EncodedId, TFunctionRef<FUniqueNetIdAccelByteUserRef()> Factory)
+{
+	{
+		FReadScopeLock ReadLock(RegistryLock);
+		if (const TWeakPtr<FUniqueNetIdAccelByteUser const>* Found = IdsByEncodedString.Find(EncodedId))
+		{
+			if (const FUniqueNetIdAccelByteUserPtr UserId = Found->Pin())
+			{
+				HitCount.fetch_add(1, std::memory_order_relaxed);
+				return UserId.ToSharedRef();
+			}
+		}
+	}
+
+	MissCount.fetch_add(1, std::memory_order_relaxed);
+	const FUniqueNetIdAccelByteUserRef NewUserId = Factory();
+	if (!NewUserId->IsValid())
+	{
+		return NewUserId;
+	}
+
+	FWriteScopeLock WriteLock(RegistryLock);
+	EvictExpiredIfNeeded();
+	const FUniqueNetIdAccelByteUserRef InternedUserId = AddToCompositeIndex(NewUserId);
+	IdsByEncodedString.Add(EncodedId, InternedUserId);
+	return InternedUserId;
+}
+
+FUniqueNetIdAccelByteUserRef FAccelByteUniqueIdRegistry::AddToCompositeIndex(const FUniqueNetIdAccelByteUserRef& UserId)
+{
+	TWeakPtr<FUniqueNetIdAccelByteUser const>& Entry = IdsByComposite.FindOrAdd(UserId->GetCompositeStructure());
+
+	// Another thread may have interned the same ID while ours was being created, keep theirs so there is only one
+	if (const FUniqueNetIdAccelByteUserPtr ExistingUserId = Entry.Pin())
+	{
+		return ExistingUserId.ToSharedRef();
+	}
+
+	Entry = UserId;
+	return UserId;
+}
+
+int32 FAccelByteUniqueIdRegistry::EvictExpired()
+{
+	FWriteScopeLock WriteLock(RegistryLock);
+	return EvictExpiredInternal();
+}
+
+void FAccelByteUniqueIdRegistry::EvictExpiredIfNeeded()
+{
+	if (IdsByComposite.Num() + IdsByEncodedString.Num() < EvictionThreshold)
+	{
+		return;
+	}
+
+	EvictExpiredInternal();
+
+	// Sweeping again before the live entries have doubled would make interning quadratic in the number of live IDs
+	EvictionThreshold = FMath::Max(MinEvictionThreshold, (IdsByComposite.Num() + IdsByEncodedString.Num()) * 2);
+}
+
+int32 FAccelByteUniqueIdRegistry::EvictExpiredInternal()
+{
+	int32 RemovedNum = 0;
+	for (FCompositeIndex::TIterator It(IdsByComposite); It; ++It)
+	{
+		if (!It.Value().IsValid())
+		{
+			It.RemoveCurrent();
+			RemovedNum++;
+		}
+	}
+
+	for (TMap<FString, TWeakPtr<FUniqueNetIdAccelByteUser const>>::TIterator It(IdsByEncodedString); It; ++It)
+	{
+		if (!It.Value().IsValid())
+		{
+			It.RemoveCurrent();
+			RemovedNum++;
+		}
+	}
+
+	EvictedCount += RemovedNum;
+	return RemovedNum;
+}
+
+FAccelByteUniqueIdRegistryStats FAccelByteUniqueIdRegistry::GetStats() const
+{
+	FAccelByteUniqueIdRegistryStats Stats;
+	Stats.HitCount = HitCount.load(std::memory_order_relaxed);
+	Stats.MissCount = MissCount.load(std::memory_order_relaxed);
+
+	FReadScopeLock ReadLock(RegistryLock);
+	Stats.EvictedCount = EvictedCount;
+	Stats.EntryNum = IdsByComposite.Num() + IdsByEncodedString.Num();
+	for (const TPair<FAccelByteUniqueIdComposite, TWeakPtr<FUniqueNetIdAccelByteUser const>>& Entry : IdsByComposite)
+	{
+		if (Entry.Value.IsValid())
+		{
+			Stats.LiveNum++;
+		}
+	}
+	return Stats;
+}
+
+void FAccelByteUniqueIdRegistry::ResetStats()
+{
+	HitCount.store(0, std::memory_order_relaxed);
+	MissCount.store(0, std::memory_order_relaxed);
+
+	FWriteScopeLock WriteLock(RegistryLock);
+	EvictedCount = 0;
+}
+
+void FAccelByteUniqueIdRegistry::Dump(FOutputDevice& Ar) const
+{
+	const FAccelByteUniqueIdRegistryStats Stats = GetStats();
+	const uint64 LookupCount = Stats.HitCount + Stats.MissCount;
+	Ar.Logf(TEXT("AccelByte unique ID registry: live IDs %d, entries %d, hits %llu, misses %llu, hit rate %.1f%%, evicted %llu")
+		, Stats.LiveNum
+		, Stats.EntryNum
+		, Stats.HitCount
+		, Stats.MissCount
+		, LookupCount > 0 ? 100.0 * Stats.HitCount / LookupCount : 0.0
+		, Stats.EvictedCount);
+}
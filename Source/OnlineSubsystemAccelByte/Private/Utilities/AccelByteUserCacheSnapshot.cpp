@@ -0,0 +1,284 @@
+// Copyright (c) 2025 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#include "Utilities/AccelByteUserCacheSnapshot.h"
+#include "Utilities/AccelByteUniqueIdEncoding.h"
+#include "OnlineUserCacheAccelByte.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "Policies/CondensedJsonPrintPolicy.h"
+
+namespace
+{
+	const uint8 SnapshotMagic[] = { 'A', 'B', 'U', 'C' };
+
+	constexpr int32 SnapshotHeaderSize = sizeof(SnapshotMagic) + 1;
+
+	constexpr int32 TicksSize = sizeof(int64);
+
+	void WriteTicks(int64 Ticks, TArray<uint8>& OutBytes)
+	{
+		for (int32 Shift = 0; Shift < 64; Shift += 8)
+		{
+			OutBytes.Add(static_cast<uint8>(static_cast<uint64>(Ticks) >> Shift));
+		}
+	}
+
+	bool ReadTicks(const uint8* Bytes, int32 Size, int32& InOutOffset, int64& OutTicks)
+	{
+		if (Size - InOutOffset < TicksSize)
+		{
+			return false;
+		}
+
+		uint64 Ticks = 0;
+		for (int32 Index = 0; Index < TicksSize; Index++)
+		{
+			Ticks |= static_cast<uint64>(Bytes[InOutOffset + Index]) << (Index * 8);
+		}
+		InOutOffset += TicksSize;
+		OutTicks = static_cast<int64>(Ticks);
+		return OutTicks >= 0;
+	}
+}
+
+void FAccelByteUserCacheSnapshot::WriteHeader(TArray<uint8>& OutBytes)
+{
+	OutBytes.Append(SnapshotMagic, sizeof(SnapshotMagic));
+	OutBytes.Add(Version);
+}
+
+void FAccelByteUserCacheSnapshot::WriteRecord(const FAccelByteUserInfo& User, TArray<uint8>& OutBytes)
+{
+	if (!User.Id.IsValid() || User.Id->GetAccelByteId().IsEmpty())
+	{
+		return;
+	}
+
+	FString CustomAttributesJson;
+	if (User.CustomAttributes.Values.Num() > 0)
+	{
+		const TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> Writer = TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&CustomAttributesJson);
+		FJsonSerializer::Serialize(MakeShared<FJsonObject>(User.CustomAttributes), Writer);
+	}
+
+	TArray<uint8> RecordBytes;
+	WriteTicks(User.LastUpdatedTime.GetTicks(), RecordBytes);
+	WriteCompactId(User.Id, RecordBytes);
+	FAccelByteUniqueIdEncoding::WriteString(User.DisplayName, RecordBytes);
+	FAccelByteUniqueIdEncoding::WriteString(User.UniqueDisplayName, RecordBytes);
+	FAccelByteUniqueIdEncoding::WriteString(User.PublicCode, RecordBytes);
+	FAccelByteUniqueIdEncoding::WriteString(User.GameAvatarUrl, RecordBytes);
+	FAccelByteUniqueIdEncoding::WriteString(User.PublisherAvatarUrl, RecordBytes);
+	FAccelByteUniqueIdEncoding::WriteString(CustomAttributesJson, RecordBytes);
+
+	FAccelByteUniqueIdEncoding::WriteLength(static_cast<uint32>(User.LinkedPlatformInfo.Num()), RecordBytes);
+	for (const FAccelByteLinkedUserInfo& LinkedInfo : User.LinkedPlatformInfo)
+	{
+		WriteCompactId(LinkedInfo.Id, RecordBytes);
+		FAccelByteUniqueIdEncoding::WriteString(LinkedInfo.DisplayName, RecordBytes);
+		FAccelByteUniqueIdEncoding::WriteString(LinkedInfo.PlatformId, RecordBytes);
+		FAccelByteUniqueIdEncoding::WriteString(LinkedInfo.AvatarUrl, RecordBytes);
+	}
+
+	FAccelByteUniqueIdEncoding::WriteLength(static_cast<uint32>(RecordBytes.Num()), OutBytes);
+	OutBytes.Append(RecordBytes);
+}
+
+bool FAccelByteUserCacheSnapshot::Load(TArray<uint8>&& InBytes, const FDateTime& MinUpdatedTime)
+{
+	if (InBytes.Num() < SnapshotHeaderSize
+		|| FMemory::Memcmp(InBytes.GetData(), SnapshotMagic, sizeof(SnapshotMagic)) != 0
+		|| InBytes[sizeof(SnapshotMagic)] != Version)
+	{
+		return false;
+	}
+
+	TMap<FString, FRecord> NewRecords;
+	int32 Offset = SnapshotHeaderSize;
+	while (Offset < InBytes.Num())
+	{
+		uint32 RecordSize = 0;
+		if (!FAccelByteUniqueIdEncoding::ReadLength(InBytes.GetData(), InBytes.Num(), Offset, RecordSize)
+			|| RecordSize > static_cast<uint32>(InBytes.Num() - Offset))
+		{
+			// Truncated by a crash while saving, keep the records indexed so far
+			break;
+		}
+
+		FRecord Record;
+		Record.Offset = Offset;
+		Record.Size = static_cast<int32>(RecordSize);
+		Offset += Record.Size;
+
+		// Only the update time and ID are read here, the rest of the record is decoded by Take
+		int32 RecordOffset = 0;
+		int64 Ticks = 0;
+		FAccelByteUniqueIdComposite CompositeId;
+		const uint8* RecordBytes = InBytes.GetData() + Record.Offset;
+		if (!ReadTicks(RecordBytes, Record.Size, RecordOffset, Ticks)
+			|| !ReadCompactId(RecordBytes, Record.Size, RecordOffset, CompositeId)
+			|| CompositeId.Id.IsEmpty()
+			|| Ticks < MinUpdatedTime.GetTicks())
+		{
+			continue;
+		}
+
+		NewRecords.Add(CompositeId.Id, Record);
+	}
+
+	FScopeLock ScopeLock(&SnapshotLock);
+	Bytes = MoveTemp(InBytes);
+	Records = MoveTemp(NewRecords);
+	RecordNum.store(Records.Num(), std::memory_order_relaxed);
+	return true;
+}
+
+FAccelByteUserInfoPtr FAccelByteUserCacheSnapshot::Take(const FString& AccelByteId)
+{
+	FScopeLock ScopeLock(&SnapshotLock);
+
+	FRecord Record;
+	if (!Records.RemoveAndCopyValue(AccelByteId, Record))
+	{
+		return nullptr;
+	}
+
+	const FAccelByteUserInfoRef User = MakeShared<FAccelByteUserInfo, ESPMode::ThreadSafe>();
+	const bool bIsDecoded = DecodeRecord(Bytes.GetData() + Record.Offset, Record.Size, User.Get());
+
+	RecordNum.store(Records.Num(), std::memory_order_relaxed);
+	if (Records.Num() == 0)
+	{
+		// Every record has been restored, the bytes are no longer needed
+		Bytes.Empty();
+	}
+
+	return bIsDecoded ? FAccelByteUserInfoPtr(User) : nullptr;
+}
+
+int32 FAccelByteUserCacheSnapshot::WriteRemainingRecords(const TSet<FString>& WrittenIds, int32 MaxNum, TArray<uint8>& OutBytes) const
+{
+	FScopeLock ScopeLock(&SnapshotLock);
+
+	int32 WrittenNum = 0;
+	for (const TPair<FString, FRecord>& Record : Records)
+	{
+		if (WrittenNum >= MaxNum)
+		{
+			break;
+		}
+
+		if (WrittenIds.Contains(Record.Key))
+		{
+			continue;
+		}
+
+		FAccelByteUniqueIdEncoding::WriteLength(static_cast<uint32>(Record.Value.Size), OutBytes);
+		OutBytes.Append(Bytes.GetData() + Record.Value.Offset, Record.Value.Size);
+		WrittenNum++;
+	}
+	return WrittenNum;
+}
+
+void FAccelByteUserCacheSnapshot::Reset()
+{
+	FScopeLock ScopeLock(&SnapshotLock);
+	Bytes.Empty();
+	Records.Empty();
+	RecordNum.store(0, std::memory_order_relaxed);
+}
+
+bool FAccelByteUserCacheSnapshot::DecodeRecord(const uint8* RecordBytes, int32 Size, FAccelByteUserInfo& OutUser)
+{
+	int32 Offset = 0;
+	int64 Ticks = 0;
+	FAccelByteUniqueIdComposite CompositeId;
+	FString CustomAttributesJson;
+	if (!ReadTicks(RecordBytes, Size, Offset, Ticks)
+		|| !ReadCompactId(RecordBytes, Size, Offset, CompositeId)
+		|| !FAccelByteUniqueIdEncoding::ReadString(RecordBytes, Size, Offset, OutUser.DisplayName)
+		|| !FAccelByteUniqueIdEncoding::ReadString(RecordBytes, Size, Offset, OutUser.UniqueDisplayName)
+		|| !FAccelByteUniqueIdEncoding::ReadString(RecordBytes, Size, Offset, OutUser.PublicCode)
+		|| !FAccelByteUniqueIdEncoding::ReadString(RecordBytes, Size, Offset, OutUser.GameAvatarUrl)
+		|| !FAccelByteUniqueIdEncoding::ReadString(RecordBytes, Size, Offset, OutUser.PublisherAvatarUrl)
+		|| !FAccelByteUniqueIdEncoding::ReadString(RecordBytes, Size, Offset, CustomAttributesJson))
+	{
+		return false;
+	}
+
+	uint32 LinkedNum = 0;
+	if (!FAccelByteUniqueIdEncoding::ReadLength(RecordBytes, Size, Offset, LinkedNum)
+		|| LinkedNum > static_cast<uint32>(Size - Offset))
+	{
+		return false;
+	}
+
+	OutUser.LinkedPlatformInfo.Reserve(static_cast<int32>(LinkedNum));
+	for (uint32 Index = 0; Index < LinkedNum; Index++)
+	{
+		FAccelByteUniqueIdComposite LinkedCompositeId;
+		FAccelByteLinkedUserInfo& LinkedInfo = OutUser.LinkedPlatformInfo.AddDefaulted_GetRef();
+		if (!ReadCompactId(RecordBytes, Size, Offset, LinkedCompositeId)
+			|| !FAccelByteUniqueIdEncoding::ReadString(RecordBytes, Size, Offset, LinkedInfo.DisplayName)
+			|| !FAccelByteUniqueIdEncoding::ReadString(RecordBytes, Size, Offset, LinkedInfo.PlatformId)
+			|| !FAccelByteUniqueIdEncoding::ReadString(RecordBytes, Size, Offset, LinkedInfo.AvatarUrl))
+		{
+			return false;
+		}
+
+		if (!LinkedCompositeId.Id.IsEmpty() || !LinkedCompositeId.PlatformId.IsEmpty())
+		{
+			LinkedInfo.Id = FUniqueNetIdAccelByteUser::Create(LinkedCompositeId);
+		}
+	}
+
+	if (!CustomAttributesJson.IsEmpty())
+	{
+		TSharedPtr<FJsonObject> CustomAttributes;
+		const TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(CustomAttributesJson);
+		if (FJsonSerializer::Deserialize(Reader, CustomAttributes) && CustomAttributes.IsValid())
+		{
+			OutUser.CustomAttributes = *CustomAttributes;
+		}
+	}
+
+	OutUser.Id = FUniqueNetIdAccelByteUser::Create(CompositeId);
+	OutUser.LastUpdatedTime = FDateTime(Ticks);
+	return true;
+}
+
+void FAccelByteUserCacheSnapshot::WriteCompactId(const TSharedPtr<const FUniqueNetIdAccelByteUser>& UserId, TArray<uint8>& OutBytes)
+{
+	if (!UserId.IsValid())
+	{
+		FAccelByteUniqueIdEncoding::WriteLength(0, OutBytes);
+		return;
+	}
+
+	TArray<uint8> IdBytes;
+	FAccelByteUniqueIdEncoding::EncodeCompact(UserId->GetCompositeStructure(), IdBytes);
+	FAccelByteUniqueIdEncoding::WriteLength(static_cast<uint32>(IdBytes.Num()), OutBytes);
+	OutBytes.Append(IdBytes);
+}
+
+bool FAccelByteUserCacheSnapshot::ReadCompactId(const uint8* RecordBytes, int32 Size, int32& InOutOffset, FAccelByteUniqueIdComposite& OutCompositeId)
+{
+	uint32 IdSize = 0;
+	if (!FAccelByteUniqueIdEncoding::ReadLength(RecordBytes, Size, InOutOffset, IdSize)
+		|| IdSize > static_cast<uint32>(Size - InOutOffset))
+	{
+		return false;
+	}
+
+	if (IdSize == 0)
+	{
+		OutCompositeId = FAccelByteUniqueIdComposite();
+		return true;
+	}
+
+	const bool bIsDecoded = FAccelByteUniqueIdEncoding::DecodeCompact(RecordBytes + InOutOffset, static_cast<int32>(IdSize), OutCompositeId);
+	InOutOffset += static_cast<int32>(IdSize);
+	return bIsDecoded;
+}
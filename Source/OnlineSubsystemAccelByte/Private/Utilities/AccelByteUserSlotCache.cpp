@@ -0,0 +1,132 @@
+// Copyright (c) 2025 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#include "Utilities/AccelByteUserSlotCache.h"
+
+FAccelByteUserSlotCache::FAccelByteUserSlotCache()
+{
+	for (std::atomic<const FAccelByteUserSlot*>& Slot : Slots)
+	{
+		Slot.store(nullptr, std::memory_order_relaxed);
+	}
+}
+
+FAccelByteUserSlotCache::~FAccelByteUserSlotCache()
+{
+	for (std::atomic<const FAccelByteUserSlot*>& Slot : Slots)
+	{
+		delete Slot.exchange(nullptr);
+	}
+
+	for (const FAccelByteUserSlot* RetiredSlot : RetiredSlots)
+	{
+		delete RetiredSlot;
+	}
+	RetiredSlots.Empty();
+}
+
+bool FAccelByteUserSlotCache::Find(int32 LocalUserNum, FAccelByteUserSlot& OutSlot) const
+{
+	if (LocalUserNum < 0 || LocalUserNum >= MAX_LOCAL_PLAYERS)
+	{
+		return false;
+	}
+
+	// Registered before loading, so that a writer cannot free the slot while it is being copied
+	ReaderNum.fetch_add(1);
+	const FAccelByteUserSlot* Slot = Slots[LocalUserNum].load();
+	if (Slot != nullptr)
+	{
+		OutSlot = *Slot;
+	}
+	ReaderNum.fetch_sub(1);
+
+	return Slot != nullptr;
+}
+
+bool FAccelByteUserSlotCache::FindByUserId(const FUniqueNetIdAccelByteUser& UserId, int32& OutLocalUserNum, FAccelByteUserSlot& OutSlot) const
+{
+	bool bIsFound = false;
+	ReaderNum.fetch_add(1);
+	for (int32 LocalUserNum = 0; LocalUserNum < MAX_LOCAL_PLAYERS; LocalUserNum++)
+	{
+		const FAccelByteUserSlot* Slot = Slots[LocalUserNum].load();
+		if (Slot != nullptr && Slot->UserId.IsValid() && Slot->UserId->GetAccelByteId() == UserId.GetAccelByteId())
+		{
+			OutLocalUserNum = LocalUserNum;
+			OutSlot = *Slot;
+			bIsFound = true;
+			break;
+		}
+	}
+	ReaderNum.fetch_sub(1);
+
+	return bIsFound;
+}
+
+void FAccelByteUserSlotCache::Publish(int32 LocalUserNum, const AccelByte::FApiClientPtr& ApiClient, const FUniqueNetIdAccelByteUserPtr& UserId)
+{
+	if (LocalUserNum < 0 || LocalUserNum >= MAX_LOCAL_PLAYERS)
+	{
+		return;
+	}
+
+	{
+		// Login status changes republish the same user, there is nothing to replace then
+		FScopeLock ScopeLock(&PublishLock);
+		const FAccelByteUserSlot* CurrentSlot = Slots[LocalUserNum].load(std::memory_order_relaxed);
+		if (CurrentSlot != nullptr && CurrentSlot->ApiClient == ApiClient && CurrentSlot->UserId == UserId)
+		{
+			return;
+		}
+	}
+
+	FAccelByteUserSlot* NewSlot = new FAccelByteUserSlot();
+	NewSlot->ApiClient = ApiClient;
+	NewSlot->UserId = UserId;
+	Swap(LocalUserNum, NewSlot);
+}
+
+void FAccelByteUserSlotCache::Invalidate(int32 LocalUserNum)
+{
+	if (LocalUserNum < 0 || LocalUserNum >= MAX_LOCAL_PLAYERS)
+	{
+		return;
+	}
+
+	Swap(LocalUserNum, nullptr);
+}
+
+void FAccelByteUserSlotCache::Swap(int32 LocalUserNum, FAccelByteUserSlot* NewSlot)
+{
+	FScopeLock ScopeLock(&PublishLock);
+	if (NewSlot != nullptr)
+	{
+		NewSlot->Version = NextVersion++;
+	}
+
+	const FAccelByteUserSlot* OldSlot = Slots[LocalUserNum].exchange(NewSlot);
+	if (OldSlot != nullptr)
+	{
+		RetiredSlots.Add(OldSlot);
+	}
+
+	FreeRetiredSlots();
+}
+
+void FAccelByteUserSlotCache::FreeRetiredSlots()
+{
+	// Slots are retired before the reader count is checked, and readers register before loading a slot. A reader that is
+	// not counted here has either finished copying, or will load a slot that is still published.
+	if (RetiredSlots.Num() == 0 || ReaderNum.load() != 0)
+	{
+		return;
+	}
+
+	for (const FAccelByteUserSlot* RetiredSlot : RetiredSlots)
+	{
+		delete RetiredSlot;
+	}
+	RetiredSlots.Reset();
+}
@@ -14,12 +14,23 @@
 #include "OnlineError.h"
 #include "OnlineSubsystemTypes.h"
 
+/**
+ * Task that runs a group of child tasks as a dependency graph. Nodes are stored flat in a single array for the lifetime
+ * of the Epic, and only children whose prerequisites have all completed are initialized and ticked.
+ *
+ * Children enqueued as Parallel run alongside the most recent group of children, children enqueued as Serial wait for
+ * that group to complete. A child enqueued by a running child of this Epic is nested work of that parent instead: it
+ * starts right away, Serial ones chained after the previous nested Serial child of the same parent, and everything
+ * waiting on the parent also waits on it. A Serial child without a running parent that is enqueued while the most
+ * recent group is running is treated as nested work of that group.
+ *
+ * Children are ticked and initialized outside of the graph lock, so they are free to enqueue more children.
+ */
 class FOnlineAsyncEpicTaskAccelByte
 	: public FOnlineAsyncTaskAccelByte
 	, public AccelByte::TSelfPtr<FOnlineAsyncEpicTaskAccelByte, ESPMode::ThreadSafe>
 {
 	uint32 EpicID = 0;
-	TDoubleLinkedList<TArray<FOnlineAsyncTaskAccelByte*>> TaskContainer;
 
 public:
 	FOnlineAsyncEpicTaskAccelByte(FOnlineSubsystemAccelByte* const InABSubsystem, int32 InLocalUserNum, const FVoidHandler& InDelegate) 
@@ -37,17 +48,47 @@ public:
 	void SetEpicID(uint32 ID) { EpicID = ID; }
 	uint32 GetEpicID() { return EpicID; }
 
-	/** Set the current Task/Epic as timeout along with all the task in the TaskContainer */
+	/** Set the current Task/Epic as timeout along with every child that has not completed yet */
 	void Timeout();
-	
-	uint32 GetCurrentStackCapacity() { return TaskContainer.Num(); }
 
-	//TODO cyclic checking 
-	//recursively check GetParentTask(...) , collect it, and detect it etc.
+	/** Cancel the Epic along with every child that has not completed yet, none of their delegates will be triggered */
+	virtual void ForcefullySetCancelledState() override;
+
+	/**
+	 * Add a child task to the graph, see the class comment for how TaskType orders it against the other children.
+	 *
+	 * @param TaskType How the child is ordered against the children enqueued before it
+	 * @param ChildTask Child to add, ownership is handed over to the OutQueue once it completes
+	 */
 	void Enqueue(ETypeOfOnlineAsyncTask TaskType, FOnlineAsyncTaskAccelByte* ChildTask);
 
-	/** For test assertion purpose */
-	const TDoubleLinkedList<TArray<FOnlineAsyncTaskAccelByte*>>& GetTaskContainer() { return TaskContainer; }
+	/** Number of children that have not completed yet */
+	int32 GetPendingTaskNum() const;
+
+	/** Number of children that have been initialized and are being ticked */
+	int32 GetRunningTaskNum() const;
+
+	/**
+	 * Number of groups returned by GetTaskContainer.
+	 *
+	 * @deprecated Children are no longer stored as a stack of groups, use GetPendingTaskNum or GetRunningTaskNum instead.
+	 */
+	uint32 GetCurrentStackCapacity();
+
+	/**
+	 * For test assertion purpose. Builds a view of the children that have not completed yet: the first group holds the
+	 * children that are running or about to start, the second one, if any, the children waiting on prerequisites. The
+	 * view is rebuilt on every call.
+	 *
+	 * @deprecated Children are no longer stored as a stack of groups, use GetPendingTaskNum or GetRunningTaskNum instead.
+	 */
+	const TDoubleLinkedList<TArray<FOnlineAsyncTaskAccelByte*>>& GetTaskContainer();
+
+	/** Epic names embed the Epic ID, group every Epic under the same name for metrics */
+	virtual FString GetMetricsName() const override
+	{
+		return TEXT("FOnlineAsyncEpicTaskAccelByte");
+	}
 
 protected:
 
@@ -58,11 +99,85 @@ protected:
 	}
 
 private:
-	bool bIsTopStackRunning();
-	
+	enum class ENodeState : uint8
+	{
+		/** Waiting for at least one prerequisite to complete */
+		Waiting,
+		/** Every prerequisite has completed, will be initialized on the next tick */
+		Ready,
+		/** Initialized and ticked every tick */
+		Running,
+		/** Completed and handed over to the OutQueue */
+		Done
+	};
+
+	struct FNode
+	{
+		FOnlineAsyncTaskAccelByte* Task = nullptr;
+
+		/** Indices of the nodes waiting on this one */
+		TArray<int32, TInlineAllocator<4>> Dependents;
+
+		/** Number of prerequisites that have not completed yet */
+		int32 RemainingPrerequisites = 0;
+
+		/** Last Serial child that was enqueued as nested work of this node */
+		int32 LastNestedSerialChild = INDEX_NONE;
+
+		ENodeState State = ENodeState::Waiting;
+	};
+
+	/** Every child ever enqueued, indices are stable for the lifetime of the Epic */
+	TArray<FNode, TInlineAllocator<8>> Nodes;
+
+	/** Index of the node of every child, a child is looked up whenever one of its own children is enqueued */
+	TMap<const FOnlineAsyncTaskAccelByte*, int32> NodeIndices;
+
+	/** Nodes to initialize on the next tick */
+	TArray<int32, TInlineAllocator<8>> ReadyNodes;
+
+	/** Nodes that are initialized and ticked */
+	TArray<int32, TInlineAllocator<8>> RunningNodes;
+
+	/** Scratch copy of ReadyNodes while starting them */
+	TArray<int32, TInlineAllocator<8>> StartingNodes;
+
+	/** Scratch buffers of Tick, kept between ticks so they are not allocated again every tick */
+	TArray<TPair<int32, FOnlineAsyncTaskAccelByte*>, TInlineAllocator<8>> TickingNodes;
+	TArray<int32, TInlineAllocator<8>> DoneNodes;
+	TArray<FOnlineAsyncTaskAccelByte*, TInlineAllocator<8>> CompletedTasks;
+	TArray<FOnlineAsyncTaskAccelByte*, TInlineAllocator<8>> StartingTasks;
+	TArray<FOnlineAsyncTaskAccelByte*, TInlineAllocator<8>> CancelledTasks;
+
+	/** Most recent group of children, and the prerequisites shared by every child of that group */
+	TArray<int32, TInlineAllocator<8>> TailGroup;
+	TArray<int32, TInlineAllocator<8>> TailGroupPrerequisites;
+
+	/** Last Serial child without a running parent that was enqueued as nested work of a running group */
+	int32 LastNestedSerialNode = INDEX_NONE;
+
+	/** View of the graph returned by GetTaskContainer */
+	TDoubleLinkedList<TArray<FOnlineAsyncTaskAccelByte*>> LegacyTaskContainer;
+
+	int32 PendingNodeNum = 0;
+
+	/** Time of the previous tick, used to accumulate tick time on children for their timeouts */
+	double LastTickTimeInSeconds = 0.0;
+
+	/** Guards the graph, children can be enqueued from any thread while the Epic is ticked on the online thread */
+	mutable FCriticalSection GraphLock;
+
+	int32 FindNode(const FOnlineAsyncTaskAccelByte* Task) const;
+	bool IsGroupRunning(const TArray<int32, TInlineAllocator<8>>& Group) const;
+	void LinkPrerequisite(int32 NodeIndex, int32 PrerequisiteIndex);
+	void CompleteNode(int32 NodeIndex);
+
+	/** Mark every child that has not completed yet as done, and return them so they can be handed over outside of the lock */
+	void TakePendingTasks(TArray<FOnlineAsyncTaskAccelByte*, TInlineAllocator<8>>& OutTasks);
+
 	double GetWorldDelta();
 
 	/** Delegate fired on Epic Task completion */
 	FVoidHandler Delegate;
 
-};
\ No newline at end of file
+};
@@ -12,10 +12,21 @@
 #include "OnlineSubsystemAccelByte.h"
 #include "Core/AccelByteMultiRegistry.h"
 #include "Core/AccelByteError.h"
+#include "Utilities/AccelByteTimeoutWheel.h"
+#include "Utilities/AccelByteAsyncTaskPool.h"
+#include "Utilities/AccelByteCancellationToken.h"
+#include "Utilities/AccelByteRetryPolicy.h"
+#include <atomic>
 
-#define AB_OSS_ASYNC_TASK_TRACE_BEGIN_VERBOSITY(Verbosity, Format, ...) UE_LOG_AB(Verbosity, TEXT(">>> %s::%s (AsyncTask method) was called. Args: ") Format, *GetTaskName(), *FString(__func__), ##__VA_ARGS__)
+/**
+ * Trace macros for async task methods, see AB_OSS_TRACE_LOG for how they are stripped at compile time. With
+ * AB_OSS_TRACE_INSIGHTS set, the begin trace also opens an Insights CPU scope named after the task, method and local user.
+ */
+#define AB_OSS_ASYNC_TASK_TRACE_BEGIN_VERBOSITY(Verbosity, Format, ...) \
+	AB_OSS_TRACE_SCOPE(FString::Printf(TEXT("%s::%s [LocalUserNum %d]"), *GetTaskName(), ANSI_TO_TCHAR(__func__), LocalUserNum)) \
+	AB_OSS_TRACE_LOG(Verbosity, TEXT(">>> %s::%s (AsyncTask method) was called. Args: ") Format, *GetTaskName(), ANSI_TO_TCHAR(__func__), ##__VA_ARGS__)
 #define AB_OSS_ASYNC_TASK_TRACE_BEGIN(Format, ...) AB_OSS_ASYNC_TASK_TRACE_BEGIN_VERBOSITY(Verbose, Format, ##__VA_ARGS__)
-#define AB_OSS_ASYNC_TASK_TRACE_END_VERBOSITY(Verbosity, Format, ...) UE_LOG_AB(Verbosity, TEXT("<<< %s::%s (AsyncTask method) has finished execution. ") Format, *GetTaskName(), *FString(__func__), ##__VA_ARGS__)
+#define AB_OSS_ASYNC_TASK_TRACE_END_VERBOSITY(Verbosity, Format, ...) AB_OSS_TRACE_LOG(Verbosity, TEXT("<<< %s::%s (AsyncTask method) has finished execution. ") Format, *GetTaskName(), ANSI_TO_TCHAR(__func__), ##__VA_ARGS__)
 #define AB_OSS_ASYNC_TASK_TRACE_END(Format, ...) AB_OSS_ASYNC_TASK_TRACE_END_VERBOSITY(Verbose, Format, ##__VA_ARGS__)
 
 /**
@@ -95,7 +106,9 @@ enum class EAccelByteAsyncTaskCompleteState : uint8
 	TimedOut,
 	RequestFailed,
 	InvalidState,
-	Incomplete
+	Incomplete,
+	Rejected,
+	Cancelled
 };
 
 const static inline FString AsyncTaskCompleteStateToString(const EAccelByteAsyncTaskCompleteState& CompleteState)
@@ -112,6 +125,10 @@ const static inline FString AsyncTaskCompleteStateToString(const EAccelByteAsync
 		return TEXT("Invalid state");
 	case EAccelByteAsyncTaskCompleteState::Incomplete:
 		return TEXT("Incomplete");
+	case EAccelByteAsyncTaskCompleteState::Rejected:
+		return TEXT("Rejected");
+	case EAccelByteAsyncTaskCompleteState::Cancelled:
+		return TEXT("Cancelled");
 	}
 	return TEXT("Unknown");
 }
@@ -260,11 +277,33 @@ public:
 		, uint8 InFlags
 		, TSharedPtr<FAccelByteKey> InLockKey);
 
+	virtual ~FOnlineAsyncTaskAccelByte();
+
+	/**
+	 * Tasks are created and destroyed at a high rate, recycle their memory through the task pool. The destructor is
+	 * virtual, so the size given on delete is always the size of the most derived task.
+	 */
+	static void* operator new(SIZE_T Size)
+	{
+		return FAccelByteAsyncTaskPool::Get().Allocate(Size);
+	}
+
+	static void operator delete(void* Block, SIZE_T Size)
+	{
+		FAccelByteAsyncTaskPool::Get().Release(Block, Size);
+	}
+
 	/**
 	 * Simple tick override to check if we are using timeouts, and if so check the task timeout and complete the task unsuccessfully if it's over its timeout
 	 */
 	virtual void Tick() override
 	{
+		if (IsCancelled())
+		{
+			ForcefullySetCancelledState();
+			return;
+		}
+
 		if (HasTaskTimedOut())
 		{
 			UE_LOG(LogAccelByteOSS, Warning, TEXT("Task %s has been idle for longer than %f s"), *GetTaskName(), TaskTimeoutInSeconds);
@@ -275,6 +314,8 @@ public:
 			}
 		}
 
+		TickPendingRetry();
+
 		// If we are not currently in the working state, then kick off the work we need to do for the task
 		if (CurrentState != EAccelByteAsyncTaskState::Working)
 		{
@@ -298,15 +339,21 @@ public:
 	{
 		CurrentState = EAccelByteAsyncTaskState::Initializing;
 
+		if (InitializedTimeInSeconds <= 0.0)
+		{
+			InitializedTimeInSeconds = FPlatformTime::Seconds();
+		}
+
 		// We only care about setting the last update time if we are using a timeout
 		if (bShouldUseTimeout)
 		{
 			SetLastUpdateTimeToCurrentTime();
+			ScheduleTimeout();
 		}
 
 		// Do not attempt to get API clients for server async tasks, as servers do not have API client support.
 		// We also don't need to get the corresponding user ID for the server, as server's don't have user IDs.
-		if (!HasFlag(EAccelByteAsyncTaskFlags::ServerTask))
+		if (!HasFlag(EAccelByteAsyncTaskFlags::ServerTask) && !ResolveUserFromSlotCache())
 		{
 			if (LocalUserNum != INVALID_CONTROLLERID)
 			{
@@ -338,14 +385,70 @@ public:
 			return DeltaTickAccumulation >= TaskTimeoutInSeconds;
 		}
 
-		FScopeLock ScopeLock(&TimeoutLock);
-		const double CurrentTimeInSeconds = FPlatformTime::Seconds();
-		return (CurrentTimeInSeconds - LastTaskUpdateInSeconds >= TaskTimeoutInSeconds);
+		// Tasks in the timeout wheel are flagged once their deadline has passed, no need to check the time ourselves
+		if (TimeoutWheel.IsValid())
+		{
+			return bHasTimeoutExpired.load(std::memory_order_acquire);
+		}
+
+		return FPlatformTime::Seconds() >= GetTimeoutDeadlineInSeconds();
+	}
+
+	/** Time in seconds at which this task times out if it does not make any progress until then */
+	double GetTimeoutDeadlineInSeconds() const
+	{
+		return LastTaskUpdateInSeconds.load(std::memory_order_acquire) + TaskTimeoutInSeconds;
+	}
+
+	/** Intended to be used by the timeout wheel once the deadline of this task has passed */
+	void MarkTimeoutExpired()
+	{
+		bHasTimeoutExpired.store(true, std::memory_order_release);
 	}
 
 	/** Intended to be used by Epic against child Task */
 	void ForcefullySetTimeoutState();
 
+	/**
+	 * Intended to be used by the async task manager when shedding a task that was never initialized, completes the task
+	 * unsuccessfully so that its delegates are still triggered from the OutQueue.
+	 */
+	void ForcefullySetRejectedState();
+
+	/**
+	 * Complete the task as cancelled, it is still finalized but its delegates will not be triggered. Used by the task
+	 * itself once its cancellation token is cancelled, and by the async task manager to retire cancelled tasks that are
+	 * still queued.
+	 */
+	virtual void ForcefullySetCancelledState();
+
+	/** Whether the result of this task is no longer wanted, see FAccelByteCancellationToken */
+	bool IsCancelled() const
+	{
+		return CancellationToken.IsValid() && CancellationToken->IsCancelled();
+	}
+
+	/** Token that cancels this task, can be nullptr if the task cannot be cancelled */
+	FAccelByteCancellationTokenPtr GetCancellationToken() const { return CancellationToken; }
+
+	/** Intended to be used by the subsystem when dispatching this task, children are given the token of their parent */
+	void SetCancellationToken(const FAccelByteCancellationTokenPtr& InCancellationToken) { CancellationToken = InCancellationToken; }
+
+	/** Retry policy of this task, also tells which service the task talks to */
+	const FAccelByteRetryPolicy& GetRetryPolicy() const { return RetryPolicy; }
+
+	/** Number of times the request of this task has been sent, including the first one */
+	int32 GetAttemptNum() const { return AttemptNum; }
+
+	/** Priority the task was dispatched with, used to order delegates when the game thread drain is over budget */
+	EAccelByteAsyncTaskPriority GetPriority() const { return Priority; }
+
+	/** Intended to be used by the subsystem when dispatching this task */
+	void SetPriority(EAccelByteAsyncTaskPriority InPriority) { Priority = InPriority; }
+
+	/** Enum representing the state that this task has finished in, Incomplete until the task is complete */
+	EAccelByteAsyncTaskCompleteState GetCompleteState() const { return CompleteState; }
+
 	virtual FString ToString() const override
 	{
 		const FString CompleteStateString = AsyncTaskCompleteStateToString(CompleteState);
@@ -356,6 +459,9 @@ public:
 	
 	int32 GetLocalUserNum() { return LocalUserNum; }
 
+	/** ID of the user performing this task, can be nullptr if the task was created with a local user num only */
+	FUniqueNetIdAccelByteUserPtr GetTaskUserId() const { return UserId; }
+
 	/** To set the current task's parent. To determine is this a nested task or not. */
 	virtual void SetParentTask(FOnlineAsyncTaskAccelByte* Task) { ParentTask = Task; }
 
@@ -371,6 +477,30 @@ public:
 		Epic = AssignedEpic;
 	}
 
+	/**
+	 * Name used to group this task in the async task manager metrics. Defaults to the task name, tasks that embed
+	 * per-instance data in their name should override this to return a stable name.
+	 */
+	virtual FString GetMetricsName() const
+	{
+		return GetTaskName();
+	}
+
+	/** Key of the coalesced request this task serves, empty if the task was not dispatched through request coalescing */
+	const FString& GetCoalescingKey() const { return CoalescingKey; }
+
+	/** Intended to be used by the subsystem when dispatching this task as the in-flight task of a coalesced request */
+	void SetCoalescingKey(const FString& InCoalescingKey) { CoalescingKey = InCoalescingKey; }
+
+	/** Time in seconds when this task was constructed, which is right before it is dispatched */
+	double GetCreatedTimeInSeconds() const { return CreatedTimeInSeconds; }
+
+	/** Time in seconds when this task was initialized, or zero if it has not been initialized yet */
+	double GetInitializedTimeInSeconds() const { return InitializedTimeInSeconds; }
+
+	/** Time in seconds when this task was marked as complete, or zero if it has not been completed yet */
+	double GetCompletedTimeInSeconds() const { return CompletedTimeInSeconds; }
+
 	bool SetLocalUserNum(int32 InLocalUserNum)
 	{
 		if (LocalUserNum >= INVALID_CONTROLLERID
@@ -390,6 +520,29 @@ protected:
 	/** Need to use this instead of using parent's member FOnlineAsyncTaskBasic::Subsystem T* raw pointer */
 	FOnlineSubsystemAccelByteWPtr AccelByteSubsystem;
 
+	/** Key of the coalesced request this task serves, see FAccelByteRequestCoalescer */
+	FString CoalescingKey;
+
+	/** Token shared with every other task of the same local user, or with the parent task for nested tasks */
+	FAccelByteCancellationTokenPtr CancellationToken;
+
+	/** How failed requests of this task are retried, tasks opt in by setting a policy in their constructor */
+	FAccelByteRetryPolicy RetryPolicy;
+
+	/** Number of times the request of this task has been sent, including the first one */
+	int32 AttemptNum = 1;
+
+	/** Request to send again once NextRetryTimeInSeconds has passed, run from Tick on the online thread */
+	TFunction<void()> PendingRetry;
+
+	double NextRetryTimeInSeconds = 0.0;
+
+	/** Lock for the pending retry, SDK error handlers may run on any thread */
+	FCriticalSection RetryLock;
+
+	/** Priority the task was dispatched with */
+	EAccelByteAsyncTaskPriority Priority = EAccelByteAsyncTaskPriority::Normal;
+
 	/** Enum representing the current state of a task as a whole */
 	EAccelByteAsyncTaskState CurrentState = EAccelByteAsyncTaskState::Uninitialized;
 
@@ -400,7 +553,7 @@ protected:
 	bool bShouldUseTimeout = false;
 
 	/** Time in seconds since the last time an async portion of a task has updated its timeout */
-	double LastTaskUpdateInSeconds = FPlatformTime::Seconds();
+	std::atomic<double> LastTaskUpdateInSeconds{ FPlatformTime::Seconds() };
 
 	/** Time in seconds that we should timeout this request, set to 30 seconds by default */
 	double TaskTimeoutInSeconds = 30.0;
@@ -408,8 +561,20 @@ protected:
 	/** Time that we will use to deteremine whether should we timeout this request. Unit in Seconds */
 	double DeltaTickAccumulation = 0.0;
 
-	/** Critical section for locking the last update time in seconds */
-	FCriticalSection TimeoutLock;
+	/** Set by the timeout wheel once the deadline of this task has passed */
+	std::atomic<bool> bHasTimeoutExpired{ false };
+
+	/** Timeout wheel this task is scheduled in, invalid if the task checks its own deadline */
+	TWeakPtr<FAccelByteTimeoutWheel, ESPMode::ThreadSafe> TimeoutWheel;
+
+	/** Time in seconds when this task was constructed, used to measure how long the task waited to be initialized */
+	double CreatedTimeInSeconds = FPlatformTime::Seconds();
+
+	/** Time in seconds when this task was first initialized */
+	double InitializedTimeInSeconds = 0.0;
+
+	/** Time in seconds when this task was marked as complete */
+	double CompletedTimeInSeconds = 0.0;
 
 	/**
 	 * Index of the user that we want to perform actions with, can be blank in favor of a user ID. Will be set to
@@ -459,6 +624,7 @@ protected:
 
 		CurrentState = EAccelByteAsyncTaskState::Completed;
 		CompleteState = InCompleteState;
+		CompletedTimeInSeconds = FPlatformTime::Seconds();
 		bWasSuccessful = (CompleteState == EAccelByteAsyncTaskCompleteState::Success);
 		bIsComplete = true;
 	}
@@ -471,9 +637,37 @@ protected:
 	 */
 	virtual void SetLastUpdateTimeToCurrentTime()
 	{
-		FScopeLock ScopeLock(&TimeoutLock);
-		LastTaskUpdateInSeconds = FPlatformTime::Seconds();
+		LastTaskUpdateInSeconds.store(FPlatformTime::Seconds(), std::memory_order_release);
+
+		// Progress made after the wheel flagged us but before we ticked wins, put the task back in the wheel
+		if (bHasTimeoutExpired.exchange(false, std::memory_order_acq_rel))
+		{
+			ScheduleTimeout();
+		}
 	}
+
+	/**
+	 * Retry a failed request according to RetryPolicy, meant to be called first thing from an SDK error handler:
+	 *
+	 *     if (TryRetryRequest(ErrorCode, [this]() { SendRequest(); })) { return; }
+	 *
+	 * Retryable errors also count as a failure of the service circuit breaker. A retry is refused once every attempt has
+	 * been used, when the error is not retryable, or when the circuit breaker of the service is open.
+	 *
+	 * @param ErrorCode Error code given to the SDK error handler
+	 * @param Retry Sends the request again, called from Tick once the backoff has passed
+	 * @return true if a retry was scheduled, in which case the error handler should not complete the task
+	 */
+	bool TryRetryRequest(int32 ErrorCode, TFunction<void()>&& Retry);
+
+	/** Send the pending retry if its backoff has passed, called from Tick */
+	void TickPendingRetry();
+
+	/**
+	 * Schedule this task in the timeout wheel of the async task manager. Tasks run by an Epic, and tasks dispatched
+	 * while the wheel is disabled, keep checking their own deadline on tick.
+	 */
+	void ScheduleTimeout();
 		
 	template<typename T>
 	void RaiseGenericError(T Args)
@@ -651,6 +845,14 @@ protected:
 		}
 	}
 
+	/**
+	 * Resolve the API client, user ID and local user num of this task from the user slot cache of the subsystem, in a
+	 * single lock free read.
+	 *
+	 * @return false if the user has no complete slot, in which case they should be resolved through the identity interface
+	 */
+	bool ResolveUserFromSlotCache();
+
 	/**
 	 * Handler for when the async task has officially kicked off work (i.e. when we have moved off the game thread)
 	 */
@@ -6,6 +6,7 @@
 
 #include "CoreMinimal.h"
 #include "OnlineSubsystemAccelByteTypes.h"
+#include "Utilities/AccelByteUniqueIdEncoding.h"
 #if !(ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 1)
 #include "NboSerializer.h"
 #else
@@ -45,7 +46,18 @@ public:
 
 	friend inline FNboSerializeToBufferAccelByte& operator<<(FNboSerializeToBufferAccelByte& Ar, const FUniqueNetIdAccelByteUser& UniqueId)
 	{
-		((FNboSerializeToBuffer&)Ar) << UniqueId.UniqueNetIdStr;
+		if (!FAccelByteUniqueIdEncoding::IsCompactNboEnabled())
+		{
+			((FNboSerializeToBuffer&)Ar) << UniqueId.ToString();
+			return Ar;
+		}
+
+		// The marker takes the place of the length of the legacy string, so readers can tell both forms apart
+		TArray<uint8> CompactBytes;
+		FAccelByteUniqueIdEncoding::EncodeCompact(UniqueId.GetCompositeStructure(), CompactBytes);
+		const int32 Marker = FAccelByteUniqueIdEncoding::CompactNboMarker;
+		((FNboSerializeToBuffer&)Ar) << Marker << CompactBytes.Num();
+		Ar.WriteBinary(CompactBytes.GetData(), CompactBytes.Num());
 		return Ar;
 	}
 
@@ -82,12 +94,43 @@ public:
 		return Ar;
 	}
 	
-	friend inline FNboSerializeFromBufferAccelByte& operator>>(FNboSerializeFromBufferAccelByte& Ar, FUniqueNetIdAccelByteUser& UniqueId)
+	/** Reads user IDs written in either the compact or the legacy form */
+	friend inline FNboSerializeFromBufferAccelByte& operator>>(FNboSerializeFromBufferAccelByte& Ar, FUniqueNetIdAccelByteUserRef& UniqueId)
 	{
-		Ar >> UniqueId.UniqueNetIdStr;
+		const int32 StartPos = Ar.CurrentPos;
+		int32 Marker = 0;
+		Ar >> Marker;
+		if (Marker != FAccelByteUniqueIdEncoding::CompactNboMarker)
+		{
+			Ar.CurrentPos = StartPos;
+			FString EncodedId;
+			Ar >> EncodedId;
+			UniqueId = Ar.HasOverflow() ? FUniqueNetIdAccelByteUser::Invalid() : FUniqueNetIdAccelByteUser::Create(EncodedId);
+			return Ar;
+		}
+
+		int32 Size = 0;
+		Ar >> Size;
+		if (Ar.HasOverflow() || Size < 0 || Size > Ar.NumBytes - Ar.CurrentPos)
+		{
+			Ar.bHasOverflowed = true;
+			UniqueId = FUniqueNetIdAccelByteUser::Invalid();
+			return Ar;
+		}
+
+		FAccelByteUniqueIdComposite CompositeId;
+		const bool bIsDecoded = FAccelByteUniqueIdEncoding::DecodeCompact(Ar.Data + Ar.CurrentPos, Size, CompositeId);
+		Ar.CurrentPos += Size;
+		UniqueId = bIsDecoded ? FUniqueNetIdAccelByteUser::Create(CompositeId) : FUniqueNetIdAccelByteUser::Invalid();
 		return Ar;
 	}
 
+	/**
+	 * User IDs are immutable and may be shared through the ID registry, so they cannot be read in place. Read into a
+	 * FUniqueNetIdAccelByteUserRef instead.
+	 */
+	friend FNboSerializeFromBufferAccelByte& operator>>(FNboSerializeFromBufferAccelByte& Ar, FUniqueNetIdAccelByteUser& UniqueId) = delete;
+
 	friend inline FNboSerializeFromBufferAccelByte& operator>>(FNboSerializeFromBufferAccelByte& Ar, FUniqueNetIdAccelByteResource& UniqueId)
 	{
 		Ar >> UniqueId.UniqueNetIdStr;
@@ -6,8 +6,35 @@
 
 #include "CoreMinimal.h"
 #include "OnlineAsyncTaskManager.h"
+#include "OnlineSubsystemAccelByteTypes.h"
+#include "Utilities/AccelByteAsyncTaskMetrics.h"
+#include "Utilities/AccelByteTimeoutWheel.h"
+#include "Utilities/AccelByteCancellationToken.h"
+#include "Utilities/AccelByteCircuitBreaker.h"
+#include "Stats/Stats.h"
+
+DECLARE_STATS_GROUP(TEXT("AccelByte OSS"), STATGROUP_AccelByteOSS, STATCAT_Advanced);
 
 class FOnlineSubsystemAccelByte;
+class FOnlineAsyncTaskAccelByte;
+
+/**
+ * Counters for a single admission priority of parallel tasks
+ */
+struct ONLINESUBSYSTEMACCELBYTE_API FAccelByteAsyncTaskAdmissionStats
+{
+	/** Tasks that were started straight away */
+	uint64 AdmittedCount = 0;
+
+	/** Tasks that had to wait in the overflow queue before being started */
+	uint64 OverflowedCount = 0;
+
+	/** Tasks that were rejected because the overflow queue was full */
+	uint64 ShedCount = 0;
+
+	/** Highest number of tasks of this priority waiting in the overflow queue at once */
+	int32 PeakOverflowNum = 0;
+};
 
 class ONLINESUBSYSTEMACCELBYTE_API FOnlineAsyncTaskManagerAccelByte : public FOnlineAsyncTaskManager
 {
@@ -16,12 +43,135 @@ public:
 	/** Constructor to set up the cached parent subsystem for this manager instance */
 	FOnlineAsyncTaskManagerAccelByte(FOnlineSubsystemAccelByte* ParentSubsystem);
 
-	virtual ~FOnlineAsyncTaskManagerAccelByte() = default;
+	virtual ~FOnlineAsyncTaskManagerAccelByte();
 
 	void OnlineTick() override;
 
+	/**
+	 * Drains the OutQueue on the game thread, finalizing and triggering delegates for completed tasks. Hides and replaces
+	 * the base implementation, which must never run as it would drain the OutQueue without the bookkeeping done here.
+	 * Always call it through this class, never through a FOnlineAsyncTaskManager pointer.
+	 *
+	 * Completed tasks are drained highest priority first within GameThreadDrainBudgetMs, tasks that do not fit in the
+	 * budget are carried over to the next frame. At least one task is drained every frame.
+	 */
+	void GameTick();
+
+	/** Number of completed tasks that did not fit in the drain budget of the last frame */
+	int32 GetLastFrameCarriedOverNum() const { return LastFrameCarriedOverNum; }
+
+	/** Number of completed tasks waiting to be drained on the game thread, excluding the ones still in the OutQueue */
+	int32 GetPendingCompletionNum() const;
+
 	void CheckMaxParallelTasks();
 
+	/**
+	 * Start a parallel task if there is capacity left for its priority, otherwise hold it in the overflow queue until
+	 * running tasks are drained. When the overflow queue is full and shedding is enabled, the lowest priority task is
+	 * rejected, which completes it unsuccessfully without ever starting it.
+	 *
+	 * @param NewTask Task to admit, ownership is taken by the manager
+	 * @param Priority Admission priority of the task
+	 */
+	void AdmitParallelTask(FOnlineAsyncTaskAccelByte* NewTask, EAccelByteAsyncTaskPriority Priority);
+
+	/** Get the number of parallel tasks waiting in the overflow queue */
+	int32 GetOverflowTaskCount() const;
+
+	/** Get admission counters for a single priority */
+	FAccelByteAsyncTaskAdmissionStats GetAdmissionStats(EAccelByteAsyncTaskPriority Priority) const;
+
+	/** Whether serial tasks dispatched with a lane run in their own lane, configured through bEnableSerialTaskLanes */
+	bool IsSerialLanesEnabled() const { return bEnableSerialLanes; }
+
+	/**
+	 * Queue a serial task at the end of a lane. Lanes are keyed by local user and domain, each lane runs one task at a
+	 * time in order, and every lane is processed concurrently on the online thread.
+	 *
+	 * @param LocalUserNum Local user that owns the lane, INVALID_CONTROLLERID for tasks not bound to a local user
+	 * @param Lane Domain of the task
+	 * @param NewTask Task to queue, ownership is taken by the manager
+	 */
+	void AddToSerialLane(int32 LocalUserNum, EAccelByteAsyncTaskLane Lane, FOnlineAsyncTask* NewTask);
+
+	/** Get the number of tasks that are either running or waiting in a serial lane */
+	int32 GetSerialLaneTaskCount() const;
+
+	/**
+	 * Get the wheel that expires task timeouts, invalid if the wheel is disabled through bEnableTimeoutWheel, in which
+	 * case tasks check their own deadline on every tick.
+	 */
+	TSharedPtr<FAccelByteTimeoutWheel, ESPMode::ThreadSafe> GetTimeoutWheel() const;
+
+	/**
+	 * Get the token handed to tasks dispatched for a local user. The token is replaced every time the tasks of the user
+	 * are cancelled, so tasks dispatched afterwards are unaffected.
+	 *
+	 * @return nullptr for INVALID_CONTROLLERID, tasks that are not bound to a local user cannot be cancelled per user
+	 */
+	FAccelByteCancellationTokenPtr GetUserCancellationToken(int32 LocalUserNum);
+
+	/**
+	 * Cancel every task dispatched for a local user, along with their children. Tasks still waiting in the overflow queue
+	 * or in a serial lane are retired straight away, running tasks complete as cancelled on their next tick. Cancelled
+	 * tasks are still finalized, but their delegates are never triggered.
+	 *
+	 * @return Number of waiting tasks that were retired without ever being started
+	 */
+	int32 CancelTasksForUser(int32 LocalUserNum);
+
+	/** Whether the identity interface cancels the tasks of a user on logout, configured through bCancelTasksOnLogout */
+	bool ShouldCancelTasksOnLogout() const { return bCancelTasksOnLogout; }
+
+	/** Number of tasks drained as cancelled since the manager was created */
+	uint64 GetCancelledTaskCount() const { return CancelledTaskCount; }
+
+	/** Whether tasks retry failed requests according to their retry policy, configured through bEnableRequestRetry */
+	bool IsRequestRetryEnabled() const { return bEnableRequestRetry; }
+
+	/**
+	 * Get the circuit breakers of every backend service, keyed by the service name of task retry policies. Shared so
+	 * that tasks can record their outcome without holding on to the manager.
+	 */
+	TSharedRef<FAccelByteCircuitBreakers, ESPMode::ThreadSafe> GetCircuitBreakers() const { return CircuitBreakers; }
+
+	/**
+	 * Register a freshly dispatched AccelByte task so that it can be recognized once it reaches the OutQueue, to measure
+	 * its lifetime and complete its coalesced request. Called by the subsystem when dispatching tasks and Epics.
+	 */
+	void TrackTask(FOnlineAsyncTaskAccelByte* Task);
+
+	/**
+	 * Get the latency metrics collected for AccelByte tasks. Samples are grouped per task name and split into the time
+	 * spent queued, executing, waiting for the game thread, and running delegates.
+	 */
+	const FAccelByteAsyncTaskMetrics& GetTaskMetrics() const { return TaskMetrics; }
+
+	/** Reset every latency sample collected so far */
+	void ResetTaskMetrics();
+
+	/**
+	 * Handle console commands for the async task manager, reached through 'ASYNCTASK' on the subsystem exec.
+	 * Supported commands:
+	 * - METRICS [Filter]: dump latency histograms, optionally only for task names containing Filter
+	 * - METRICS RESET: clear all latency histograms
+	 * - LANES: list serial lanes that currently have work
+	 * - ADMISSION: dump parallel task admission counters and the overflow queue size
+	 * - TIMEOUTS: dump timeout wheel counters
+	 * - CANCEL <LocalUserNum>: cancel every task of a local user
+	 * - POOL: dump task pool counters, including heap allocations avoided during the last frame
+	 * - POOL TRIM: give every pooled block that is not in use back to the heap
+	 * - DRAIN: dump game thread drain budget counters, including tasks carried over to the next frame
+	 * - RECORDER: dump the state of the SDK response recorder
+	 * - RECORD START: start recording SDK responses of tasks that go through FAccelByteResponseRecorder
+	 * - RECORD STOP <File>: stop recording and save responses, relative paths go under Saved/AccelByte/Recordings
+	 * - REPLAY <File> [SPEED=<Multiplier>]: play back recorded responses instead of sending requests
+	 * - REPLAY STOP: stop playing back recorded responses
+	 * - BREAKERS: dump the state, retries and failures of every service circuit breaker
+	 * - BREAKERS RESET: close every circuit breaker and clear its counters
+	 */
+	bool Exec(UWorld* InWorld, const TCHAR* Cmd, FOutputDevice& Ar);
+
 private:
 
 	/** Pointer to subsystem instance that constructed this manager
@@ -31,4 +181,155 @@ private:
 
 	/** How long Task elapsed can considered as too long*/
 	const double TaskTimeThreshold = 30.0;
+
+	/** A single serial lane, only touched under SerialLanesLock apart from ticking the active task */
+	struct FSerialLane
+	{
+		/** Tasks waiting for the active task to finish, in dispatch order */
+		TArray<FOnlineAsyncTask*> PendingTasks;
+
+		/** Task currently running in this lane, owned by the online thread */
+		FOnlineAsyncTask* ActiveTask = nullptr;
+	};
+
+	/** Whether serial lanes are enabled, tasks fall back to the engine InQueue otherwise */
+	bool bEnableSerialLanes = true;
+
+	/** Serial lanes keyed by a packed local user num and lane, see MakeSerialLaneKey */
+	TMap<uint32, FSerialLane> SerialLanes;
+
+	/** Lock for SerialLanes, tasks can be dispatched from any thread */
+	mutable FCriticalSection SerialLanesLock;
+
+	static uint32 MakeSerialLaneKey(int32 LocalUserNum, EAccelByteAsyncTaskLane Lane);
+
+	/** Start, tick and retire the active task of every serial lane, called from the online thread */
+	void TickSerialLanes();
+
+	/**
+	 * Maximum number of admitted parallel tasks running at once, configured through MaxInFlightParallelTasks. Zero or
+	 * less disables admission control, in which case every parallel task is started straight away.
+	 */
+	int32 MaxInFlightParallelTasks = 64;
+
+	/**
+	 * Percentage of MaxInFlightParallelTasks that background tasks are allowed to use, configured through
+	 * BackgroundTaskAdmissionPercent. The rest is kept as headroom for normal and interactive tasks.
+	 */
+	int32 BackgroundTaskAdmissionPercent = 75;
+
+	/** Maximum number of tasks waiting in the overflow queue, configured through MaxOverflowTasks */
+	int32 MaxOverflowTasks = 256;
+
+	/** Whether tasks should be rejected once the overflow queue is full, configured through bShedOverflowTasks */
+	bool bShedOverflowTasks = true;
+
+	/** Number of admitted parallel tasks that have not been drained from the OutQueue yet */
+	int32 InFlightParallelTaskNum = 0;
+
+	/** Admitted parallel tasks, used to release their slot once they are drained from the OutQueue */
+	TSet<FOnlineAsyncItem*> AdmittedParallelTasks;
+
+	/** Parallel tasks waiting for a slot, one FIFO queue per priority */
+	TArray<FOnlineAsyncTaskAccelByte*> OverflowTasks[static_cast<uint8>(EAccelByteAsyncTaskPriority::Num)];
+
+	/** Admission counters, one per priority */
+	FAccelByteAsyncTaskAdmissionStats AdmissionStats[static_cast<uint8>(EAccelByteAsyncTaskPriority::Num)];
+
+	/** Lock for every admission member above, tasks can be dispatched from any thread */
+	mutable FCriticalSection AdmissionLock;
+
+	/** Whether a task of the given priority can be started right now, must be called with AdmissionLock held */
+	bool HasAdmissionCapacity(EAccelByteAsyncTaskPriority Priority) const;
+
+	/** Release the slot of an admitted parallel task that has been drained from the OutQueue */
+	void ReleaseAdmission(FOnlineAsyncItem* Item);
+
+	/** Start as many waiting tasks from the overflow queue as capacity allows, highest priority first */
+	void PumpOverflowTasks();
+
+	/** Reject a task that will never be started, and hand it over to the OutQueue so its delegates are triggered */
+	void ShedTask(FOnlineAsyncTaskAccelByte* Task);
+
+	/** Whether task timeouts are expired by TimeoutWheel, configured through bEnableTimeoutWheel */
+	bool bEnableTimeoutWheel = true;
+
+	/** Timing wheel advanced on every online tick, shared so that tasks can cancel themselves after the manager is gone */
+	TSharedRef<FAccelByteTimeoutWheel, ESPMode::ThreadSafe> TimeoutWheel;
+
+	/** Whether tasks of a user are cancelled on logout */
+	bool bCancelTasksOnLogout = true;
+
+	/** Current cancellation token of every local user that has dispatched tasks */
+	TMap<int32, FAccelByteCancellationTokenRef> UserCancellationTokens;
+
+	/** Lock for UserCancellationTokens, tasks can be dispatched from any thread */
+	FCriticalSection UserCancellationTokensLock;
+
+	/** Set when a token is cancelled, so the next online tick retires cancelled tasks from the engine queues */
+	std::atomic<bool> bHasPendingCancellation{false};
+
+	/** Number of tasks drained as cancelled, only touched on the game thread */
+	uint64 CancelledTaskCount = 0;
+
+	/** Retire cancelled tasks from ParallelTasks and InQueue, called from the online thread */
+	void RetireCancelledTasks();
+
+	/** Complete a task as cancelled and hand it over to the OutQueue, the task must not be in any queue anymore */
+	void RetireCancelledTask(FOnlineAsyncTaskAccelByte* Task);
+
+	/**
+	 * Time in milliseconds the game thread may spend per frame finalizing completed tasks and triggering their delegates,
+	 * configured through GameThreadDrainBudgetMs. Zero or less drains every completed task in the frame it completed.
+	 */
+	double GameThreadDrainBudgetMs = 4.0;
+
+	/** Completed tasks moved out of the OutQueue but not drained yet, one FIFO queue per priority, game thread only */
+	TArray<FOnlineAsyncItem*> PendingCompletions[static_cast<uint8>(EAccelByteAsyncTaskPriority::Num)];
+
+	/** Drain counters, only touched on the game thread */
+	int32 LastFrameDrainedNum = 0;
+	int32 LastFrameCarriedOverNum = 0;
+	int32 PeakCarriedOverNum = 0;
+	uint64 CarriedOverFrameCount = 0;
+	double LastFrameDrainTimeMs = 0.0;
+
+	/** Move every item from the OutQueue to the pending completion queue of its priority */
+	void CollectCompletedItems();
+
+	/** Finalize a completed item, trigger its delegates unless it was cancelled, and delete it */
+	void DrainCompletedItem(FOnlineAsyncItem* Item);
+
+	/** Whether tasks retry failed requests, configured through bEnableRequestRetry */
+	bool bEnableRequestRetry = true;
+
+	/** Circuit breakers of every backend service, see GetCircuitBreakers */
+	TSharedRef<FAccelByteCircuitBreakers, ESPMode::ThreadSafe> CircuitBreakers;
+
+	/** Feed the outcome of a task that talks to a backend service to the circuit breaker of that service */
+	void RecordServiceOutcome(FOnlineAsyncTaskAccelByte* Task);
+
+	/** Whether latency of dispatched tasks should be recorded, configured through bEnableAsyncTaskMetrics */
+	bool bEnableTaskMetrics = true;
+
+	/** Latency histograms for every AccelByte task class that went through this manager */
+	FAccelByteAsyncTaskMetrics TaskMetrics;
+
+	/**
+	 * Tasks dispatched through the subsystem, keyed by the item pointer that will be put in the OutQueue. OutQueue holds
+	 * plain FOnlineAsyncItem pointers, so this is how we know which items are AccelByte tasks.
+	 */
+	TMap<FOnlineAsyncItem*, FOnlineAsyncTaskAccelByte*> TrackedTasks;
+
+	/** Lock for TrackedTasks, tasks can be dispatched from any thread */
+	FCriticalSection TrackedTasksLock;
+
+	/** Get the AccelByte task of a tracked item, nullptr if the item is not tracked */
+	FOnlineAsyncTaskAccelByte* FindTrackedTask(FOnlineAsyncItem* Item);
+
+	/** Stop tracking an item, returning the AccelByte task if the item was tracked */
+	FOnlineAsyncTaskAccelByte* UntrackItem(FOnlineAsyncItem* Item);
+
+	/** Record lifetime samples for a task that is about to be finalized */
+	void RecordTaskSamples(FOnlineAsyncTaskAccelByte* Task, double DrainTimeInSeconds, double DelegateTimeInSeconds);
 };
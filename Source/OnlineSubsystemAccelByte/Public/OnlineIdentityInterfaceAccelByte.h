@@ -832,6 +832,12 @@ private:
 	 */
 	void RemoveUserFromMappings(const int32 LocalUserNum);
 
+	/**
+	 * Publish the current API client and user ID of a local user to the user slot cache of the subsystem.
+	 * Should be called whenever any of them changes.
+	 */
+	void RefreshUserSlot(const int32 LocalUserNum);
+
 	/**
 	 * Handler for when our internal call to the native platform for querying user privileges completes.
 	 */
@@ -13,6 +13,8 @@
 #include "Models/AccelByteUserModels.h"
 #include "AccelByteTimerObject.h"
 #include "OnlineAsyncTaskManagerAccelByte.h"
+#include "Utilities/AccelByteRequestCoalescer.h"
+#include "Utilities/AccelByteUserSlotCache.h"
 #include "OnlineSubsystemAccelBytePackage.h"
 #include "Core/AccelByteInstance.h"
 #include "Core/AccelByteServerApiClient.h"
@@ -219,6 +221,28 @@ public:
 	 */
 	FOnlineUserCacheAccelBytePtr GetUserCache() const;
 
+	/**
+	 * Retrieves the async task manager for this subsystem, used to query task latency metrics
+	 */
+	FOnlineAsyncTaskManagerAccelBytePtr GetAsyncTaskManager() const;
+
+	/**
+	 * Retrieves the registry of in-flight coalesced requests, used to query how many requests were saved by coalescing
+	 */
+	FAccelByteRequestCoalescer& GetRequestCoalescer();
+
+	/** Whether identical read requests should share a single in-flight task, configured through bEnableRequestCoalescing */
+	bool IsRequestCoalescingEnabled() const;
+
+	/**
+	 * Retrieves the API client, user ID and login status of every local user, published by the identity interface on
+	 * login and logout so that async tasks can resolve their user without going through the identity interface
+	 */
+	const FAccelByteUserSlotCache& GetUserSlotCache() const { return UserSlotCache; }
+
+	/** Same as the const overload, used by the identity interface to publish slots */
+	FAccelByteUserSlotCache& GetUserSlotCache() { return UserSlotCache; }
+
 	//~ Begin FTickerObjectBase
 	virtual bool Tick(float DeltaTime) override;
 	//~ End FTickerObjectBase
@@ -332,6 +356,38 @@ OVERRIDE_PACKAGE_SCOPE:
 		CreateAndDispatchAsyncTaskImplementation(TaskInfo, NewTask);
 	}
 
+	/**
+	 * Create and queue an async task, unless request coalescing is enabled and an identical request is already in flight.
+	 * In that case no task is created, and OnCoalesced is run on the game thread once the in-flight task has triggered its
+	 * delegates. Only use this for read requests whose results can be served from a cache to every caller.
+	 *
+	 * @param TaskInfo How the task should be dispatched if it is created
+	 * @param CoalescingKey Key of the request, see FAccelByteRequestCoalescer::MakeRequestKey
+	 * @param OnCoalesced Callback to report completion to this caller if the request attached to an in-flight task. Must
+	 * only run per-call completion, multicast delegates are already broadcast once by the in-flight task. May be unbound.
+	 */
+	template <typename TOnlineAsyncTask, typename... TArguments>
+	FORCEINLINE void CreateAndDispatchCoalescedAsyncTask(FOnlineAsyncTaskInfo TaskInfo, const FString& CoalescingKey, FAccelByteRequestCoalescer::FOnRequestComplete&& OnCoalesced, TArguments&&... Arguments)
+	{
+		static_assert(TIsDerivedFrom<TOnlineAsyncTask, FOnlineAsyncTaskAccelByte>::IsDerived, "Type passed to CreateAndDispatchCoalescedAsyncTask must derive from FOnlineAsyncTask");
+
+		check(AsyncTaskManager.IsValid());
+
+		const bool bShouldCoalesce = bIsRequestCoalescingEnabled && !CoalescingKey.IsEmpty();
+		if (bShouldCoalesce && RequestCoalescer.TryJoin(CoalescingKey, MoveTemp(OnCoalesced)))
+		{
+			return;
+		}
+
+		TOnlineAsyncTask* NewTask = new TOnlineAsyncTask(Forward<TArguments>(Arguments)...);
+		if (bShouldCoalesce)
+		{
+			NewTask->SetCoalescingKey(CoalescingKey);
+		}
+
+		CreateAndDispatchAsyncTaskImplementation(TaskInfo, NewTask);
+	}
+
 PACKAGE_SCOPE:
 	/** Create and queue an async task to the parallel tasks queue */
 	template <typename TOnlineAsyncTask, typename... TArguments>
@@ -342,6 +398,19 @@ PACKAGE_SCOPE:
 		CreateAndDispatchAsyncTask<TOnlineAsyncTask>(TaskInfo, Forward<TArguments>(Arguments)...);
 	}
 
+	/**
+	 * Create and queue an async task to the parallel tasks queue with an admission priority. Higher priority tasks are
+	 * admitted first when the async task manager is saturated.
+	 */
+	template <typename TOnlineAsyncTask, typename... TArguments>
+	FORCEINLINE void CreateAndDispatchAsyncTaskParallelWithPriority(EAccelByteAsyncTaskPriority Priority, TArguments&&... Arguments)
+	{
+		FOnlineAsyncTaskInfo TaskInfo;
+		TaskInfo.Type = ETypeOfOnlineAsyncTask::Parallel;
+		TaskInfo.Priority = Priority;
+		CreateAndDispatchAsyncTask<TOnlineAsyncTask>(TaskInfo, Forward<TArguments>(Arguments)...);
+	}
+
 	/** Create and queue an async task to the in queue */
 	template <typename TOnlineAsyncTask, typename... TArguments>
 	FORCEINLINE void CreateAndDispatchAsyncTaskSerial(TArguments&&... Arguments)
@@ -351,6 +420,19 @@ PACKAGE_SCOPE:
 		CreateAndDispatchAsyncTask<TOnlineAsyncTask>(TaskInfo, Forward<TArguments>(Arguments)...);
 	}
 
+	/**
+	 * Create and queue an async task to a serial lane. The task only waits for earlier tasks of the same local user in
+	 * the same lane, tasks in other lanes or for other local users run concurrently.
+	 */
+	template <typename TOnlineAsyncTask, typename... TArguments>
+	FORCEINLINE void CreateAndDispatchAsyncTaskSerialInLane(EAccelByteAsyncTaskLane Lane, TArguments&&... Arguments)
+	{
+		FOnlineAsyncTaskInfo TaskInfo;
+		TaskInfo.Type = ETypeOfOnlineAsyncTask::Serial;
+		TaskInfo.Lane = Lane;
+		CreateAndDispatchAsyncTask<TOnlineAsyncTask>(TaskInfo, Forward<TArguments>(Arguments)...);
+	}
+
 	/** Create and queue an async event to be processed in the OutQueue */
 	template <typename TOnlineAsyncEvent, typename... TArguments>
 	FORCEINLINE void CreateAndDispatchAsyncEvent(TArguments&&... Arguments)
@@ -393,6 +475,9 @@ PACKAGE_SCOPE:
 	/** Used by Epic to remove the task from Epic’s container for completion (OutQueue) by the subsystem’s AsyncTaskManager. */
 	void AddTaskToOutQueue(FOnlineAsyncTaskAccelByte* Task);
 
+	/** Get the local user num that owns a task's serial lane, resolving it from the task's user ID if needed */
+	int32 GetSerialLaneUserNum(FOnlineAsyncTaskAccelByte* Task);
+
 	/** Used by subsystem to Enqueue a sub-task/child task into the currently assigned Epic */
 	void EnqueueTaskToEpic(FOnlineAsyncEpicTaskAccelByte* EpicPtr, FOnlineAsyncTaskAccelByte* TaskPtr, ETypeOfOnlineAsyncTask TaskType);
 	void EnqueueTaskToEpic(FOnlineAsyncTaskAccelByte* TaskPtr, ETypeOfOnlineAsyncTask TaskType);
@@ -492,6 +577,7 @@ private:
 	bool bIsAutoChatConnectAfterLoginSuccess = false;
 	bool bIsMultipleLocalUsersEnabled = false;
 	bool bNativePlatformTokenRefreshManually = false;
+	bool bIsRequestCoalescingEnabled = false;
 
 	/***************************************************/
 
@@ -535,6 +621,12 @@ private:
 	/** Async task manager used by interfaces in our OSS to handle async */
 	FOnlineAsyncTaskManagerAccelBytePtr AsyncTaskManager;
 
+	/** Registry of in-flight read requests that later identical requests can attach to */
+	FAccelByteRequestCoalescer RequestCoalescer;
+
+	/** Lock free snapshot of every local user, see GetUserSlotCache */
+	FAccelByteUserSlotCache UserSlotCache;
+
 	/** Shared instance of our agreement interface implementation */
 	FOnlineAgreementAccelBytePtr AgreementInterface;
 	
@@ -11,6 +11,58 @@
  */
 #define LOG_BOOL_FORMAT(Condition) ((Condition) ? TEXT("true") : TEXT("false"))
 
+/**
+ * Whether trace macros emit Unreal Insights CPU scopes, named after the traced method, instead of formatted trace logs.
+ * Set to 1 through the module definitions to profile the OSS in Insights. Traces logged at Log verbosity or above, such
+ * as warnings about failed requests, are still logged.
+ */
+#ifndef AB_OSS_TRACE_INSIGHTS
+#define AB_OSS_TRACE_INSIGHTS 0
+#endif
+
+#if AB_OSS_TRACE_INSIGHTS
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#endif
+
+/**
+ * Least important verbosity that trace macros are compiled in for, works the same way as the compile time verbosity of a
+ * log category. Traces below it compile to nothing, arguments included. Defaults to Warning, the default verbosity of
+ * LogAccelByteOSS, so the Verbose begin and end traces on hot paths are stripped unless a build opts back in, for
+ * example with AB_OSS_TRACE_COMPILED_IN_VERBOSITY=VeryVerbose in PublicDefinitions.
+ */
+#ifndef AB_OSS_TRACE_COMPILED_IN_VERBOSITY
+#define AB_OSS_TRACE_COMPILED_IN_VERBOSITY Warning
+#endif
+
+/**
+ * Log a trace to LogAccelByteOSS, unless the verbosity is below AB_OSS_TRACE_COMPILED_IN_VERBOSITY. The check is a
+ * constant expression, so the whole statement is removed by the compiler for stripped verbosities. Expands to a block
+ * like UE_LOG does, so existing traces without a trailing semicolon keep compiling.
+ *
+ * @param Verbosity Log verbosity for this trace, corresponds to the verbosity for UE_LOG
+ * @param Format Same as a format string passed into UE_LOG, and as such must be wrapped with a TEXT macro.
+ * @param Args Corresponds to the types set in Format, just like in UE_LOG
+ */
+#define AB_OSS_TRACE_LOG(Verbosity, Format, ...) \
+	{ \
+		if ((ELogVerbosity::Verbosity & ELogVerbosity::VerbosityMask) <= ELogVerbosity::AB_OSS_TRACE_COMPILED_IN_VERBOSITY) \
+		{ \
+			UE_LOG_AB(Verbosity, Format, ##__VA_ARGS__); \
+		} \
+	}
+
+/**
+ * Open an Insights CPU scope lasting until the end of the enclosing block, compiles to nothing unless AB_OSS_TRACE_INSIGHTS
+ * is set. The name is only built while the CPU trace channel is enabled.
+ *
+ * @param NameExpression Expression giving the FString name of the scope
+ */
+#if AB_OSS_TRACE_INSIGHTS
+#define AB_OSS_TRACE_SCOPE(NameExpression) TRACE_CPUPROFILER_EVENT_SCOPE_TEXT(UE_TRACE_CHANNELEXPR_IS_ENABLED(CpuChannel) ? *(NameExpression) : TEXT(""))
+#else
+#define AB_OSS_TRACE_SCOPE(NameExpression)
+#endif
+
 /**
   * Simple macro for logging a trace for when an interface method begins. Should only be called on interfaces with the parent
   * subsystem as a member named 'AccelByteSubsystem'.
@@ -19,10 +71,13 @@
   * @param Format Same as a format string passed into UE_LOG, and as such must be wrapped with a TEXT macro.
   * @param Args Corresponds to the types set in Format, just like in UE_LOG
   */
-#define AB_OSS_INTERFACE_TRACE_BEGIN_VERBOSITY(Verbosity, Format, ...) UE_LOG_AB(Verbosity, TEXT(">>> %s (%s) was called. Args: ") Format, *FString(__func__), *AccelByteSubsystem->GetInstanceName().ToString(), ##__VA_ARGS__)
+#define AB_OSS_INTERFACE_TRACE_BEGIN_VERBOSITY(Verbosity, Format, ...) \
+	AB_OSS_TRACE_SCOPE(FString(__func__)) \
+	AB_OSS_TRACE_LOG(Verbosity, TEXT(">>> %s (%s) was called. Args: ") Format, ANSI_TO_TCHAR(__func__), *AccelByteSubsystem->GetInstanceName().ToString(), ##__VA_ARGS__)
 #define AB_OSS_PTR_INTERFACE_TRACE_BEGIN_VERBOSITY(Verbosity, Format, ...) \
-	UE_LOG_AB(Verbosity, TEXT(">>> %s (%s) was called. Args: ") Format \
-		, *FString(__func__) \
+	AB_OSS_TRACE_SCOPE(FString(__func__)) \
+	AB_OSS_TRACE_LOG(Verbosity, TEXT(">>> %s (%s) was called. Args: ") Format \
+		, ANSI_TO_TCHAR(__func__) \
 		, AccelByteSubsystem.Pin().IsValid() ? *AccelByteSubsystem.Pin()->GetInstanceName().ToString() : TEXT("INVALID") \
 		, ##__VA_ARGS__)
 
@@ -45,10 +100,10 @@
  * @param Format Same as a format string passed into UE_LOG, and as such must be wrapped with a TEXT macro.
  * @param Args Corresponds to the types set in Format, just like in UE_LOG
  */
-#define AB_OSS_INTERFACE_TRACE_END_VERBOSITY(Verbosity, Format, ...) UE_LOG_AB(Verbosity, TEXT("<<< %s (%s) has finished execution. ") Format, *FString(__func__), *AccelByteSubsystem->GetInstanceName().ToString(), ##__VA_ARGS__)
+#define AB_OSS_INTERFACE_TRACE_END_VERBOSITY(Verbosity, Format, ...) AB_OSS_TRACE_LOG(Verbosity, TEXT("<<< %s (%s) has finished execution. ") Format, ANSI_TO_TCHAR(__func__), *AccelByteSubsystem->GetInstanceName().ToString(), ##__VA_ARGS__)
 #define AB_OSS_PTR_INTERFACE_TRACE_END_VERBOSITY(Verbosity, Format, ...) \
-	UE_LOG_AB(Verbosity, TEXT("<<< %s (%s) has finished execution. ") Format \
-		, *FString(__func__) \
+	AB_OSS_TRACE_LOG(Verbosity, TEXT("<<< %s (%s) has finished execution. ") Format \
+		, ANSI_TO_TCHAR(__func__) \
 		, AccelByteSubsystem.Pin().IsValid() ? *AccelByteSubsystem.Pin()->GetInstanceName().ToString() : TEXT("INVALID") \
 		, ##__VA_ARGS__)
 
@@ -70,7 +125,9 @@
   * @param Format Same as a format string passed into UE_LOG, and as such must be wrapped with a TEXT macro.
   * @param Args Corresponds to the types set in Format, just like in UE_LOG
   */
-#define AB_OSS_GENERIC_TRACE_BEGIN_VERBOSITY(Verbosity, Format, ...) UE_LOG_AB(Verbosity, TEXT(">>> %s was called. Args: ") Format, *FString(__func__), ##__VA_ARGS__)
+#define AB_OSS_GENERIC_TRACE_BEGIN_VERBOSITY(Verbosity, Format, ...) \
+	AB_OSS_TRACE_SCOPE(FString(__func__)) \
+	AB_OSS_TRACE_LOG(Verbosity, TEXT(">>> %s was called. Args: ") Format, ANSI_TO_TCHAR(__func__), ##__VA_ARGS__)
 
 /**
  * Simple macro for logging a trace for when an method begins in a class that doesn't have a subsystem instance attached.
@@ -89,7 +146,7 @@
  * @param Format Same as a format string passed into UE_LOG, and as such must be wrapped with a TEXT macro.
  * @param Args Corresponds to the types set in Format, just like in UE_LOG
  */
-#define AB_OSS_GENERIC_TRACE_END_VERBOSITY(Verbosity, Format, ...) UE_LOG_AB(Verbosity, TEXT("<<< %s has finished execution. ") Format, *FString(__func__), ##__VA_ARGS__)
+#define AB_OSS_GENERIC_TRACE_END_VERBOSITY(Verbosity, Format, ...) AB_OSS_TRACE_LOG(Verbosity, TEXT("<<< %s has finished execution. ") Format, ANSI_TO_TCHAR(__func__), ##__VA_ARGS__)
 
 /**
  * Macro for logging a trace when a method has finished execution in a class without a subsystem instance attached.
@@ -16,6 +16,7 @@
 #include "OnlineAsyncTaskManager.h"
 #include "OnlineStats.h"
 #include "Core/AccelByteBaseCredentials.h"
+#include <atomic>
 #include "OnlineSubsystemAccelByteTypes.generated.h"
 
 class FOnlineSubsystemAccelByte;
@@ -388,7 +389,9 @@ using FUniqueNetIdAccelByteUserRef = TSharedRef<FUniqueNetIdAccelByteUser const>
  *     "platformId": "<ID of the platform that platformType corresponds to, can be blank>"
  * }
  *
- * ToString will return the encoded version of this string, while ToDebugString will return the decoded version.
+ * ToString will return the encoded version of this string, while ToDebugString will return the decoded version. IDs created
+ * from a composite structure only encode it the first time ToString or GetBytes is called, as most of them are only ever
+ * compared or hashed, which only looks at the AccelByte ID.
  *
  * To get any of these fields from the ID, you will want to cast to an FUniqueNetIdAccelByte and use the getters there.
  * However, most of the ID manipulation is handled for you by the OSS, so there shouldn't be a need to crack open these
@@ -477,6 +480,28 @@ public:
 	 */
 	virtual bool IsValid() const override;
 
+	/**
+	 * @brief Get the encoded form of this ID, encoding the composite structure on the first call.
+	 *
+	 * @return Base64 encoded JSON representation of the composite ID.
+	 */
+	virtual FString ToString() const override;
+
+	/**
+	 * @brief Get the bytes of the encoded form of this ID, encoding the composite structure on the first call.
+	 */
+	virtual const uint8* GetBytes() const override;
+
+	/**
+	 * @brief Get the size in bytes of the encoded form of this ID, encoding the composite structure on the first call.
+	 */
+	virtual int32 GetSize() const override;
+
+	/**
+	 * @brief Hash of the AccelByte ID, so that equal IDs hash the same whether or not they carry platform information.
+	 */
+	virtual uint32 GetTypeHash() const override;
+
 	/**
 	 * @brief Returns the JSON representation of AccelByte composite ID, useful for debugging.
 	 *
@@ -581,11 +606,28 @@ private:
 	 */
 	bool bCachedValidState = false;
 
+	/**
+	 * @brief Whether the underlying string holds the encoded composite yet, IDs are shared across threads so it is atomic
+	 */
+	mutable std::atomic<bool> bIsEncoded{true};
+
+	/**
+	 * @brief Internal constructor that leaves the encoded string empty until it is first needed.
+	 *
+	 * @param CompositeId UserId in CompositeId object
+	 */
+	explicit FUniqueNetIdAccelByteUser(FAccelByteUniqueIdComposite const& CompositeId);
+
 	/**
 	 * @brief Method that will decode a given string from Base64 into the correct ID format, as well as fill out necessary fields.
 	 */
 	void DecodeIDElements();
 
+	/**
+	 * @brief Encode the composite structure into the underlying string if that has not been done yet.
+	 */
+	void EnsureEncoded() const;
+
 protected:
 	/**
 	 * @brief Default constructor.
@@ -1136,6 +1178,48 @@ enum class ETypeOfOnlineAsyncTask :uint8
 	Parallel = 1
 };
 
+/**
+ * Domain of a serial async task. Serial tasks only keep their ordering against other tasks of the same local user in the
+ * same lane, while different lanes are processed concurrently by the async task manager.
+ *
+ * Lobby and chat connections are part of the identity lifecycle and stay on the InQueue along with every task that has
+ * to run after them, such as the client side session V2 and party flows.
+ */
+enum class EAccelByteAsyncTaskLane : uint8
+{
+	None = 0, // Task goes through the single engine InQueue, serialized against every other task without a lane
+	Session, // Dedicated server session V1 tasks, which never depend on the lobby connection
+	User
+};
+
+/**
+ * Admission priority of a parallel async task. When the async task manager is saturated, waiting tasks are admitted
+ * highest priority first, and the lowest priority tasks are the first to be shed when the overflow queue is full.
+ */
+enum class EAccelByteAsyncTaskPriority : uint8
+{
+	Background = 0, // Refreshes and reads that can be delayed or shed under load, such as presence, stats or session restores
+	Normal,
+	Interactive, // Player initiated actions that should run as soon as possible, such as joining a session or sending chat
+	Num
+};
+
+const static inline FString AsyncTaskPriorityToString(const EAccelByteAsyncTaskPriority& Priority)
+{
+	switch (Priority)
+	{
+	case EAccelByteAsyncTaskPriority::Background:
+		return TEXT("Background");
+	case EAccelByteAsyncTaskPriority::Normal:
+		return TEXT("Normal");
+	case EAccelByteAsyncTaskPriority::Interactive:
+		return TEXT("Interactive");
+	default:
+		break;
+	}
+	return TEXT("Unknown");
+}
+
 class FOnlineAsyncTaskAccelByte;
 
 /**
@@ -1152,6 +1236,12 @@ struct ONLINESUBSYSTEMACCELBYTE_API FOnlineAsyncTaskInfo
 
 	ETypeOfOnlineAsyncTask Type = ETypeOfOnlineAsyncTask::Serial;
 	bool bCreateEpicForThis = false;
+
+	/** Serial lane to run this task in, only used when Type is Serial */
+	EAccelByteAsyncTaskLane Lane = EAccelByteAsyncTaskLane::None;
+
+	/** Admission priority of this task when Type is Parallel, also orders its delegates when the game thread drain is budgeted */
+	EAccelByteAsyncTaskPriority Priority = EAccelByteAsyncTaskPriority::Normal;
 };
 
 // 4.27 feature (https://docs.unrealengine.com/4.27/en-US/WhatsNew/Builds/ReleaseNotes/4_27/)
@@ -6,7 +6,11 @@
 #include "OnlineSubsystemAccelByteTypes.h"
 #include "Dom/JsonObject.h"
 #include "OnlineSubsystemAccelBytePackage.h"
+#include "OnlineDelegateMacros.h"
 #include "InterfaceModels/OnlineUserInterfaceAccelByteModels.h"
+#include "Utilities/AccelByteUserCacheSnapshot.h"
+#include "Misc/OutputDevice.h"
+#include <atomic>
 
 class FOnlineSubsystemAccelByte;
 class IOnlineSubsystem;
@@ -255,8 +259,9 @@ private:
 	/**
 	 * Timestamp denoting the last time that this particular user has been grabbed from the cache. If this exceeds the
 	 * maximum value set in the user cache, and if the user is not marked as important, they will be purged from the cache.
+	 * Lookups update it without any lock, while Purge reads it under the cache lock.
 	 */
-	double LastAccessedTimeInSeconds{ 0.0 };
+	std::atomic<double> LastAccessedTimeInSeconds{ 0.0 };
 
 	/**
 	 * UTC date and time of this user's data last updated. Data will be considered 'stale' after exceed the stale time that configured on the User Cache Interface.
@@ -266,9 +271,37 @@ private:
 
 	/**
 	 * Whether this cached player's data should be considered stale regardless of whether the 'LastUpdatedTime' has been exceed the stale state.
-	 * Set through 'FOnlineUserCacheAccelByte::SetUserDataAsStale'.
+	 * Set through 'FOnlineUserCacheAccelByte::SetUserDataAsStale', which flags the shared cached instance.
 	 */
-	bool bIsForcedStale { false };
+	std::atomic<bool> bIsForcedStale { false };
+
+	/**
+	 * LRU list of the user cache that this entry is in, see FOnlineUserCacheAccelByte::Purge
+	 */
+	enum class ELruList : uint8
+	{
+		None,
+		Evictable,
+		Important
+	};
+
+	/**
+	 * Links and list of this entry in the user cache's LRU lists, only touched with the cache lock held
+	 */
+	FAccelByteUserInfo* LruPrev { nullptr };
+	FAccelByteUserInfo* LruNext { nullptr };
+	ELruList LruList { ELruList::None };
+
+	/**
+	 * Value of 'LastAccessedTimeInSeconds' when this entry was last moved to the head of its LRU list. Lookups only
+	 * update the access time, the entry is moved lazily once it reaches the tail.
+	 */
+	double LruPositionTimeInSeconds { 0.0 };
+
+	/**
+	 * Approximate memory held by this entry, counted towards the byte cap of the user cache
+	 */
+	int64 EstimatedBytes { 0 };
 
 	/**
 	 * Copy UserInfo value 
@@ -285,6 +318,11 @@ private:
 	 */
 	friend class FOnlineUserCacheAccelByte;
 
+	/**
+	 * Setting the snapshot as a friend class to save and restore the last updated time
+	 */
+	friend class FAccelByteUserCacheSnapshot;
+
 };
 
 typedef TSharedRef<FAccelByteUserInfo, ESPMode::ThreadSafe> FAccelByteUserInfoRef;
@@ -294,10 +332,82 @@ typedef TSharedPtr<FAccelByteUserInfo, ESPMode::ThreadSafe> FAccelByteUserInfoPt
  * Delegate for when querying a user through the user cache finishes.
  *
  * @param bIsSuccessful Whether or not the query overall was a success
- * @param UserIds IDs of the users that we were successfully able to query, and thus are in the cache
+ * @param UserIds IDs of the users that we were successfully able to query, and thus are in the cache. Empty if the query
+ * failed, even if some of its users were queried before the failure.
  */
 DECLARE_DELEGATE_TwoParams(FOnQueryUsersComplete, bool /*bIsSuccessful*/, TArray<FAccelByteUserInfoRef> /*UsersQueried*/);
 
+/**
+ * Delegate for when some of the users of a query are available, fired on the game thread before FOnQueryUsersComplete.
+ * The completion delegate still receives every user, including the ones already given here.
+ *
+ * @param UsersQueried Users that were found since the previous partial results, and thus are in the cache
+ */
+DECLARE_DELEGATE_OneParam(FOnQueryUsersPartialResults, const TArray<FAccelByteUserInfoRef>& /*UsersQueried*/);
+
+/**
+ * Delegate for when a background refresh of stale users finds that their data has changed.
+ *
+ * @param ChangedUsers Cached users whose data differs from the stale data that was returned before the refresh
+ */
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnCachedUsersChanged, const TArray<FAccelByteUserInfoRef>& /*ChangedUsers*/);
+typedef FOnCachedUsersChanged::FDelegate FOnCachedUsersChangedDelegate;
+
+/** Entry points of the user cache that its lookup counters are broken down by */
+enum class EAccelByteUserCacheEntryPoint : uint8
+{
+	QueryUsersByAccelByteIds,
+	QueryUsersByPlatformIds,
+	GetUser,
+	Num
+};
+
+/** Lookup counters of a single entry point of the user cache */
+struct ONLINESUBSYSTEMACCELBYTE_API FAccelByteUserCacheEntryPointStats
+{
+	/** Users found in the cache with fresh data */
+	uint64 HitCount = 0;
+
+	/** Users found in the cache with stale data, refreshed either before answering or in the background */
+	uint64 StaleHitCount = 0;
+
+	/** Users that were not in the cache */
+	uint64 MissCount = 0;
+};
+
+/** Counters and memory accounting of FOnlineUserCacheAccelByte */
+struct ONLINESUBSYSTEMACCELBYTE_API FAccelByteUserCacheStats
+{
+	FAccelByteUserCacheEntryPointStats EntryPoints[static_cast<int32>(EAccelByteUserCacheEntryPoint::Num)];
+
+	/** Users purged after not being accessed for UserCachePurgeTimeoutSeconds */
+	uint64 ExpiredCount = 0;
+
+	/** Users evicted to stay under UserCacheMaxEntries or UserCacheMaxKilobytes */
+	uint64 EvictedCount = 0;
+
+	/** Users restored from the snapshot of the previous session */
+	uint64 RestoredCount = 0;
+
+	/** Users in the cache, and how many of them are important and never purged */
+	int32 EntryNum = 0;
+	int32 ImportantNum = 0;
+
+	/** Approximate memory held by cached users, strings, custom attributes and linked platforms included */
+	int64 Bytes = 0;
+
+	/** AccelByte IDs being fetched for QueryUsersByAccelByteIds, background refreshes included */
+	int32 InFlightIdNum = 0;
+
+	/** Queries of QueryUsersByPlatformIds that have not completed yet */
+	int32 InFlightPlatformQueryNum = 0;
+
+	const FAccelByteUserCacheEntryPointStats& Get(EAccelByteUserCacheEntryPoint EntryPoint) const
+	{
+		return EntryPoints[static_cast<int32>(EntryPoint)];
+	}
+};
+
 /**
  * Manages users that are queried from the AccelByte backend, making bulk calls to retrieve user data, as well as getting
  * extra necessary information for those users, such as platform IDs relevant to the current native platform.
@@ -311,8 +421,28 @@ DECLARE_DELEGATE_TwoParams(FOnQueryUsersComplete, bool /*bIsSuccessful*/, TArray
  * User data will be kept cached based on how long it has been since they have been accessed. You can configure how long
  * users will stay in cache with the `UserCachePurgeTimeoutSeconds` variable in the `OnlineSubsystemAccelByte` settings
  * in `DefaultEngine.ini`. Users will also not be purged if they were marked as important when queried.
+ *
+ * The cache can also be bounded with `UserCacheMaxEntries` and `UserCacheMaxKilobytes`, in which case the least recently
+ * used users that are not important are evicted first. Eviction is incremental, at most `UserCacheMaxEvictionsPerTick`
+ * users are looked at per tick, so purging never stalls a frame however large the cache grows.
+ *
+ * With `bEnableUserCacheSnapshot`, the most recently used users are saved to disk on shutdown and restored in the next
+ * session, the first time each of them is looked up. Restored users keep the time they were last updated, so the usual
+ * staleness rules decide whether they are queried again.
+ *
+ * With `bEnableStaleWhileRevalidate`, QueryUsersByAccelByteIds returns stale users right away instead of waiting for
+ * them to be queried again, and refreshes them in the background. OnCachedUsersChanged fires for the users whose data
+ * turned out to have changed.
+ *
+ * Queries over the bulk query limit are split in chunks, up to `UserQueryMaxConcurrentRequests` of which are in flight
+ * at once. Callers may pass a partial results delegate to get the users of each chunk as soon as it completes.
+ *
+ * Hits, stale hits and misses are counted per entry point, along with expirations, evictions and restores. They show up
+ * in the AccelByteOSS stat group and are dumped with the `ONLINE USERCACHE` console command, `ONLINE USERCACHE RESET`
+ * clears them.
  */
 class ONLINESUBSYSTEMACCELBYTE_API FOnlineUserCacheAccelByte
+	: public TSharedFromThis<FOnlineUserCacheAccelByte, ESPMode::ThreadSafe>
 {
 public:
 	/**
@@ -338,14 +468,19 @@ public:
 	 * If platform IDs are found and match the current platform that we are on, extra queries will be made through the platform OSSes.
 	 *
 	 * Caches any results that we get from the backend, as well as will not query from the backend again if a duplicate is found.
+	 * IDs that are already being queried by another call are not queried again, the delegate fires once they resolve.
+	 * With bEnableUserQueryBatching, the IDs left to query are merged with the ones of other calls made within
+	 * UserQueryBatchWindowMs into bulk queries. With bEnableStaleWhileRevalidate, stale users are returned as they are
+	 * and refreshed in the background, see OnCachedUsersChanged.
 	 *
 	 * @param LocalUserNum Index of the user that is attempting to query for other users
 	 * @param AccelByteIds Array of strings that represent an ID for a single user
 	 * @param Delegate Delegate fired when the query is complete
 	 * @param bIsImportant Whether or not we want to mark these users as important so that they stay in the cache, defaults to false.
 	 * This should only be used for users that we want to persist for the length of the game session, such as friends.
+	 * @param PartialDelegate Delegate fired with the users of each chunk of the query as soon as they are available
 	 */
-	bool QueryUsersByAccelByteIds(int32 LocalUserNum, const TArray<FString>& AccelByteIds, const FOnQueryUsersComplete& Delegate, bool bIsImportant = false);
+	bool QueryUsersByAccelByteIds(int32 LocalUserNum, const TArray<FString>& AccelByteIds, const FOnQueryUsersComplete& Delegate, bool bIsImportant = false, const FOnQueryUsersPartialResults& PartialDelegate = FOnQueryUsersPartialResults());
 
 	/**
 	 * Tries to query all platform IDs listed for the particular platform specified on the AccelByte backend to find
@@ -358,22 +493,28 @@ public:
 	 * @param Delegate Delegate fired when the query is complete
 	 * @param bIsImportant Whether or not we want to mark these users as important so that they stay in the cache, defaults to false.
 	 * This should only be used for users that we want to persist for the length of the game session, such as friends.
+	 * @param PartialDelegate Delegate fired with the users of each chunk of the query as soon as they are available
 	 */
-	bool QueryUsersByPlatformIds(int32 LocalUserNum, const FString& PlatformType, const TArray<FString>& PlatformIds, const FOnQueryUsersComplete& Delegate, bool bIsImportant = false);
+	bool QueryUsersByPlatformIds(int32 LocalUserNum, const FString& PlatformType, const TArray<FString>& PlatformIds, const FOnQueryUsersComplete& Delegate, bool bIsImportant = false, const FOnQueryUsersPartialResults& PartialDelegate = FOnQueryUsersPartialResults());
 
 	/**
 	 * Queries all of the IDs listed in the array on the AccelByte backend for user information, including platform IDs.
 	 * If platform IDs are found and match the current platform that we are on, extra queries will be made through the platform OSSes.
 	 *
 	 * Caches any results that we get from the backend, as well as will not query from the backend again if a duplicate is found.
+	 * IDs that are already being queried by another call are not queried again, the delegate fires once they resolve.
+	 * With bEnableUserQueryBatching, the IDs left to query are merged with the ones of other calls made within
+	 * UserQueryBatchWindowMs into bulk queries. With bEnableStaleWhileRevalidate, stale users are returned as they are
+	 * and refreshed in the background, see OnCachedUsersChanged.
 	 *
 	 * @param UserId FUniqueNetId of the user that is attempting to query for users
 	 * @param AccelByteIds Array of strings that represent an ID for a single user
 	 * @param Delegate Delegate fired when the query is complete
 	 * @param bIsImportant Whether or not we want to mark these users as important so that they stay in the cache, defaults to false.
 	 * This should only be used for users that we want to persist for the length of the game session, such as friends.
+	 * @param PartialDelegate Delegate fired with the users of each chunk of the query as soon as they are available
 	 */
-	bool QueryUsersByAccelByteIds(const FUniqueNetId& UserId, const TArray<FString>& AccelByteIds, const FOnQueryUsersComplete& Delegate, bool bIsImportant = false);
+	bool QueryUsersByAccelByteIds(const FUniqueNetId& UserId, const TArray<FString>& AccelByteIds, const FOnQueryUsersComplete& Delegate, bool bIsImportant = false, const FOnQueryUsersPartialResults& PartialDelegate = FOnQueryUsersPartialResults());
 
 	/**
 	 * Tries to query all platform IDs listed for the particular platform specified on the AccelByte backend to find
@@ -386,8 +527,9 @@ public:
 	 * @param Delegate Delegate fired when the query is complete
 	 * @param bIsImportant Whether or not we want to mark these users as important so that they stay in the cache, defaults to false.
 	 * This should only be used for users that we want to persist for the length of the game session, such as friends.
+	 * @param PartialDelegate Delegate fired with the users of each chunk of the query as soon as they are available
 	 */
-	bool QueryUsersByPlatformIds(const FUniqueNetId& UserId, const FString& PlatformType, const TArray<FString>& PlatformIds, const FOnQueryUsersComplete& Delegate, bool bIsImportant = false);
+	bool QueryUsersByPlatformIds(const FUniqueNetId& UserId, const FString& PlatformType, const TArray<FString>& PlatformIds, const FOnQueryUsersComplete& Delegate, bool bIsImportant = false, const FOnQueryUsersPartialResults& PartialDelegate = FOnQueryUsersPartialResults());
 
 	/**
 	 * Attempt to get a user from the cache by an AccelByte unique ID. This ID comes from either an FAccelByteUserInfo::Id
@@ -458,6 +600,24 @@ public:
 	*/
 	bool IsUserDataStale(const FString& InAccelByteId);
 
+	/**
+	 * Fired on the game thread once a background refresh of stale users, see bEnableStaleWhileRevalidate, got data that
+	 * differs from what was cached. Users whose data did not change are not reported.
+	 */
+	DEFINE_ONLINE_DELEGATE_ONE_PARAM(OnCachedUsersChanged, const TArray<FAccelByteUserInfoRef>& /*ChangedUsers*/);
+
+	/**
+	 * Get the lookup counters by entry point along with the size of the cache, used to tune the staleness and purge
+	 * settings of a title. Also published to the 'AccelByte OSS' stats group every tick.
+	 */
+	FAccelByteUserCacheStats GetStats() const;
+
+	/** Clear the lookup, purge and restore counters, cached users are kept */
+	void ResetStats();
+
+	/** Print the counters of the cache, see the 'ONLINE USERCACHE' console command */
+	void Dump(FOutputDevice& Ar) const;
+
 PACKAGE_SCOPE:
 
 	/**
@@ -473,7 +633,18 @@ PACKAGE_SCOPE:
 	void Init();
 
 	/**
-	 * Add an array of freshly queried users to the user cache
+	 * Save the snapshot of the cache if enabled. Called from the subsystem shutdown method.
+	 */
+	void Shutdown();
+
+	/**
+	 * Dispatch the query batches whose window has elapsed. Called from the owning subsystem's tick.
+	 */
+	void Tick(float DeltaTime);
+
+	/**
+	 * Add an array of freshly queried users to the user cache. The given instances replace the ones already cached for
+	 * the same users and must not be modified afterwards, build new ones to update a user.
 	 */
 	void AddUsersToCache(const TArray<FAccelByteUserInfoRef>& UsersQueried);
 
@@ -500,9 +671,9 @@ PACKAGE_SCOPE:
 	void AddLinkedPlatformInfoToCache(const FAccelByteUniqueIdComposite& UserId, const TArray<FAccelByteLinkedUserInfo>& LinkedPlatformInfo);
 
 	/**
-	 * Searches through the user caches for a user that hasn't been accessed in longer than the maximum time set for this
-	 * cache. If a user is found that exceeds this max time, and they are not marked as important, they will be removed
-	 * from the cache entirely.
+	 * Evicts users from the tail of the LRU list of users that are not important, as long as they haven't been accessed
+	 * in longer than the maximum time set for this cache, or the cache is over its entry or byte cap. Looks at no more
+	 * than UserCacheMaxEvictionsPerTick users per call.
 	 *
 	 * Will return the number of users purged from the cache.
 	 *
@@ -521,12 +692,18 @@ PACKAGE_SCOPE:
 	 */
 	void GetQueryAndCacheArrays(const TArray<FString>& AccelByteIds, TArray<FString>& UsersToQuery, TArray<FAccelByteUserInfoRef>& UsersInCache);
 
+	/**
+	 * Highest number of chunk requests that a single user query keeps in flight at once
+	 */
+	int32 GetUserQueryMaxConcurrentRequests() const;
+
 private:
 
 	/**
-	 * Mutex used to lock maps while we add to or retrieve from cache
+	 * Mutex serializing everything that modifies the cache, along with the pending queries, query batches and LRU lists.
+	 * Lookups never take it, they only take the read lock of the shard they look into.
 	 */
-	FCriticalSection CacheLock;
+	mutable FCriticalSection CacheLock;
 
 	/**
 	 * Length of time in seconds that a user will stay in the cache without being accessed before being purged.
@@ -534,16 +711,88 @@ private:
 	 */
 	double UserCachePurgeTimeoutSeconds = 600.0;
 
+	/**
+	 * Maximum number of cached users before the least recently used ones are evicted, zero for no cap. Important users
+	 * are never evicted, so the cache may still grow past it with them.
+	 */
+	int32 UserCacheMaxEntries = 0;
+
+	/**
+	 * Maximum approximate memory held by cached users before the least recently used ones are evicted, zero for no cap.
+	 * Configured in kilobytes through UserCacheMaxKilobytes.
+	 */
+	int64 UserCacheMaxBytes = 0;
+
+	/**
+	 * Maximum number of users that a single purge looks at, which bounds the time it holds the cache lock.
+	 */
+	int32 UserCacheMaxEvictionsPerTick = 64;
+
+	/**
+	 * Intrusive doubly linked list of cached users, from the most recently used at the head to the least at the tail
+	 */
+	struct FUserLruList
+	{
+		FAccelByteUserInfo* Head = nullptr;
+		FAccelByteUserInfo* Tail = nullptr;
+		int32 Num = 0;
+	};
+
+	/**
+	 * Users that may be evicted, and users marked as important that are only kept in a list of their own so that purges
+	 * never have to skip over them
+	 */
+	FUserLruList EvictableUsers;
+	FUserLruList ImportantUsers;
+
+	/**
+	 * Approximate memory held by every cached user
+	 */
+	int64 CachedUserBytes = 0;
+
+	/**
+	 * Map of cache keys to shared user instances, split by key hash into shards that each have their own reader-writer
+	 * lock. Lookups of users in different shards never contend, and lookups within a shard only wait on writers, which
+	 * hold its lock just long enough to add or remove a single key.
+	 */
+	class FShardedUserMap
+	{
+	public:
+		FAccelByteUserInfoPtr Find(const FString& Key) const;
+		bool Contains(const FString& Key) const;
+		void Add(const FString& Key, const FAccelByteUserInfoRef& User);
+
+		/** Remove a key only if it still maps to this instance, returning the instance so it is not freed with the shard locked */
+		FAccelByteUserInfoPtr RemoveIfSame(const FString& Key, const FAccelByteUserInfo& User);
+
+		int32 Num() const;
+
+	private:
+		static constexpr int32 ShardNum = 16;
+
+		struct FShard
+		{
+			mutable FRWLock Lock;
+			TMap<FString, FAccelByteUserInfoRef> Users;
+		};
+
+		FShard Shards[ShardNum];
+
+		/** Same hash as the map's own, so keys that only differ by case still land in the same shard */
+		const FShard& GetShard(const FString& Key) const { return Shards[GetTypeHash(Key) % ShardNum]; }
+		FShard& GetShard(const FString& Key) { return Shards[GetTypeHash(Key) % ShardNum]; }
+	};
+
 	/**
 	 * User cache that maps AccelByte IDs to shared user instances
 	 */
-	TMap<FString, FAccelByteUserInfoRef> AccelByteIdToUserInfoMap;
+	FShardedUserMap AccelByteIdToUserInfoMap;
 
 	/**
 	 * User cache that maps platform type and ID to shared user instances. The key is just
 	 * a string that combines both type and ID, in the following format: "TYPE;ID".
 	 */
-	TMap<FString, FAccelByteUserInfoRef> PlatformIdToUserInfoMap;
+	FShardedUserMap PlatformIdToUserInfoMap;
 
 	/**
 	 * AccelByte online subsystem instance that owns this user cache.
@@ -563,6 +812,118 @@ private:
 	 */
 	double TimeUntilStaleSeconds { 600.0 };
 
+	/**
+	 * Caller of QueryUsersByAccelByteIds waiting for its users, some of which may be fetched by queries of other callers
+	 */
+	struct FUserQueryWaiter
+	{
+		FOnQueryUsersComplete Delegate;
+		FOnQueryUsersPartialResults PartialDelegate;
+
+		/** Users resolved so far, either from the cache or from a finished query */
+		TArray<FAccelByteUserInfoRef> Users;
+
+		/** Number of IDs of this caller that are still being fetched */
+		int32 PendingNum = 0;
+
+		bool bWasSuccessful = true;
+		bool bIsImportant = false;
+	};
+	typedef TSharedRef<FUserQueryWaiter, ESPMode::ThreadSafe> FUserQueryWaiterRef;
+
+	/**
+	 * AccelByte IDs that an in-flight query is fetching, mapped to every caller waiting for them. Guarded by CacheLock.
+	 */
+	TMap<FString, TArray<FUserQueryWaiterRef>> PendingQueryWaiters;
+
+	/**
+	 * IDs claimed by calls to QueryUsersByAccelByteIds within a batching window, queried together once it elapses
+	 */
+	struct FUserQueryBatch
+	{
+		TArray<FString> AccelByteIds;
+		double DispatchTimeInSeconds = 0.0;
+	};
+
+	/**
+	 * Open query batches by local user index. Guarded by CacheLock.
+	 */
+	TMap<int32, FUserQueryBatch> QueryBatches;
+
+	/**
+	 * Whether calls to QueryUsersByAccelByteIds are merged into batches instead of each dispatching their own queries.
+	 * Disabled by default, configured through bEnableUserQueryBatching.
+	 */
+	bool bEnableUserQueryBatching { false };
+
+	/**
+	 * How long a batch stays open for other calls to join, configured through UserQueryBatchWindowMs. Zero dispatches the
+	 * batch on the next tick, so only the calls made within the same frame are merged. Batches reaching the bulk query
+	 * limit are dispatched right away.
+	 */
+	double UserQueryBatchWindowSeconds { 0.0 };
+
+	/**
+	 * Highest number of chunk requests a query keeps in flight at once, configured through UserQueryMaxConcurrentRequests.
+	 * One sends the chunks one after another.
+	 */
+	int32 UserQueryMaxConcurrentRequests { 4 };
+
+	/**
+	 * Whether QueryUsersByAccelByteIds returns stale users right away and refreshes them in the background, instead of
+	 * waiting for the refresh. Disabled by default, configured through bEnableStaleWhileRevalidate.
+	 */
+	bool bEnableStaleWhileRevalidate { false };
+
+	/**
+	 * Stale users being refreshed in the background, mapped to a hash of the data that was returned for them, so that
+	 * only the ones that actually changed are reported. Guarded by CacheLock.
+	 */
+	TMap<FString, uint32> RevalidatingUserHashes;
+
+	/** Lookup counters of an entry point, atomic as GetUser is called from any thread without the cache lock */
+	struct FAtomicEntryPointStats
+	{
+		std::atomic<uint64> HitCount{0};
+		std::atomic<uint64> StaleHitCount{0};
+		std::atomic<uint64> MissCount{0};
+	};
+
+	FAtomicEntryPointStats EntryPointStats[static_cast<int32>(EAccelByteUserCacheEntryPoint::Num)];
+	std::atomic<uint64> ExpiredCount{0};
+	std::atomic<uint64> EvictedCount{0};
+	std::atomic<uint64> RestoredCount{0};
+	std::atomic<int32> InFlightPlatformQueryNum{0};
+
+	/** Counters as of the previous tick, so that the stats group shows what happened during each frame */
+	FAccelByteUserCacheStats LastTickStats;
+
+	/**
+	 * Whether the cache is saved on shutdown and restored in the next session, configured through bEnableUserCacheSnapshot
+	 */
+	bool bEnableUserCacheSnapshot { false };
+
+	/**
+	 * Maximum number of users saved in the snapshot, configured through UserCacheSnapshotMaxEntries
+	 */
+	int32 UserCacheSnapshotMaxEntries { 1000 };
+
+	/**
+	 * Users last updated longer ago than this are neither saved nor restored, configured through
+	 * UserCacheSnapshotMaxAgeSeconds. Bounds how old restored data can get when staleness checks are disabled.
+	 */
+	double UserCacheSnapshotMaxAgeSeconds { 86400.0 };
+
+	/**
+	 * Path of the snapshot file, under Saved/AccelByte/UserCache and named after the subsystem instance
+	 */
+	FString SnapshotFilePath;
+
+	/**
+	 * Records of the snapshot loaded on init that have not been restored yet
+	 */
+	FAccelByteUserCacheSnapshot Snapshot;
+
 	/**
 	 * Default constructor deleted, as we only want to be able to have an instance owned by a subsystem
 	 */
@@ -573,4 +934,107 @@ private:
 	 */
 	FString ConvertPlatformTypeAndIdToCacheKey(const FString& Type, const FString& Id) const;
 
+	/**
+	 * Start tracking a user that was just added to one of the cache maps, or update the size and LRU position of one
+	 * that was already tracked after it has been updated or its importance has changed. Must only be called for users
+	 * held by the cache maps, with the cache lock held.
+	 */
+	void TouchUserEntry(FAccelByteUserInfo& User);
+
+	/**
+	 * Remove a user from the cache maps and stop tracking it. Must be called with the cache lock held.
+	 */
+	void EvictUserEntry(FAccelByteUserInfo& User);
+
+	/**
+	 * Map a user under its keys in place of the instances cached for them, and track it. Cached instances are read
+	 * without any lock, so updates always go through a new instance. Must be called with the cache lock held.
+	 */
+	void ReplaceUserEntry(const FAccelByteUserInfoRef& User);
+
+	/**
+	 * Stop tracking an instance that User has replaced, unless one of its own keys still maps to it
+	 */
+	void UntrackReplacedEntry(const FAccelByteUserInfoPtr& ReplacedUser, const FAccelByteUserInfo& User);
+
+	/**
+	 * Make a new instance holding the same data as a cached user, to be changed and then passed to ReplaceUserEntry
+	 */
+	FAccelByteUserInfoRef CloneUserEntry(const FAccelByteUserInfo& User) const;
+
+	/**
+	 * Find a user by AccelByte ID, restoring it from the snapshot on a miss. Safe to call with or without the cache lock.
+	 */
+	FAccelByteUserInfoPtr FindOrRestoreUser(const FString& AccelByteId);
+
+	/**
+	 * Find a user by composite ID, like GetUser but without counting a lookup or updating the access time
+	 */
+	FAccelByteUserInfoPtr FindUser(const FAccelByteUniqueIdComposite& UserId);
+
+	/**
+	 * Read the snapshot file and index its records. Records are only decoded once their user is looked up.
+	 */
+	void LoadSnapshot();
+
+	/**
+	 * Write the cached users to the snapshot file, important and most recently used ones first, followed by records of
+	 * the previous snapshot that were never restored.
+	 */
+	void SaveSnapshot();
+
+	/** Count a hit, stale hit or miss of an entry point */
+	void RecordLookup(EAccelByteUserCacheEntryPoint EntryPoint, bool bIsFound, bool bIsStale = false);
+
+	/** Count the lookups of a call to QueryUsersByPlatformIds, which the query task does on its own */
+	void RecordPlatformIdLookups(const FString& PlatformType, const TArray<FString>& PlatformIds);
+
+	/** Wrap the delegate of a QueryUsersByPlatformIds call, so that it is counted as in flight until it completes */
+	FOnQueryUsersComplete MakePlatformQueryDelegate(const FOnQueryUsersComplete& Delegate);
+
+	/** Publish the counters to the stats group, called every tick */
+	void UpdateStats();
+
+	void AddToLruHead(FAccelByteUserInfo& User);
+	void RemoveFromLru(FAccelByteUserInfo& User);
+
+	/**
+	 * Register a caller of QueryUsersByAccelByteIds as a waiter for each of its IDs that is not cached. IDs that an
+	 * in-flight query is already fetching are only waited for, the rest are claimed by this caller. If nothing has to
+	 * be waited for, the delegate fires on the next tick with the cached users.
+	 *
+	 * @param AccelByteIds Valid AccelByte IDs requested by the caller
+	 * @param OutIdsToFetch IDs claimed by this caller, to be queried with the delegate from MakePendingQueryDelegate
+	 */
+	void AddQueryWaiter(const TArray<FString>& AccelByteIds, const FOnQueryUsersComplete& Delegate, const FOnQueryUsersPartialResults& PartialDelegate, bool bIsImportant, TArray<FString>& OutIdsToFetch);
+
+	/**
+	 * Delegate for the query of IDs claimed in AddQueryWaiter, resolves every caller waiting for them.
+	 */
+	FOnQueryUsersComplete MakePendingQueryDelegate(const TArray<FString>& FetchedIds);
+
+	/**
+	 * Partial results delegate for the same query, resolves the callers waiting for the users of each chunk as soon as
+	 * it completes. Callers still waiting for other users get them through their own partial results delegate.
+	 */
+	FOnQueryUsersPartialResults MakePendingQueryPartialDelegate();
+
+	void OnPendingQueryComplete(bool bWasSuccessful, TArray<FAccelByteUserInfoRef> QueriedUsers, TArray<FString> FetchedIds);
+
+	void OnPendingQueryPartialResults(const TArray<FAccelByteUserInfoRef>& QueriedUsers);
+
+	/**
+	 * Add IDs claimed in AddQueryWaiter to the open batch of a local user, dispatching it if it reached the bulk query limit.
+	 *
+	 * @return false if batching is disabled, in which case the caller must query the IDs itself
+	 */
+	bool AddToQueryBatch(int32 LocalUserNum, const TArray<FString>& IdsToFetch);
+
+	/**
+	 * Query the IDs of a batch, which the query task splits in chunks of the bulk query limit, resolving their waiters as
+	 * each chunk completes. Users are only marked as important once their chunk completes, for the callers that asked
+	 * for it.
+	 */
+	void DispatchQueryBatch(int32 LocalUserNum, const TArray<FString>& AccelByteIds);
+
 };
\ No newline at end of file
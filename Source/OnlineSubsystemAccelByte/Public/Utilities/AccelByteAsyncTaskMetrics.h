@@ -0,0 +1,170 @@
+// Copyright (c) 2025 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Misc/OutputDevice.h"
+
+/**
+ * Phases of an async task lifetime that are measured by the async task manager
+ */
+enum class EAccelByteAsyncTaskPhase : uint8
+{
+	/** Time between the task being dispatched and its Initialize call (waiting in InQueue, ParallelTasks or an Epic) */
+	Queued = 0,
+	/** Time between Initialize and CompleteTask (backend round trips and task logic) */
+	Execution,
+	/** Time between CompleteTask and the game thread picking up the task from the OutQueue to trigger delegates */
+	Dispatch,
+	/** Time spent on the game thread running Finalize and TriggerDelegates */
+	Delegates,
+	Num
+};
+
+const static inline FString AsyncTaskPhaseToString(const EAccelByteAsyncTaskPhase& Phase)
+{
+	switch (Phase)
+	{
+	case EAccelByteAsyncTaskPhase::Queued:
+		return TEXT("Queued");
+	case EAccelByteAsyncTaskPhase::Execution:
+		return TEXT("Execution");
+	case EAccelByteAsyncTaskPhase::Dispatch:
+		return TEXT("Dispatch");
+	case EAccelByteAsyncTaskPhase::Delegates:
+		return TEXT("Delegates");
+	default:
+		break;
+	}
+	return TEXT("Unknown");
+}
+
+/**
+ * Fixed bucket latency histogram. Bucket boundaries are exponential so that both sub-millisecond game thread work and
+ * multi-second backend round trips fit in the same structure without any allocation.
+ */
+struct ONLINESUBSYSTEMACCELBYTE_API FAccelByteLatencyHistogram
+{
+	/** Number of buckets in the histogram, the last bucket catches every sample above the highest bound */
+	static constexpr int32 NumBuckets = 16;
+
+	/** Upper bound (inclusive) in milliseconds for each bucket */
+	static const double BucketUpperBoundsMs[NumBuckets];
+
+	/** Sample count for each bucket */
+	uint64 BucketCounts[NumBuckets] = {};
+
+	/** Total number of samples recorded */
+	uint64 SampleCount = 0;
+
+	/** Sum of all samples in milliseconds, used for the mean */
+	double TotalMs = 0.0;
+
+	/** Smallest sample recorded in milliseconds */
+	double MinMs = 0.0;
+
+	/** Largest sample recorded in milliseconds */
+	double MaxMs = 0.0;
+
+	/** Add a single sample to the histogram, negative samples are clamped to zero */
+	void AddSample(double SampleMs);
+
+	/** Get the average of all samples in milliseconds */
+	double GetMeanMs() const;
+
+	/**
+	 * Get an approximation of the percentile requested, based on the upper bound of the bucket the percentile lands in.
+	 *
+	 * @param Percentile Value between 0 and 100
+	 */
+	double GetPercentileMs(double Percentile) const;
+
+	/** Merge samples from another histogram into this one */
+	void Merge(const FAccelByteLatencyHistogram& Other);
+
+	/** Clear all samples */
+	void Reset();
+};
+
+/**
+ * Metrics collected for a single class of async task, keyed by the task name
+ */
+struct ONLINESUBSYSTEMACCELBYTE_API FAccelByteAsyncTaskClassMetrics
+{
+	/** One histogram per measured phase */
+	FAccelByteLatencyHistogram Phases[static_cast<uint8>(EAccelByteAsyncTaskPhase::Num)];
+
+	/** Number of tasks that finished successfully */
+	uint64 SucceededCount = 0;
+
+	/** Number of tasks that finished unsuccessfully, including timeouts */
+	uint64 FailedCount = 0;
+
+	const FAccelByteLatencyHistogram& GetPhase(EAccelByteAsyncTaskPhase Phase) const
+	{
+		return Phases[static_cast<uint8>(Phase)];
+	}
+};
+
+/**
+ * Thread safe registry of per task class latency histograms. Owned by the async task manager, samples are recorded on the
+ * game thread when completed tasks are drained from the OutQueue.
+ */
+class ONLINESUBSYSTEMACCELBYTE_API FAccelByteAsyncTaskMetrics
+{
+public:
+	/**
+	 * Record a latency sample for a task class.
+	 *
+	 * @param TaskName Name of the task class, as returned by the task's GetTaskName
+	 * @param Phase Lifetime phase that the sample belongs to
+	 * @param Seconds Duration of the phase in seconds
+	 */
+	void RecordSample(const FString& TaskName, EAccelByteAsyncTaskPhase Phase, double Seconds);
+
+	/**
+	 * Record the final outcome of a task class.
+	 */
+	void RecordOutcome(const FString& TaskName, bool bWasSuccessful);
+
+	/**
+	 * Record that a task was dispatched while the parallel task cap was already reached.
+	 */
+	void RecordParallelCapReached();
+
+	/**
+	 * Get the metrics recorded for a single task class.
+	 *
+	 * @return true if any sample was recorded for the task class
+	 */
+	bool GetTaskMetrics(const FString& TaskName, FAccelByteAsyncTaskClassMetrics& OutMetrics) const;
+
+	/**
+	 * Get a copy of all the metrics recorded so far, keyed by task name.
+	 */
+	TMap<FString, FAccelByteAsyncTaskClassMetrics> GetAllTaskMetrics() const;
+
+	/**
+	 * Get how many times a task has been dispatched while the parallel task cap was reached.
+	 */
+	uint64 GetParallelCapReachedCount() const;
+
+	/** Clear every recorded sample */
+	void Reset();
+
+	/**
+	 * Write a human readable report to the output device.
+	 *
+	 * @param Ar Output device to write to
+	 * @param Filter Only task names containing this string are written, empty to write every task class
+	 */
+	void Dump(FOutputDevice& Ar, const FString& Filter = TEXT("")) const;
+
+private:
+	mutable FCriticalSection MetricsLock;
+
+	TMap<FString, FAccelByteAsyncTaskClassMetrics> MetricsByTaskName;
+
+	uint64 ParallelCapReachedCount = 0;
+};
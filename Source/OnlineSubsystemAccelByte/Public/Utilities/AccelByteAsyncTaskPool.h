@@ -0,0 +1,118 @@
+// Copyright (c) 2025 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+#pragma once
+
+#include "CoreMinimal.h"
+#include <atomic>
+
+/**
+ * Counters for a single size class of the async task pool
+ */
+struct ONLINESUBSYSTEMACCELBYTE_API FAccelByteAsyncTaskPoolStats
+{
+	/** Size in bytes of every block in this size class */
+	SIZE_T BlockSize = 0;
+
+	/** Allocations served from a recycled block */
+	uint64 ReusedCount = 0;
+
+	/** Allocations that had to go to the heap because no block was free */
+	uint64 AllocatedCount = 0;
+
+	/** Blocks given back to the heap because the free list was full */
+	uint64 DiscardedCount = 0;
+
+	/** Blocks currently waiting to be reused */
+	int32 FreeNum = 0;
+
+	/** Blocks currently holding a live task */
+	int32 LiveNum = 0;
+};
+
+/**
+ * Recycles the memory of async task objects. Tasks are grouped in size classes, and blocks released by finished tasks
+ * are kept in a bounded free list per size class so that the next task of a similar size reuses them instead of going
+ * through the heap. Only memory is recycled, every task is still fully constructed and destroyed.
+ *
+ * FOnlineAsyncTaskAccelByte routes its class operator new/delete through this pool, so every task created with new,
+ * from the subsystem or elsewhere, goes through it.
+ */
+class ONLINESUBSYSTEMACCELBYTE_API FAccelByteAsyncTaskPool
+{
+public:
+	/** Granularity of size classes in bytes */
+	static constexpr SIZE_T SizeClassGranularity = 64;
+
+	/** Number of size classes, tasks larger than SizeClassGranularity * SizeClassNum bypass the pool */
+	static constexpr int32 SizeClassNum = 64;
+
+	/** Process wide pool shared by every subsystem instance */
+	static FAccelByteAsyncTaskPool& Get();
+
+	~FAccelByteAsyncTaskPool();
+
+	/** Get a block of at least Size bytes, from a free list if one is available */
+	void* Allocate(SIZE_T Size);
+
+	/** Give back a block returned by Allocate, Size must be the size that was requested */
+	void Release(void* Block, SIZE_T Size);
+
+	/**
+	 * Enable or disable recycling. Disabling frees every block currently waiting to be reused, blocks of live tasks are
+	 * still released correctly afterwards.
+	 */
+	void SetEnabled(bool bInEnabled);
+
+	bool IsEnabled() const { return bEnabled.load(std::memory_order_relaxed); }
+
+	/** Set how many free blocks each size class may keep, extra blocks are given back to the heap */
+	void SetMaxFreeBlocksPerSizeClass(int32 InMaxFreeBlocks);
+
+	/** Give every block waiting to be reused back to the heap */
+	void Trim();
+
+	/**
+	 * Close the current frame, making the number of reused blocks since the last call available through
+	 * GetLastFrameReusedCount. Calls made more than once on the same engine frame are ignored.
+	 */
+	void EndFrame();
+
+	/** Number of heap allocations avoided during the last closed frame */
+	uint64 GetLastFrameReusedCount() const { return LastFrameReusedCount.load(std::memory_order_relaxed); }
+
+	/** Highest number of heap allocations avoided in a single frame */
+	uint64 GetPeakFrameReusedCount() const { return PeakFrameReusedCount.load(std::memory_order_relaxed); }
+
+	/** Get counters of every size class that has been used, ordered by block size */
+	TArray<FAccelByteAsyncTaskPoolStats> GetStats() const;
+
+	/** Print counters of every size class that has been used */
+	void Dump(FOutputDevice& Ar) const;
+
+private:
+	struct FSizeClass
+	{
+		TArray<void*> FreeBlocks;
+		uint64 ReusedCount = 0;
+		uint64 AllocatedCount = 0;
+		uint64 DiscardedCount = 0;
+		int32 LiveNum = 0;
+		mutable FCriticalSection Lock;
+	};
+
+	FSizeClass SizeClasses[SizeClassNum];
+
+	std::atomic<bool> bEnabled{true};
+	std::atomic<int32> MaxFreeBlocksPerSizeClass{32};
+
+	/** Reused count of every size class combined, and its value when the last frame was closed */
+	std::atomic<uint64> TotalReusedCount{0};
+	uint64 FrameStartReusedCount = 0;
+	uint64 LastClosedFrame = 0;
+	std::atomic<uint64> LastFrameReusedCount{0};
+	std::atomic<uint64> PeakFrameReusedCount{0};
+
+	/** Get the size class index for a size, INDEX_NONE if the size is too large to be pooled */
+	static int32 GetSizeClassIndex(SIZE_T Size);
+};
@@ -0,0 +1,33 @@
+// Copyright (c) 2025 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+#pragma once
+
+#include "CoreMinimal.h"
+#include <atomic>
+
+/**
+ * Shared flag telling async tasks that their result is no longer wanted. A token is handed to every task dispatched for a
+ * local user, and to every child of those tasks, so that cancelling it reaches the whole group at once. Once cancelled a
+ * token stays cancelled, tasks dispatched afterwards get a fresh token.
+ */
+class ONLINESUBSYSTEMACCELBYTE_API FAccelByteCancellationToken
+{
+public:
+	/** Cancel every task holding this token, safe to call from any thread */
+	void Cancel()
+	{
+		bIsCancelled.store(true, std::memory_order_release);
+	}
+
+	bool IsCancelled() const
+	{
+		return bIsCancelled.load(std::memory_order_acquire);
+	}
+
+private:
+	std::atomic<bool> bIsCancelled{false};
+};
+
+typedef TSharedRef<FAccelByteCancellationToken, ESPMode::ThreadSafe> FAccelByteCancellationTokenRef;
+typedef TSharedPtr<FAccelByteCancellationToken, ESPMode::ThreadSafe> FAccelByteCancellationTokenPtr;
@@ -0,0 +1,107 @@
+// Copyright (c) 2025 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+#pragma once
+
+#include "CoreMinimal.h"
+
+/** State of the circuit breaker of a single service */
+enum class EAccelByteCircuitBreakerState : uint8
+{
+	/** Service is healthy, every request goes through */
+	Closed,
+	/** Service failed repeatedly, requests fail fast until the open duration has passed */
+	Open,
+	/** Open duration has passed, a single probe request is let through to find out if the service recovered */
+	HalfOpen
+};
+
+const static inline FString CircuitBreakerStateToString(EAccelByteCircuitBreakerState State)
+{
+	switch (State)
+	{
+	case EAccelByteCircuitBreakerState::Closed:
+		return TEXT("Closed");
+	case EAccelByteCircuitBreakerState::Open:
+		return TEXT("Open");
+	case EAccelByteCircuitBreakerState::HalfOpen:
+		return TEXT("HalfOpen");
+	}
+	return TEXT("Unknown");
+}
+
+/**
+ * Counters and state of the circuit breaker of a single service
+ */
+struct ONLINESUBSYSTEMACCELBYTE_API FAccelByteCircuitBreakerStats
+{
+	EAccelByteCircuitBreakerState State = EAccelByteCircuitBreakerState::Closed;
+
+	/** Failures in a row since the last success */
+	int32 ConsecutiveFailureNum = 0;
+
+	uint64 SuccessCount = 0;
+	uint64 FailureCount = 0;
+
+	/** Requests retried after a transient failure */
+	uint64 RetryCount = 0;
+
+	/** Requests failed fast because the breaker was open */
+	uint64 RejectedCount = 0;
+
+	/** Number of times the breaker opened */
+	uint64 TripCount = 0;
+};
+
+/**
+ * Circuit breakers for every backend service used by async tasks, keyed by the service name of their retry policy. A
+ * breaker opens after a number of failures in a row, fails requests fast while open, and lets a single probe through once
+ * the open duration has passed. The probe closes the breaker if it succeeds, or opens it again if it fails.
+ */
+class ONLINESUBSYSTEMACCELBYTE_API FAccelByteCircuitBreakers
+{
+public:
+	/**
+	 * @param InFailureThreshold Failures in a row that open a breaker, zero or less disables every breaker
+	 * @param InOpenDurationSeconds Time a breaker stays open before letting a probe through
+	 */
+	FAccelByteCircuitBreakers(int32 InFailureThreshold = 5, double InOpenDurationSeconds = 10.0);
+
+	/** Whether a request to the service should be sent, counts the request as rejected if not */
+	bool AllowRequest(const FName& ServiceName);
+
+	void RecordSuccess(const FName& ServiceName);
+
+	void RecordFailure(const FName& ServiceName);
+
+	void RecordRetry(const FName& ServiceName);
+
+	/** Get the stats of every service seen so far */
+	TMap<FName, FAccelByteCircuitBreakerStats> GetStats() const;
+
+	/** Close every breaker and clear its counters */
+	void Reset();
+
+	/** Print the state and counters of every service seen so far */
+	void Dump(FOutputDevice& Ar) const;
+
+private:
+	struct FBreaker
+	{
+		FAccelByteCircuitBreakerStats Stats;
+
+		/** Time when the breaker opened, or when the last probe was let through while half open */
+		double StateChangeTimeInSeconds = 0.0;
+
+		bool bIsProbeInFlight = false;
+	};
+
+	int32 FailureThreshold;
+	double OpenDurationSeconds;
+
+	TMap<FName, FBreaker> Breakers;
+
+	mutable FCriticalSection BreakersLock;
+
+	void Trip(FBreaker& Breaker, double CurrentTimeInSeconds);
+};
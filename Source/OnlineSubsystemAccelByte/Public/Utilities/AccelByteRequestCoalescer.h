@@ -0,0 +1,88 @@
+// Copyright (c) 2025 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Misc/OutputDevice.h"
+
+/**
+ * Counters for a single kind of request, that is every coalescing key built with the same task name
+ */
+struct ONLINESUBSYSTEMACCELBYTE_API FAccelByteCoalescingKindStats
+{
+	/** Number of tasks that were actually dispatched for this kind of request */
+	uint64 DispatchedCount = 0;
+
+	/** Number of requests that attached to an in-flight task instead of dispatching their own */
+	uint64 CoalescedCount = 0;
+};
+
+/**
+ * Registry of in-flight read requests, keyed by task type, normalized arguments and user. A request whose key matches
+ * an in-flight task attaches a completion callback to that task instead of dispatching a new one. Callbacks are run on
+ * the game thread right after the delegates of the task they attached to, so they can read the results from the caches
+ * that task populated.
+ */
+class ONLINESUBSYSTEMACCELBYTE_API FAccelByteRequestCoalescer
+{
+public:
+	/** Callback run for a coalesced request once the in-flight task it attached to has completed */
+	using FOnRequestComplete = TFunction<void(bool /*bWasSuccessful*/)>;
+
+	/**
+	 * Build a coalescing key. Arguments are sorted so that the same set of arguments passed in a different order maps to
+	 * the same key.
+	 *
+	 * @param TaskName Name of the task type that serves the request
+	 * @param UserKey Identifier of the user performing the request, results are never shared across users
+	 * @param Arguments Request arguments that change the result of the task
+	 */
+	static FString MakeRequestKey(const FString& TaskName, const FString& UserKey, TArray<FString> Arguments = {});
+
+	/**
+	 * Attach to an in-flight request with the same key, or register the key as in-flight if there is none.
+	 *
+	 * @param Key Coalescing key of the request
+	 * @param OnComplete Callback to run when the in-flight request completes, only kept if this returns true
+	 * @return true if the request was attached to an in-flight task, false if the caller must dispatch a task for the key
+	 */
+	bool TryJoin(const FString& Key, FOnRequestComplete&& OnComplete);
+
+	/**
+	 * Mark the in-flight request for a key as done, and run every callback that was attached to it.
+	 */
+	void Complete(const FString& Key, bool bWasSuccessful);
+
+	/** Get the number of keys that currently have an in-flight task */
+	int32 GetInFlightNum() const;
+
+	/** Get a copy of the counters recorded for every kind of request, keyed by task name */
+	TMap<FString, FAccelByteCoalescingKindStats> GetStats() const;
+
+	/** Clear every counter, in-flight requests are kept */
+	void ResetStats();
+
+	/**
+	 * Write a human readable report to the output device.
+	 *
+	 * @param Ar Output device to write to
+	 * @param Filter Only request kinds containing this string are written, empty to write every kind
+	 */
+	void Dump(FOutputDevice& Ar, const FString& Filter = TEXT("")) const;
+
+private:
+	mutable FCriticalSection CoalescerLock;
+
+	/** Callbacks attached to every in-flight key */
+	TMap<FString, TArray<FOnRequestComplete>> InFlightRequests;
+
+	/**
+	 * Counters keyed by the task name part of the coalescing key. Full keys embed user IDs and arguments, so keeping
+	 * counters per key would grow without bound.
+	 */
+	TMap<FString, FAccelByteCoalescingKindStats> StatsByKind;
+
+	/** Get the task name part of a key built by MakeRequestKey */
+	static FString GetRequestKind(const FString& Key);
+};
@@ -0,0 +1,184 @@
+// Copyright (c) 2025 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Core/AccelByteError.h"
+#include "JsonObjectConverter.h"
+#include <atomic>
+
+/** What FAccelByteResponseRecorder does with the requests that go through it */
+enum class EAccelByteResponseRecorderMode : uint8
+{
+	/** Requests go to the backend untouched */
+	Off,
+	/** Requests go to the backend, and every response is recorded along with its latency */
+	Record,
+	/** Requests never reach the backend, the recorded responses are played back instead */
+	Replay
+};
+
+/** A single SDK response captured by FAccelByteResponseRecorder */
+struct ONLINESUBSYSTEMACCELBYTE_API FAccelByteRecordedResponse
+{
+	/** Name of the SDK request, for example Entitlement.QueryUserEntitlements */
+	FString RequestName;
+
+	/** Time from sending the request to the SDK calling back, in seconds */
+	double LatencyInSeconds = 0.0;
+
+	bool bWasSuccessful = false;
+
+	/** Success payload serialized as JSON, empty for requests without a payload */
+	FString Payload;
+
+	int32 ErrorCode = 0;
+	FString ErrorMessage;
+};
+
+/**
+ * Records the SDK responses that reach async tasks during a real session, and plays them back later without a backend,
+ * so that the OSS can be profiled offline and deterministically. Tasks opt in by routing their SDK delegates through
+ * Intercept right before sending a request:
+ *
+ *     if (FAccelByteResponseRecorder::Get().Intercept(TEXT("Entitlement.QueryUserEntitlements"), OnSuccess, OnError)) { return; }
+ *
+ * While recording, Intercept wraps both delegates to capture the response and returns false, so the request is sent as
+ * usual. While replaying, Intercept schedules the next recorded response of that request name and returns true, so the
+ * request is never sent. Responses of the same request name are played back in the order they were recorded. Replayed
+ * responses are triggered from the game thread once their recorded latency, divided by the replay speed, has passed.
+ *
+ * Success payloads are serialized with FJsonObjectConverter, so they must be USTRUCT models, which every SDK model is.
+ *
+ * Adopters are QueryEntitlements, JoinV2GameSession, RefreshV2GameSession (client side), JoinV2Party,
+ * RefreshV2PartySession and ChatGetConfig. Login and ConnectLobby are deliberately left out: a login response is only
+ * meaningful once the SDK has stored the credentials it carries, and the lobby is a websocket connection, so neither can
+ * be played back at the delegate boundary. Flows that need them must still log in and connect against a backend.
+ */
+class ONLINESUBSYSTEMACCELBYTE_API FAccelByteResponseRecorder
+{
+public:
+	/** Recorder shared by every subsystem instance */
+	static FAccelByteResponseRecorder& Get();
+
+	EAccelByteResponseRecorderMode GetMode() const
+	{
+		return Mode.load(std::memory_order_acquire);
+	}
+
+	/** Start recording responses, discarding anything recorded or loaded before */
+	void StartRecording();
+
+	/**
+	 * Stop recording and save every response recorded so far.
+	 *
+	 * @param FilePath File to save to, relative paths are saved under Saved/AccelByte/Recordings
+	 * @return false if the file could not be written
+	 */
+	bool StopRecording(const FString& FilePath);
+
+	/**
+	 * Load a recording and start playing it back.
+	 *
+	 * @param FilePath File to load, relative paths are loaded from Saved/AccelByte/Recordings
+	 * @param InSpeed Replayed latencies are divided by this, zero or less triggers every response on the next pump
+	 * @return false if the file could not be loaded, in which case the recorder is turned off
+	 */
+	bool StartReplay(const FString& FilePath, double InSpeed = 1.0);
+
+	/** Stop playing back, responses that were already scheduled are dropped */
+	void StopReplay();
+
+	/** Trigger every replayed response that is due, called from the async task manager on the game thread */
+	void PumpReplays();
+
+	/** Print the mode and counters of the recorder */
+	void Dump(FOutputDevice& Ar) const;
+
+	/**
+	 * Route the delegates of an SDK request with a payload through the recorder.
+	 *
+	 * @param RequestName Stable name of the request, used to match responses on replay
+	 * @param OnSuccess Success delegate about to be given to the SDK, wrapped in place while recording
+	 * @param OnError Error delegate about to be given to the SDK, wrapped in place while recording
+	 * @return true if the response will be replayed, in which case the request must not be sent
+	 */
+	template<typename ResultType>
+	bool Intercept(const FString& RequestName, AccelByte::THandler<ResultType>& OnSuccess, AccelByte::FErrorHandler& OnError)
+	{
+		const EAccelByteResponseRecorderMode CurrentMode = GetMode();
+		if (CurrentMode == EAccelByteResponseRecorderMode::Off)
+		{
+			return false;
+		}
+
+		if (CurrentMode == EAccelByteResponseRecorderMode::Record)
+		{
+			const double SentTimeInSeconds = FPlatformTime::Seconds();
+			OnSuccess = AccelByte::THandler<ResultType>::CreateLambda([RequestName, SentTimeInSeconds, Inner = OnSuccess](const ResultType& Result)
+			{
+				FString Payload;
+				FJsonObjectConverter::UStructToJsonObjectString(Result, Payload, 0, 0, 0, nullptr, false);
+				Get().RecordResponse(RequestName, SentTimeInSeconds, true, Payload, 0, FString());
+				Inner.ExecuteIfBound(Result);
+			});
+			WrapErrorForRecording(RequestName, SentTimeInSeconds, OnError);
+			return false;
+		}
+
+		ScheduleReplay(RequestName, [OnSuccess, OnError](const FAccelByteRecordedResponse& Response)
+		{
+			ResultType Result;
+			if (Response.bWasSuccessful && FJsonObjectConverter::JsonObjectStringToUStruct(Response.Payload, &Result, 0, 0))
+			{
+				OnSuccess.ExecuteIfBound(Result);
+			}
+			else
+			{
+				OnError.ExecuteIfBound(Response.ErrorCode, Response.ErrorMessage);
+			}
+		});
+		return true;
+	}
+
+	/** Same as the templated Intercept, for SDK requests that succeed without a payload */
+	bool Intercept(const FString& RequestName, AccelByte::FVoidHandler& OnSuccess, AccelByte::FErrorHandler& OnError);
+
+private:
+	/** A replayed response waiting for its latency to pass */
+	struct FScheduledReplay
+	{
+		double DueTimeInSeconds = 0.0;
+		FAccelByteRecordedResponse Response;
+		TFunction<void(const FAccelByteRecordedResponse&)> Trigger;
+	};
+
+	std::atomic<EAccelByteResponseRecorderMode> Mode{EAccelByteResponseRecorderMode::Off};
+
+	/** Responses in the order they arrived while recording */
+	TArray<FAccelByteRecordedResponse> RecordedResponses;
+
+	/** Responses left to replay, one FIFO queue per request name */
+	TMap<FString, TArray<FAccelByteRecordedResponse>> ReplayQueues;
+
+	TArray<FScheduledReplay> ScheduledReplays;
+
+	double ReplaySpeed = 1.0;
+
+	/** Requests replayed without a matching recorded response, they are failed instead */
+	int32 MissingResponseNum = 0;
+	int32 ReplayedResponseNum = 0;
+
+	/** Lock for every member above apart from Mode, requests can be sent from any thread */
+	mutable FCriticalSection Lock;
+
+	void RecordResponse(const FString& RequestName, double SentTimeInSeconds, bool bWasSuccessful, const FString& Payload, int32 ErrorCode, const FString& ErrorMessage);
+
+	void WrapErrorForRecording(const FString& RequestName, double SentTimeInSeconds, AccelByte::FErrorHandler& OnError);
+
+	/** Pop the next recorded response of a request, or make up a failed one if nothing is left, and schedule it */
+	void ScheduleReplay(const FString& RequestName, TFunction<void(const FAccelByteRecordedResponse&)>&& Trigger);
+
+	static FString GetRecordingPath(const FString& FilePath);
+};
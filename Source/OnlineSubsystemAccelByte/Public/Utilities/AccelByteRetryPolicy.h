@@ -0,0 +1,66 @@
+// Copyright (c) 2025 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Declares how an async task retries a failed backend request, and which service it talks to. Tasks set their policy in
+ * their constructor and call FOnlineAsyncTaskAccelByte::TryRetryRequest from their SDK error handler.
+ *
+ * The default policy never retries and is not bound to any service. Only tasks whose request is safe to send twice, such
+ * as reads, should opt in.
+ */
+struct ONLINESUBSYSTEMACCELBYTE_API FAccelByteRetryPolicy
+{
+	/** Total number of attempts for a single request, including the first one */
+	int32 MaxAttempts = 1;
+
+	/** Backoff before the first retry, doubled (see BackoffMultiplier) on every further retry */
+	double InitialBackoffSeconds = 0.5;
+
+	/** Upper bound of the backoff, before jitter is applied */
+	double MaxBackoffSeconds = 8.0;
+
+	double BackoffMultiplier = 2.0;
+
+	/** Fraction of the backoff that is randomized, so that clients failing together do not retry together */
+	double JitterFraction = 0.5;
+
+	/** Error codes worth retrying, anything else fails the task straight away */
+	TArray<int32> RetryableErrorCodes = { 408, 429, 500, 502, 503, 504 };
+
+	/** Service the request is sent to, used as the circuit breaker key. NAME_None opts out of the circuit breaker */
+	FName ServiceName = NAME_None;
+
+	/**
+	 * Policy used by tasks that read from a backend service, retrying transient failures a couple of times.
+	 *
+	 * @param InServiceName Service the task talks to, shared by every task using the same service
+	 */
+	static FAccelByteRetryPolicy ForService(const FName& InServiceName, int32 InMaxAttempts = 3)
+	{
+		FAccelByteRetryPolicy Policy;
+		Policy.ServiceName = InServiceName;
+		Policy.MaxAttempts = InMaxAttempts;
+		return Policy;
+	}
+
+	bool IsRetryable(int32 ErrorCode) const
+	{
+		return RetryableErrorCodes.Contains(ErrorCode);
+	}
+
+	/**
+	 * Get the delay before a retry.
+	 *
+	 * @param RetryNum One for the first retry, two for the second, and so on
+	 */
+	double GetBackoffSeconds(int32 RetryNum) const
+	{
+		const double Backoff = FMath::Min(InitialBackoffSeconds * FMath::Pow(BackoffMultiplier, static_cast<double>(FMath::Max(RetryNum - 1, 0))), MaxBackoffSeconds);
+		const double Jitter = FMath::Clamp(JitterFraction, 0.0, 1.0);
+		return Backoff * (1.0 - Jitter) + Backoff * Jitter * FMath::FRand();
+	}
+};
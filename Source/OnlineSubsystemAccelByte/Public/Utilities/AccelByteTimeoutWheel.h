@@ -0,0 +1,93 @@
+// Copyright (c) 2025 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+#pragma once
+
+#include "CoreMinimal.h"
+
+class FOnlineAsyncTaskAccelByte;
+
+/**
+ * Hierarchical timing wheel used by the async task manager to expire task timeouts. Tasks only push their deadline with an
+ * atomic store when they make progress, the wheel reads it back once the bucket the task was scheduled in comes due. A task
+ * whose deadline has moved is rescheduled, otherwise it is flagged as timed out and completes itself on its next tick.
+ *
+ * Advancing the wheel costs one bucket per elapsed resolution step, plus the tasks in the buckets that came due.
+ */
+class ONLINESUBSYSTEMACCELBYTE_API FAccelByteTimeoutWheel
+{
+public:
+	/** Number of buckets for each level of the wheel, must be a power of two */
+	static constexpr int32 SlotsPerLevel = 64;
+
+	/** @param InResolutionSeconds Width of a bucket in the first level of the wheel, timeouts fire at most this late */
+	explicit FAccelByteTimeoutWheel(double InResolutionSeconds = 0.25);
+
+	/**
+	 * Schedule a task to be checked at the deadline given. Scheduling a task that is already in the wheel moves it.
+	 * The task must be cancelled before it is destroyed.
+	 */
+	void Schedule(FOnlineAsyncTaskAccelByte* Task, double DeadlineInSeconds);
+
+	/** Remove a task from the wheel, does nothing if the task is not scheduled */
+	void Cancel(FOnlineAsyncTaskAccelByte* Task);
+
+	/**
+	 * Advance the wheel to the time given, checking every task in the buckets that came due.
+	 *
+	 * @return Number of tasks that were flagged as timed out
+	 */
+	int32 Advance(double CurrentTimeInSeconds);
+
+	/** Get the number of tasks currently scheduled */
+	int32 Num() const;
+
+	/** Number of tasks scheduled since the wheel was created */
+	uint64 GetScheduledCount() const;
+
+	/** Number of times a due task was pushed back to a later bucket because its deadline had moved */
+	uint64 GetRescheduledCount() const;
+
+	/** Number of tasks flagged as timed out since the wheel was created */
+	uint64 GetExpiredCount() const;
+
+private:
+	struct FEntry
+	{
+		FOnlineAsyncTaskAccelByte* Task = nullptr;
+		int64 DeadlineTick = 0;
+	};
+
+	/** Location of a scheduled task, Level is the index in Levels or INDEX_NONE for the overflow list */
+	struct FLocation
+	{
+		int32 Level = INDEX_NONE;
+		int32 Slot = 0;
+	};
+
+	static constexpr int32 LevelNum = 2;
+
+	double ResolutionSeconds;
+
+	/** Last tick that has been processed */
+	int64 CurrentTick = 0;
+	bool bHasStarted = false;
+
+	TArray<FEntry> Levels[LevelNum][SlotsPerLevel];
+
+	/** Tasks scheduled further than the last level can hold, re-inserted every time the last level wraps around */
+	TArray<FEntry> Overflow;
+
+	TMap<FOnlineAsyncTaskAccelByte*, FLocation> Locations;
+
+	uint64 ScheduledCount = 0;
+	uint64 RescheduledCount = 0;
+	uint64 ExpiredCount = 0;
+
+	mutable FCriticalSection WheelLock;
+
+	int64 ToTick(double TimeInSeconds) const;
+	void Insert(const FEntry& Entry);
+	void Remove(FOnlineAsyncTaskAccelByte* Task);
+	void Cascade(TArray<FEntry>& Entries);
+};
@@ -0,0 +1,92 @@
+// Copyright (c) 2025 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+#pragma once
+
+#include "CoreMinimal.h"
+#include "OnlineSubsystemAccelByteTypes.h"
+
+/**
+ * Encoders and decoders for the composite structure of an AccelByte user ID.
+ *
+ * The legacy form is Base64 of the JSON object described on FUniqueNetIdAccelByteUser, which is what ToString returns.
+ *
+ * The compact form is binary and versioned, used by NBO serialization. Version 1 is laid out as follows:
+ * - uint8 version
+ * - uint8 flags, see ECompactFlags
+ * - AccelByte ID, either 16 raw bytes for a lowercase 32 character hex UUID, or a length prefixed UTF-8 string
+ * - uint8 index of the platform type in the table of known platform types, or 0xFF followed by a length prefixed UTF-8 string
+ * - platform ID as a length prefixed UTF-8 string
+ *
+ * Lengths are unsigned LEB128, so a user without platform information takes 20 bytes instead of about a hundred characters.
+ * Entries of the platform type table may only ever be appended, since their index goes over the wire.
+ */
+class ONLINESUBSYSTEMACCELBYTE_API FAccelByteUniqueIdEncoding
+{
+public:
+	/** Version written in the first byte of the compact form */
+	static constexpr uint8 CompactVersion = 1;
+
+	/** Written by FNboSerializeToBufferAccelByte in place of a string length to flag a compact ID, legacy lengths are never negative */
+	static constexpr int32 CompactNboMarker = -0x41424944;
+
+	/**
+	 * Whether FNboSerializeToBufferAccelByte writes user IDs in the compact form, set by bUseCompactUniqueIdEncoding.
+	 * Defaults to false, only enable it once every peer runs a version that can read the compact form.
+	 */
+	static bool IsCompactNboEnabled();
+
+	/**
+	 * Encode a composite in the compact form.
+	 *
+	 * @param CompositeId Composite to encode
+	 * @param OutBytes Bytes are appended to this array
+	 */
+	static void EncodeCompact(const FAccelByteUniqueIdComposite& CompositeId, TArray<uint8>& OutBytes);
+
+	/**
+	 * Decode a composite from the compact form.
+	 *
+	 * @param Bytes Start of the compact form
+	 * @param Size Number of bytes available
+	 * @param OutCompositeId Decoded composite
+	 * @return false if the bytes are truncated, malformed or of a version this build does not know
+	 */
+	static bool DecodeCompact(const uint8* Bytes, int32 Size, FAccelByteUniqueIdComposite& OutCompositeId);
+
+	/**
+	 * Encode a composite in the legacy Base64 JSON form.
+	 *
+	 * @return Encoded string, empty if the composite could not be serialized
+	 */
+	static FString EncodeLegacy(const FAccelByteUniqueIdComposite& CompositeId);
+
+	/**
+	 * Decode a composite from the legacy Base64 JSON form.
+	 *
+	 * @return false if the string is not Base64 or does not hold a composite JSON object
+	 */
+	static bool DecodeLegacy(const FString& EncodedId, FAccelByteUniqueIdComposite& OutCompositeId);
+
+	/** Append an unsigned LEB128 length, shared with other compact formats such as the user cache snapshot */
+	static void WriteLength(uint32 Length, TArray<uint8>& OutBytes);
+
+	/** Read an unsigned LEB128 length, false if it is truncated or does not fit 32 bits */
+	static bool ReadLength(const uint8* Bytes, int32 Size, int32& InOutOffset, uint32& OutLength);
+
+	/** Append a length prefixed UTF-8 string */
+	static void WriteString(const FString& Value, TArray<uint8>& OutBytes);
+
+	/** Read a length prefixed UTF-8 string, false if it runs past Size */
+	static bool ReadString(const uint8* Bytes, int32 Size, int32& InOutOffset, FString& OutValue);
+
+private:
+	enum ECompactFlags : uint8
+	{
+		/** The AccelByte ID is not a lowercase hex UUID and is stored as a string */
+		StringAccelByteId = 1 << 0,
+	};
+
+	/** Index written for a platform type missing from the table */
+	static constexpr uint8 CustomPlatformType = 0xFF;
+};
@@ -0,0 +1,116 @@
+// Copyright (c) 2025 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+#pragma once
+
+#include "CoreMinimal.h"
+#include "OnlineSubsystemAccelByteTypes.h"
+#include "Misc/OutputDevice.h"
+#include <atomic>
+
+/** Counters of FAccelByteUniqueIdRegistry */
+struct ONLINESUBSYSTEMACCELBYTE_API FAccelByteUniqueIdRegistryStats
+{
+	/** Lookups that returned an ID that was already interned */
+	uint64 HitCount = 0;
+
+	/** Lookups that had to create a new ID */
+	uint64 MissCount = 0;
+
+	/** Entries removed because every reference to their ID was released */
+	uint64 EvictedCount = 0;
+
+	/** Entries in both indices, including the ones whose ID was released but not evicted yet */
+	int32 EntryNum = 0;
+
+	/** Entries whose ID is still referenced */
+	int32 LiveNum = 0;
+};
+
+/**
+ * Intern table for AccelByte user IDs, so that an ID for the same AccelByte user on the same platform is only decoded or
+ * encoded once, and shared by everything that holds it for as long as anything does. IDs are indexed both by their
+ * composite structure and by their encoded string, and only weakly referenced, so an ID is freed as soon as the last
+ * shared reference to it is released. Entries of freed IDs are swept once the tables have grown enough.
+ *
+ * Used by FUniqueNetIdAccelByteUser::Create, which is safe to call from any thread.
+ */
+class ONLINESUBSYSTEMACCELBYTE_API FAccelByteUniqueIdRegistry
+{
+public:
+	/** Registry shared by every subsystem instance */
+	static FAccelByteUniqueIdRegistry& Get();
+
+	/**
+	 * Get the interned ID of a composite, or intern the one returned by Factory if there is none.
+	 *
+	 * @param CompositeId Composite to look up, every field must match exactly
+	 * @param Factory Creates the ID on a miss, called outside of the registry lock. Invalid IDs are returned but never interned
+	 */
+	FUniqueNetIdAccelByteUserRef FindOrAdd(const FAccelByteUniqueIdComposite& CompositeId, TFunctionRef<FUniqueNetIdAccelByteUserRef()> Factory);
+
+	/**
+	 * Get the interned ID of an encoded string, or intern the one returned by Factory if there is none. An ID created by
+	 * Factory whose composite is already interned is dropped in favor of the interned one.
+	 *
+	 * @param EncodedId String to look up, as given to FUniqueNetIdAccelByteUser::Create
+	 * @param Factory Creates the ID on a miss, called outside of the registry lock. Invalid IDs are returned but never interned
+	 */
+	FUniqueNetIdAccelByteUserRef FindOrAddEncoded(const FString& EncodedId, TFunctionRef<FUniqueNetIdAccelByteUserRef()> Factory);
+
+	/**
+	 * Remove the entries of every ID that is no longer referenced.
+	 *
+	 * @return Number of entries removed
+	 */
+	int32 EvictExpired();
+
+	FAccelByteUniqueIdRegistryStats GetStats() const;
+
+	/** Clear the hit, miss and eviction counters, interned IDs are kept */
+	void ResetStats();
+
+	/** Print the counters of the registry */
+	void Dump(FOutputDevice& Ar) const;
+
+private:
+	/** Compares and hashes every field of a composite, unlike its operator== which matches on either the AccelByte or the platform ID */
+	struct FCompositeKeyFuncs : public TDefaultMapKeyFuncs<FAccelByteUniqueIdComposite, TWeakPtr<FUniqueNetIdAccelByteUser const>, false>
+	{
+		static bool Matches(const FAccelByteUniqueIdComposite& A, const FAccelByteUniqueIdComposite& B)
+		{
+			return A.Id == B.Id && A.PlatformType == B.PlatformType && A.PlatformId == B.PlatformId;
+		}
+
+		static uint32 GetKeyHash(const FAccelByteUniqueIdComposite& Key)
+		{
+			return HashCombine(HashCombine(GetTypeHash(Key.Id), GetTypeHash(Key.PlatformType)), GetTypeHash(Key.PlatformId));
+		}
+	};
+
+	using FCompositeIndex = TMap<FAccelByteUniqueIdComposite, TWeakPtr<FUniqueNetIdAccelByteUser const>, FDefaultSetAllocator, FCompositeKeyFuncs>;
+
+	/** Entry count the indices are swept at, grows along with the number of live IDs */
+	static constexpr int32 MinEvictionThreshold = 256;
+
+	FCompositeIndex IdsByComposite;
+	TMap<FString, TWeakPtr<FUniqueNetIdAccelByteUser const>> IdsByEncodedString;
+
+	int32 EvictionThreshold = MinEvictionThreshold;
+
+	/** Lookups only take it for reading, interning a new ID and sweeping take it for writing */
+	mutable FRWLock RegistryLock;
+
+	std::atomic<uint64> HitCount{0};
+	std::atomic<uint64> MissCount{0};
+	uint64 EvictedCount = 0;
+
+	/** Add an ID to the composite index, or get the live ID already there. Must be called with the write lock held */
+	FUniqueNetIdAccelByteUserRef AddToCompositeIndex(const FUniqueNetIdAccelByteUserRef& UserId);
+
+	/** Sweep the indices if they have grown past the eviction threshold. Must be called with the write lock held */
+	void EvictExpiredIfNeeded();
+
+	/** Must be called with the write lock held */
+	int32 EvictExpiredInternal();
+};
@@ -0,0 +1,99 @@
+// Copyright (c) 2025 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+#pragma once
+
+#include "CoreMinimal.h"
+#include "OnlineSubsystemAccelByteTypes.h"
+#include <atomic>
+
+struct FAccelByteUserInfo;
+
+/**
+ * On-disk snapshot of the user cache, letting a new session start with the users of the previous one instead of
+ * querying all of them again.
+ *
+ * The format is binary and versioned. Version 1 is laid out as follows:
+ * - 4 bytes magic 'ABUC'
+ * - uint8 version
+ * - records up to the end of the file, each made of an unsigned LEB128 size followed by:
+ *   - int64 ticks of the UTC time the user was last updated, little endian
+ *   - user ID as a length prefixed compact ID, see FAccelByteUniqueIdEncoding
+ *   - display name, unique display name, public code, game avatar URL, publisher avatar URL and custom attributes
+ *     as JSON, each a length prefixed UTF-8 string
+ *   - LEB128 number of linked platforms, each a length prefixed compact ID, display name, platform ID and avatar URL
+ *
+ * Loading only indexes the records by AccelByte ID, a record is decoded the first time its user is looked up. Since
+ * records are self-contained and skippable, records of users that were never looked up are copied as-is into the next
+ * snapshot.
+ */
+class ONLINESUBSYSTEMACCELBYTE_API FAccelByteUserCacheSnapshot
+{
+public:
+	/** Version written after the magic */
+	static constexpr uint8 Version = 1;
+
+	/**
+	 * Start a snapshot, to be followed by calls to WriteRecord.
+	 */
+	static void WriteHeader(TArray<uint8>& OutBytes);
+
+	/**
+	 * Append the record of a user. Users without an ID are skipped.
+	 */
+	static void WriteRecord(const FAccelByteUserInfo& User, TArray<uint8>& OutBytes);
+
+	/**
+	 * Take the bytes of a snapshot and index its records, without decoding them. Replaces whatever was loaded before.
+	 *
+	 * @param InBytes Whole content of a snapshot file
+	 * @param MinUpdatedTime Records of users last updated before this time are dropped
+	 * @return false if the bytes are not a snapshot of this version, in which case nothing is loaded
+	 */
+	bool Load(TArray<uint8>&& InBytes, const FDateTime& MinUpdatedTime);
+
+	/**
+	 * Decode the record of a user and drop it from the snapshot, so that a user is only ever restored once. Safe to
+	 * call from any thread.
+	 *
+	 * @return Restored user, or nullptr if the snapshot has no valid record for it
+	 */
+	TSharedPtr<FAccelByteUserInfo, ESPMode::ThreadSafe> Take(const FString& AccelByteId);
+
+	/**
+	 * Append the records that were never taken to a snapshot being written, skipping the ones of users already in it.
+	 *
+	 * @param WrittenIds AccelByte IDs of the users already written
+	 * @param MaxNum Maximum number of records to append
+	 * @return Number of records appended
+	 */
+	int32 WriteRemainingRecords(const TSet<FString>& WrittenIds, int32 MaxNum, TArray<uint8>& OutBytes) const;
+
+	/** Cheap check done on every cache miss, so that the lock is only taken while there is something to restore */
+	bool IsEmpty() const { return RecordNum.load(std::memory_order_relaxed) == 0; }
+
+	/** Drop every record and free the snapshot bytes */
+	void Reset();
+
+private:
+	struct FRecord
+	{
+		int32 Offset = 0;
+		int32 Size = 0;
+	};
+
+	TArray<uint8> Bytes;
+
+	/** Records that were not taken yet by AccelByte ID */
+	TMap<FString, FRecord> Records;
+
+	std::atomic<int32> RecordNum{0};
+
+	mutable FCriticalSection SnapshotLock;
+
+	static bool DecodeRecord(const uint8* RecordBytes, int32 Size, FAccelByteUserInfo& OutUser);
+
+	/** IDs are written with a length prefix, zero for a missing ID which reads back as an empty composite */
+	static void WriteCompactId(const TSharedPtr<const FUniqueNetIdAccelByteUser>& UserId, TArray<uint8>& OutBytes);
+	static bool ReadCompactId(const uint8* RecordBytes, int32 Size, int32& InOutOffset, FAccelByteUniqueIdComposite& OutCompositeId);
+};
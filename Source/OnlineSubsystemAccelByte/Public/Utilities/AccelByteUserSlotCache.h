@@ -0,0 +1,77 @@
+// Copyright (c) 2025 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+#pragma once
+
+#include "CoreMinimal.h"
+#include "OnlineSubsystemTypes.h"
+#include "OnlineSubsystemAccelByteTypes.h"
+#include "Core/AccelByteApiClient.h"
+#include <atomic>
+
+/** Everything an async task needs to know about the local user it runs for */
+struct ONLINESUBSYSTEMACCELBYTE_API FAccelByteUserSlot
+{
+	AccelByte::FApiClientPtr ApiClient;
+	FUniqueNetIdAccelByteUserPtr UserId;
+
+	/** Bumped every time the slot of this local user is published, zero for a slot that was never published */
+	uint64 Version = 0;
+};
+
+/**
+ * Snapshot of the API client and user ID of every local user, published by the identity interface on login and logout.
+ * Readers resolve both with a single atomic load and never take a lock, which keeps the initialization of async tasks
+ * off the identity maps.
+ *
+ * Published slots are immutable. A slot replaced by a newer one is retired, and freed by a later publish once no reader
+ * is copying any slot anymore.
+ */
+class ONLINESUBSYSTEMACCELBYTE_API FAccelByteUserSlotCache
+{
+public:
+	FAccelByteUserSlotCache();
+	~FAccelByteUserSlotCache();
+
+	FAccelByteUserSlotCache(const FAccelByteUserSlotCache&) = delete;
+	FAccelByteUserSlotCache& operator=(const FAccelByteUserSlotCache&) = delete;
+
+	/**
+	 * Get the slot of a local user, safe to call from any thread.
+	 *
+	 * @return false if the local user is out of range or has never been published
+	 */
+	bool Find(int32 LocalUserNum, FAccelByteUserSlot& OutSlot) const;
+
+	/**
+	 * Get the slot of a logged in user by ID, safe to call from any thread.
+	 *
+	 * @return false if no local user has this ID
+	 */
+	bool FindByUserId(const FUniqueNetIdAccelByteUser& UserId, int32& OutLocalUserNum, FAccelByteUserSlot& OutSlot) const;
+
+	/** Replace the slot of a local user, called by the identity interface whenever the user logs in or out */
+	void Publish(int32 LocalUserNum, const AccelByte::FApiClientPtr& ApiClient, const FUniqueNetIdAccelByteUserPtr& UserId);
+
+	/** Clear the slot of a local user, tasks fall back to the identity interface until it is published again */
+	void Invalidate(int32 LocalUserNum);
+
+private:
+	std::atomic<const FAccelByteUserSlot*> Slots[MAX_LOCAL_PLAYERS];
+
+	/** Slots that were replaced, freed by the first publish that finds no reader, or along with the cache */
+	TArray<const FAccelByteUserSlot*> RetiredSlots;
+
+	/** Number of readers between loading a slot and being done copying it */
+	mutable std::atomic<int32> ReaderNum { 0 };
+
+	/** Serializes writers only, readers never take it */
+	FCriticalSection PublishLock;
+
+	uint64 NextVersion = 1;
+
+	void Swap(int32 LocalUserNum, FAccelByteUserSlot* NewSlot);
+
+	/** Free the retired slots if no reader may still be copying one of them, called with PublishLock held */
+	void FreeRetiredSlots();
+};